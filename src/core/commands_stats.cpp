@@ -0,0 +1,160 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/commands_stats.h"
+
+#include <chrono>
+#include <sstream>
+
+#include <common/string_util.h>
+#include <common/time.h>
+
+namespace {
+
+void WriteLatencyInfoJson(std::ostream& out, const fastonosql::core::LatencyInfo& info) {
+  out << "{\"count\": " << info.count << ", \"min\": " << info.min << ", \"p50\": " << info.p50
+      << ", \"p99\": " << info.p99 << ", \"p999\": " << info.p999 << ", \"max\": " << info.max
+      << ", \"mean\": " << info.mean << "}";
+}
+
+void WriteStringJson(std::ostream& out, const std::string& str) {
+  static const char hex[] = "0123456789abcdef";
+  out << '"';
+  for (size_t i = 0; i < str.size(); ++i) {
+    const unsigned char c = static_cast<unsigned char>(str[i]);
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (c < 0x20) {
+      out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace core {
+
+LatencyInfo::LatencyInfo() : count(0), min(0), p50(0), p99(0), p999(0), max(0), mean(0) {}
+
+LatencyInfo::LatencyInfo(const LatencyHistogram& hist)
+    : count(hist.GetCount()),
+      min(hist.GetMin()),
+      p50(hist.GetValueAtPercentile(50)),
+      p99(hist.GetValueAtPercentile(99)),
+      p999(hist.GetValueAtPercentile(99.9)),
+      max(hist.GetMax()),
+      mean(hist.GetMean()) {}
+
+CommandsStatsSnapShoot::CommandsStatsSnapShoot()
+    : msec(0), commands(), bytes_sent(0), bytes_received(0), network(), reply_parse(), pipeline_depth() {}
+
+CommandsStats::CommandStats::CommandStats() : errors(0), latency() {}
+
+CommandsStats::CommandsStats()
+    : commands_(), bytes_sent_(0), bytes_received_(0), network_(), reply_parse_(), pipeline_depth_() {}
+
+CommandsStats::usec_t CommandsStats::Now() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void CommandsStats::RecordCommand(const std::string& name, usec_t latency, bool failed) {
+  CommandStats& stats = commands_[common::StringToUpperASCII(name)];
+  stats.latency.Record(latency);
+  if (failed) {
+    stats.errors++;
+  }
+}
+
+void CommandsStats::RecordNetwork(usec_t latency, uint64_t bytes_sent, uint64_t bytes_received) {
+  network_.Record(latency);
+  bytes_sent_ += bytes_sent;
+  bytes_received_ += bytes_received;
+}
+
+void CommandsStats::RecordReplyParse(usec_t latency) {
+  reply_parse_.Record(latency);
+}
+
+void CommandsStats::RecordPipeline(size_t depth) {
+  pipeline_depth_.Record(depth);
+}
+
+CommandsStatsSnapShoot CommandsStats::MakeSnapShoot() const {
+  CommandsStatsSnapShoot snapshot;
+  snapshot.msec = common::time::current_mstime();
+  for (auto it = commands_.begin(); it != commands_.end(); ++it) {
+    CommandStatsInfo info;
+    info.name = it->first;
+    info.errors = it->second.errors;
+    info.latency = LatencyInfo(it->second.latency);
+    snapshot.commands.push_back(info);
+  }
+  snapshot.bytes_sent = bytes_sent_;
+  snapshot.bytes_received = bytes_received_;
+  snapshot.network = LatencyInfo(network_);
+  snapshot.reply_parse = LatencyInfo(reply_parse_);
+  snapshot.pipeline_depth = LatencyInfo(pipeline_depth_);
+  return snapshot;
+}
+
+void CommandsStats::Reset() {
+  commands_.clear();
+  bytes_sent_ = 0;
+  bytes_received_ = 0;
+  network_.Reset();
+  reply_parse_.Reset();
+  pipeline_depth_.Reset();
+}
+
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+
+std::string ConvertToString(const fastonosql::core::CommandsStatsSnapShoot& snapshot) {
+  std::ostringstream out;
+  out << "{\"msec\": " << snapshot.msec << ", \"bytes_sent\": " << snapshot.bytes_sent
+      << ", \"bytes_received\": " << snapshot.bytes_received << ", \"network_usec\": ";
+  WriteLatencyInfoJson(out, snapshot.network);
+  out << ", \"reply_parse_usec\": ";
+  WriteLatencyInfoJson(out, snapshot.reply_parse);
+  out << ", \"pipeline_depth\": ";
+  WriteLatencyInfoJson(out, snapshot.pipeline_depth);
+  out << ", \"commands\": [";
+  for (size_t i = 0; i < snapshot.commands.size(); ++i) {
+    const fastonosql::core::CommandStatsInfo& info = snapshot.commands[i];
+    if (i != 0) {
+      out << ", ";
+    }
+    out << "{\"name\": ";
+    WriteStringJson(out, info.name);
+    out << ", \"errors\": " << info.errors << ", \"latency_usec\": ";
+    WriteLatencyInfoJson(out, info.latency);
+    out << "}";
+  }
+  out << "]}";
+  return out.str();
+}
+
+}  // namespace common
@@ -0,0 +1,101 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core/latency_histogram.h"
+
+namespace fastonosql {
+namespace core {
+
+struct LatencyInfo {
+  LatencyInfo();
+  explicit LatencyInfo(const LatencyHistogram& hist);
+
+  uint64_t count;
+  uint64_t min;
+  uint64_t p50;
+  uint64_t p99;
+  uint64_t p999;
+  uint64_t max;
+  double mean;
+};
+
+struct CommandStatsInfo {
+  std::string name;
+  uint64_t errors;
+  LatencyInfo latency;  // usec, whole command: parse of input, network, reply parse
+};
+
+struct CommandsStatsSnapShoot {
+  CommandsStatsSnapShoot();
+
+  uint64_t msec;  // time of snapshot
+  std::vector<CommandStatsInfo> commands;
+  uint64_t bytes_sent;
+  uint64_t bytes_received;
+  LatencyInfo network;         // usec, from first byte written till reply read
+  LatencyInfo reply_parse;     // usec, reply to value conversion
+  LatencyInfo pipeline_depth;  // commands per pipeline
+};
+
+// collects per command latencies and connection counters,
+// not thread safe, should be used from connection thread
+class CommandsStats {
+ public:
+  typedef uint64_t usec_t;
+
+  CommandsStats();
+
+  static usec_t Now();
+
+  void RecordCommand(const std::string& name, usec_t latency, bool failed);
+  void RecordNetwork(usec_t latency, uint64_t bytes_sent, uint64_t bytes_received);
+  void RecordReplyParse(usec_t latency);
+  void RecordPipeline(size_t depth);
+
+  CommandsStatsSnapShoot MakeSnapShoot() const;
+  void Reset();
+
+ private:
+  struct CommandStats {
+    CommandStats();
+
+    uint64_t errors;
+    LatencyHistogram latency;
+  };
+
+  std::map<std::string, CommandStats> commands_;
+  uint64_t bytes_sent_;
+  uint64_t bytes_received_;
+  LatencyHistogram network_;
+  LatencyHistogram reply_parse_;
+  LatencyHistogram pipeline_depth_;
+};
+
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+std::string ConvertToString(const fastonosql::core::CommandsStatsSnapShoot& snapshot);  // json
+}  // namespace common
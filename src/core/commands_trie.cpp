@@ -0,0 +1,138 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/commands_trie.h"
+
+#include <algorithm>
+
+namespace fastonosql {
+namespace core {
+
+namespace {
+
+const uint32_t kNoNode = 0;  // root is never a child
+
+char FoldCase(char c) {
+  return c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c;
+}
+
+bool CharLess(const std::pair<char, uint32_t>& child, char c) {
+  return child.first < c;
+}
+
+}  // namespace
+
+CommandsTrie::Node::Node() : children(), terminal(false), value(0) {}
+
+CommandsTrie::CommandsTrie() : nodes_(1) {}
+
+void CommandsTrie::Insert(const std::string& name, size_t value) {
+  uint32_t node = 0;
+  for (size_t i = 0; i < name.size(); ++i) {
+    const char c = FoldCase(name[i]);
+    uint32_t next = FindChild(node, c);
+    if (next == kNoNode) {
+      next = static_cast<uint32_t>(nodes_.size());
+      nodes_.push_back(Node());
+      std::vector<std::pair<char, uint32_t>>& children = nodes_[node].children;
+      children.insert(std::lower_bound(children.begin(), children.end(), c, CharLess), std::make_pair(c, next));
+    }
+    node = next;
+  }
+
+  if (!nodes_[node].terminal) {
+    nodes_[node].terminal = true;
+    nodes_[node].value = value;
+  }
+}
+
+bool CommandsTrie::Find(const char* name, size_t size, size_t* value) const {
+  uint32_t node = 0;
+  for (size_t i = 0; i < size; ++i) {
+    node = FindChild(node, FoldCase(name[i]));
+    if (node == kNoNode) {
+      return false;
+    }
+  }
+
+  if (!nodes_[node].terminal) {
+    return false;
+  }
+
+  *value = nodes_[node].value;
+  return true;
+}
+
+size_t CommandsTrie::MatchWord(const char* text, size_t size, size_t* value) const {
+  size_t matched = 0;
+  uint32_t node = 0;
+  for (size_t i = 0; i < size; ++i) {
+    node = FindChild(node, FoldCase(text[i]));
+    if (node == kNoNode) {
+      break;
+    }
+
+    const size_t len = i + 1;
+    if (nodes_[node].terminal && (len == size || !IsWordChar(text[len]))) {
+      matched = len;
+      *value = nodes_[node].value;
+    }
+  }
+  return matched;
+}
+
+void CommandsTrie::FindByPrefix(const char* prefix, size_t size, std::vector<size_t>* values) const {
+  uint32_t node = 0;
+  for (size_t i = 0; i < size; ++i) {
+    node = FindChild(node, FoldCase(prefix[i]));
+    if (node == kNoNode) {
+      return;
+    }
+  }
+
+  Collect(node, values);
+}
+
+bool CommandsTrie::IsWordChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-' ||
+         c == '.';
+}
+
+uint32_t CommandsTrie::FindChild(uint32_t node, char c) const {
+  const std::vector<std::pair<char, uint32_t>>& children = nodes_[node].children;
+  auto it = std::lower_bound(children.begin(), children.end(), c, CharLess);
+  if (it == children.end() || it->first != c) {
+    return kNoNode;
+  }
+
+  return it->second;
+}
+
+void CommandsTrie::Collect(uint32_t node, std::vector<size_t>* values) const {
+  const Node& current = nodes_[node];
+  if (current.terminal) {
+    values->push_back(current.value);
+  }
+
+  for (size_t i = 0; i < current.children.size(); ++i) {
+    Collect(current.children[i].second, values);
+  }
+}
+
+}  // namespace core
+}  // namespace fastonosql
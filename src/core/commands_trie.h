@@ -0,0 +1,65 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fastonosql {
+namespace core {
+
+// command names folded to upper case, built once per commands table.
+// Shell lexer recognizes commands in a single pass over the text and answers
+// completion prefixes without touching every command.
+class CommandsTrie {
+ public:
+  CommandsTrie();
+
+  // first insert of a name wins
+  void Insert(const std::string& name, size_t value);
+
+  bool Find(const char* name, size_t size, size_t* value) const;
+  // longest name at the beginning of text which ends on a word boundary, 0 if none
+  size_t MatchWord(const char* text, size_t size, size_t* value) const;
+  // values of all names starting with prefix, in name order
+  void FindByPrefix(const char* prefix, size_t size, std::vector<size_t>* values) const;
+
+  static bool IsWordChar(char c);
+
+ private:
+  struct Node {
+    Node();
+
+    std::vector<std::pair<char, uint32_t>> children;  // sorted by char
+    bool terminal;
+    size_t value;
+  };
+
+  uint32_t FindChild(uint32_t node, char c) const;
+  void Collect(uint32_t node, std::vector<size_t>* values) const;
+
+  std::vector<Node> nodes_;  // root is first
+};
+
+}  // namespace core
+}  // namespace fastonosql
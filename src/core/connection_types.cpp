@@ -21,8 +21,8 @@
 #include <common/macros.h>  // for NOTREACHED, SIZEOFMASS
 
 namespace {
-const char* connnectionType[] = {"Redis",   "Memcached", "SSDB",      "LevelDB", "RocksDB",
-                                 "UnQLite", "LMDB",      "UpscaleDB", "ForestDB"};
+const char* connnectionType[] = {"Redis",   "Memcached", "SSDB",      "LevelDB",  "RocksDB",
+                                 "UnQLite", "LMDB",      "UpscaleDB", "ForestDB", "RDB"};
 const std::string connnectionMode[] = {"Interactive mode"};
 const std::string serverTypes[] = {"Master", "Slave"};
 const std::string serverState[] = {"Up", "Down"};
@@ -58,7 +58,10 @@ const std::vector<connectionTypes> g_compiled_types = {
     UPSCALEDB,
 #endif
 #ifdef BUILD_WITH_FORESTDB
-    FORESTDB
+    FORESTDB,
+#endif
+#ifdef BUILD_WITH_RDB
+    RDB
 #endif
 };
 
@@ -71,7 +74,8 @@ bool IsSupportTTLKeys(connectionTypes type) {
 }
 
 bool IsLocalType(connectionTypes type) {
-  return type == ROCKSDB || type == LEVELDB || type == LMDB || type == UPSCALEDB || type == UNQLITE || type == FORESTDB;
+  return type == ROCKSDB || type == LEVELDB || type == LMDB || type == UPSCALEDB || type == UNQLITE ||
+         type == FORESTDB || type == RDB;
 }
 
 bool IsCanSSHConnection(connectionTypes type) {
@@ -38,7 +38,8 @@ enum connectionTypes {
   UNQLITE,
   LMDB,
   UPSCALEDB,
-  FORESTDB
+  FORESTDB,
+  RDB
 };  // supported types
 enum serverTypes { MASTER = 0, SLAVE };
 enum serverState { SUP = 0, SDOWN };
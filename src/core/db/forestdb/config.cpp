@@ -22,6 +22,7 @@ extern "C" {
 #include "sds.h"
 }
 
+#include <common/convert2string.h>
 #include <common/file_system/types.h>  // for prepare_path
 #include <common/sprintf.h>            // for MemSPrintf
 
@@ -44,6 +45,23 @@ Config ParseOptions(int argc, char** argv) {
       cfg.db_path = argv[++i];
     } else if (!strcmp(argv[i], "-n") && !lastarg) {
       cfg.db_name = argv[++i];
+    } else if (!strcmp(argv[i], "-c") && !lastarg) {
+      unsigned int commit_max_pending;
+      if (common::ConvertFromString(argv[++i], &commit_max_pending)) {
+        cfg.commit_max_pending = commit_max_pending;
+      }
+    } else if (!strcmp(argv[i], "-t") && !lastarg) {
+      unsigned int commit_interval_msec;
+      if (common::ConvertFromString(argv[++i], &commit_interval_msec)) {
+        cfg.commit_interval_msec = commit_interval_msec;
+      }
+    } else if (!strcmp(argv[i], "-w")) {
+      cfg.manual_wal_flush = true;
+    } else if (!strcmp(argv[i], "-s") && !lastarg) {
+      unsigned int compaction_stale_percent;
+      if (common::ConvertFromString(argv[++i], &compaction_stale_percent)) {
+        cfg.compaction_stale_percent = compaction_stale_percent;
+      }
     } else {
       if (argv[i][0] == '-') {
         const std::string buff = common::MemSPrintf(
@@ -64,7 +82,13 @@ Config ParseOptions(int argc, char** argv) {
 }  // namespace
 
 const std::string Config::default_db_name = "default";
-Config::Config() : LocalConfig(common::file_system::prepare_path("~/test.forestdb")), db_name(default_db_name) {}
+Config::Config()
+    : LocalConfig(common::file_system::prepare_path("~/test.forestdb")),
+      db_name(default_db_name),
+      commit_max_pending(default_commit_max_pending),
+      commit_interval_msec(default_commit_interval_msec),
+      manual_wal_flush(false),
+      compaction_stale_percent(default_compaction_stale_percent) {}
 
 }  // namespace forestdb
 }  // namespace core
@@ -80,6 +104,15 @@ std::string ConvertToString(const fastonosql::core::forestdb::Config& conf) {
     argv.push_back(conf.db_name);
   }
 
+  argv.push_back("-c");
+  argv.push_back(common::ConvertToString(conf.commit_max_pending));
+  argv.push_back("-t");
+  argv.push_back(common::ConvertToString(conf.commit_interval_msec));
+  if (conf.manual_wal_flush) {
+    argv.push_back("-w");
+  }
+  argv.push_back("-s");
+  argv.push_back(common::ConvertToString(conf.compaction_stale_percent));
   return fastonosql::core::ConvertToStringConfigArgs(argv);
 }
 
@@ -26,9 +26,18 @@ namespace forestdb {
 
 struct Config : public LocalConfig {
   static const std::string default_db_name;
+  enum {
+    default_commit_max_pending = 1000,
+    default_commit_interval_msec = 1000,
+    default_compaction_stale_percent = 50
+  };
   Config();
 
   std::string db_name;
+  unsigned int commit_max_pending;        // commit after this count of mutations, 0 - disabled
+  unsigned int commit_interval_msec;      // commit when first pending mutation is older, 0 - disabled
+  bool manual_wal_flush;                  // bulk load, WAL is flushed into index only on COMMIT and close
+  unsigned int compaction_stale_percent;  // compact between commands when stale data exceeds it, 0 - disabled
 };
 
 }  // namespace forestdb
@@ -24,9 +24,11 @@
 #include <common/file_system/string_path_utils.h>
 #include <common/utils.h>  // for c_strornull
 
+#include "core/commands_stats.h"  // for CommandsStats::Now
 #include "core/db/forestdb/command_translator.h"
 #include "core/db/forestdb/database_info.h"
 #include "core/db/forestdb/internal/commands_api.h"
+#include "core/key_pattern.h"
 
 namespace fastonosql {
 namespace core {
@@ -40,10 +42,32 @@ const char* ConnectionTraits<FORESTDB>::GetVersionApi() {
   return fdb_get_lib_version();
 }
 namespace forestdb {
+struct fdb_commit_stats {
+  uint64_t mutations;
+  uint64_t commits;
+  uint64_t compactions;
+  CommandsStats::usec_t commit_usec_total;
+  CommandsStats::usec_t commit_usec_max;
+  CommandsStats::usec_t open_ts;
+};
+
+struct fdb_commit_policy {
+  unsigned int max_pending;
+  CommandsStats::usec_t interval_usec;
+  fdb_commit_opt_t periodic_opt;
+  unsigned int compaction_stale_percent;
+};
+
 struct fdb {
   fdb_file_handle* handle;
   fdb_kvs_handle* kvs;
   char* db_name;
+
+  fdb_commit_policy policy;
+  unsigned int pending;
+  CommandsStats::usec_t first_pending_ts;
+  bool compaction_check;  // commit since last stale data check
+  fdb_commit_stats stats;
 };
 
 namespace {
@@ -176,6 +200,35 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         INFINITE_COMMAND_ARGS,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Delete),
+                                          CommandHolder(FORESTDB_COMMIT_COMMAND,
+                                                        "-",
+                                                        "Commit pending mutations and flush WAL",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Commit),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -186,6 +239,87 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Quit)};
 
+// final commit flushes WAL into index also in bulk load mode
+fdb_status forestdb_commit(fdb* context, fdb_commit_opt_t opt) {
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  fdb_status rc = fdb_commit(context->handle, opt);
+  const CommandsStats::usec_t latency = CommandsStats::Now() - start_ts;
+  if (rc != FDB_RESULT_SUCCESS) {
+    return rc;
+  }
+
+  context->pending = 0;
+  context->compaction_check = true;
+  context->stats.commits++;
+  context->stats.commit_usec_total += latency;
+  if (latency > context->stats.commit_usec_max) {
+    context->stats.commit_usec_max = latency;
+  }
+  return FDB_RESULT_SUCCESS;
+}
+
+fdb_status forestdb_compact_if_stale(fdb* context) {
+  if (context->policy.compaction_stale_percent == 0) {
+    return FDB_RESULT_SUCCESS;
+  }
+
+  context->compaction_check = false;
+  fdb_file_info info;
+  fdb_status rc = fdb_get_file_info(context->handle, &info);
+  if (rc != FDB_RESULT_SUCCESS || info.file_size == 0 || info.space_used >= info.file_size) {
+    return rc;
+  }
+
+  const uint64_t stale_percent = (info.file_size - info.space_used) * 100 / info.file_size;
+  if (stale_percent < context->policy.compaction_stale_percent) {
+    return FDB_RESULT_SUCCESS;
+  }
+
+  rc = fdb_compact(context->handle, NULL);  // in place
+  if (rc == FDB_RESULT_SUCCESS) {
+    context->stats.compactions++;
+  }
+  return rc;
+}
+
+// commits by count or age of pending mutations
+fdb_status forestdb_commit_if_needed(fdb* context, CommandsStats::usec_t now) {
+  if (context->pending == 0) {
+    return FDB_RESULT_SUCCESS;
+  }
+
+  const fdb_commit_policy& policy = context->policy;
+  const bool by_count = policy.max_pending && context->pending >= policy.max_pending;
+  const bool by_time = policy.interval_usec && now - context->first_pending_ts >= policy.interval_usec;
+  if (!by_count && !by_time) {
+    return FDB_RESULT_SUCCESS;
+  }
+
+  return forestdb_commit(context, policy.periodic_opt);
+}
+
+// called after every mutation, compaction is left for forestdb_maintenance
+fdb_status forestdb_mutated(fdb* context) {
+  const CommandsStats::usec_t now = CommandsStats::Now();
+  context->stats.mutations++;
+  if (context->pending++ == 0) {
+    context->first_pending_ts = now;
+  }
+
+  return forestdb_commit_if_needed(context, now);
+}
+
+// called between commands, so no iterator is open: commits aged mutations
+// which were not followed by another one and compacts after commits
+fdb_status forestdb_maintenance(fdb* context) {
+  fdb_status rc = forestdb_commit_if_needed(context, CommandsStats::Now());
+  if (rc != FDB_RESULT_SUCCESS || !context->compaction_check) {
+    return rc;
+  }
+
+  return forestdb_compact_if_stale(context);
+}
+
 fdb_status forestdb_create_db(fdb* context, const char* db_name) {
   if (!context || !db_name) {
     return FDB_RESULT_INVALID_ARGS;
@@ -199,8 +333,7 @@ fdb_status forestdb_create_db(fdb* context, const char* db_name) {
     return rc;
   }
 
-  fdb_commit_opt_t opt = FDB_COMMIT_NORMAL;
-  fdb_commit(context->handle, opt);
+  forestdb_commit(context, FDB_COMMIT_MANUAL_WAL_FLUSH);
   fdb_kvs_close(kvs);
   return FDB_RESULT_SUCCESS;
 }
@@ -215,8 +348,7 @@ fdb_status forestdb_remove_db(fdb* context, const char* db_name) {
     return rc;
   }
 
-  fdb_commit_opt_t opt = FDB_COMMIT_NORMAL;
-  fdb_commit(context->handle, opt);
+  forestdb_commit(context, FDB_COMMIT_MANUAL_WAL_FLUSH);
   return FDB_RESULT_SUCCESS;
 }
 
@@ -239,8 +371,7 @@ fdb_status forestdb_select(fdb* context, const char* db_name) {
   }
 
   // cleanup old ref
-  fdb_commit_opt_t opt = FDB_COMMIT_NORMAL;
-  fdb_commit(context->handle, opt);
+  forestdb_commit(context, FDB_COMMIT_MANUAL_WAL_FLUSH);
   common::utils::freeifnotnull(context->db_name);
   context->db_name = NULL;
   fdb_kvs_close(context->kvs);
@@ -252,8 +383,14 @@ fdb_status forestdb_select(fdb* context, const char* db_name) {
   return FDB_RESULT_SUCCESS;
 }
 
-fdb_status forestdb_open(fdb** context, const char* db_path, const char* db_name, fdb_config* fconfig) {
+fdb_status forestdb_open(fdb** context,
+                         const char* db_path,
+                         const char* db_name,
+                         fdb_config* fconfig,
+                         const fdb_commit_policy& policy) {
   fdb* lcontext = reinterpret_cast<fdb*>(calloc(1, sizeof(fdb)));
+  lcontext->policy = policy;
+  lcontext->stats.open_ts = CommandsStats::Now();
   fdb_status rc = fdb_open(&lcontext->handle, db_path, fconfig);
   if (rc != FDB_RESULT_SUCCESS) {
     free(lcontext);
@@ -282,8 +419,7 @@ void forestdb_close(fdb** context) {
     return;
   }
 
-  fdb_commit_opt_t opt = FDB_COMMIT_NORMAL;
-  fdb_commit(lcontext->handle, opt);
+  forestdb_commit(lcontext, FDB_COMMIT_MANUAL_WAL_FLUSH);
   common::utils::freeifnotnull(lcontext->db_name);
   fdb_kvs_close(lcontext->kvs);
   fdb_close(lcontext->handle);
@@ -350,10 +486,19 @@ common::Error CreateConnection(const Config& config, NativeConnection** context)
     return common::make_error(common::MemSPrintf("Invalid input path: (%s), please create folder.", folder));
   }
 
+  fdb_commit_policy policy;
+  policy.max_pending = config.commit_max_pending;
+  policy.interval_usec = static_cast<CommandsStats::usec_t>(config.commit_interval_msec) * 1000;
+  policy.periodic_opt = FDB_COMMIT_NORMAL;
+  policy.compaction_stale_percent = config.compaction_stale_percent;
+  if (config.manual_wal_flush) {  // bulk load, keep mutations in WAL between periodic commits
+    fconfig.wal_flush_before_commit = false;
+  }
+
   // fconfig.flags = FDB_OPEN_FLAG_CREATE;
   const char* db_path_ptr = db_path.c_str();  // start point must be file
   const char* db_name = config.db_name.empty() ? NULL : config.db_name.c_str();
-  fdb_status st = forestdb_open(&lcontext, db_path_ptr, db_name, &fconfig);
+  fdb_status st = forestdb_open(&lcontext, db_path_ptr, db_name, &fconfig, policy);
   if (st != FDB_RESULT_SUCCESS) {
     std::string buff = common::MemSPrintf("Fail open database: %s", fdb_error_msg(st));
     return common::make_error(buff);
@@ -407,6 +552,25 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   if (!errn) {
     linfo.db_size = sz;
   }
+
+  const fdb_commit_stats& stats = connection_.handle_->stats;
+  linfo.mutations = stats.mutations;
+  linfo.commits = stats.commits;
+  linfo.compactions = stats.compactions;
+  const CommandsStats::usec_t uptime = CommandsStats::Now() - stats.open_ts;
+  if (uptime) {
+    linfo.mutations_per_sec = stats.mutations * 1000000 / uptime;
+  }
+  if (stats.commits) {
+    linfo.commit_avg_usec = stats.commit_usec_total / stats.commits;
+  }
+  linfo.commit_max_usec = stats.commit_usec_max;
+
+  fdb_file_info finfo;
+  if (fdb_get_file_info(connection_.handle_->handle, &finfo) == FDB_RESULT_SUCCESS && finfo.file_size &&
+      finfo.space_used < finfo.file_size) {
+    linfo.stale_data_percent = (finfo.file_size - finfo.space_used) * 100 / finfo.file_size;
+  }
   *statsout = linfo;
   return common::Error();
 }
@@ -439,18 +603,51 @@ common::Error DBConnection::ConfigGetDatabases(std::vector<std::string>* dbs) {
   return common::Error();
 }
 
+common::Error DBConnection::Commit() {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  err = CheckResultCommand(FORESTDB_COMMIT_COMMAND, forestdb_commit(connection_.handle_, FDB_COMMIT_MANUAL_WAL_FLUSH));
+  if (err) {
+    return err;
+  }
+
+  return CheckResultCommand(FORESTDB_COMMIT_COMMAND, forestdb_compact_if_stale(connection_.handle_));
+}
+
+common::Error DBConnection::Maintenance() {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  return CheckResultCommand(FORESTDB_COMMIT_COMMAND, forestdb_maintenance(connection_.handle_));
+}
+
 common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   const string_key_t key_slice = key.GetKeyData();
-  return CheckResultCommand(DB_SET_KEY_COMMAND, fdb_set_kv(connection_.handle_->kvs, key_slice.data(), key_slice.size(),
-                                                           value.c_str(), value.size()));
+  common::Error err = CheckResultCommand(DB_SET_KEY_COMMAND, fdb_set_kv(connection_.handle_->kvs, key_slice.data(),
+                                                                        key_slice.size(), value.c_str(), value.size()));
+  if (err) {
+    return err;
+  }
+
+  return CheckResultCommand(DB_SET_KEY_COMMAND, forestdb_mutated(connection_.handle_));
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   const string_key_t key_slice = key.GetKeyData();
   void* value_out = NULL;
   size_t valuelen_out = 0;
-  common::Error err = CheckResultCommand(DB_GET_KEY_COMMAND, fdb_get_kv(connection_.handle_->kvs, key_slice.data(),
-                                                                        key_slice.size(), &value_out, &valuelen_out));
+  const fdb_status st =
+      fdb_get_kv(connection_.handle_->kvs, key_slice.data(), key_slice.size(), &value_out, &valuelen_out);
+  if (st == FDB_RESULT_KEY_NOT_FOUND) {
+    return KeyNotFound(found);
+  }
+
+  common::Error err = CheckResultCommand(DB_GET_KEY_COMMAND, st);
   if (err) {
     return err;
   }
@@ -467,8 +664,13 @@ common::Error DBConnection::DelInner(key_t key) {
   }
 
   const string_key_t key_slice = key.GetKeyData();
-  return CheckResultCommand(DB_DELETE_KEY_COMMAND,
-                            fdb_del_kv(connection_.handle_->kvs, key_slice.data(), key_slice.size()));
+  err = CheckResultCommand(DB_DELETE_KEY_COMMAND,
+                           fdb_del_kv(connection_.handle_->kvs, key_slice.data(), key_slice.size()));
+  if (err) {
+    return err;
+  }
+
+  return CheckResultCommand(DB_DELETE_KEY_COMMAND, forestdb_mutated(connection_.handle_));
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -476,36 +678,50 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t count_keys,
                                      std::vector<std::string>* keys_out,
                                      uint64_t* cursor_out) {
+  const KeyPattern matcher(pattern);
+  const bool match_all = matcher.IsMatchAll();  // no per key matching for "*"
+  const std::string& prefix = matcher.GetPrefix();
+  const std::string& upper_bound = matcher.GetUpperBound();
   fdb_iterator* it = NULL;
-  fdb_iterator_opt_t opt = FDB_ITR_NONE;
+  fdb_iterator_opt_t opt = FDB_ITR_NO_DELETES;
+  if (!upper_bound.empty()) {
+    opt |= FDB_ITR_SKIP_MAX_KEY;
+  }
 
-  common::Error err =
-      CheckResultCommand(DB_SCAN_COMMAND, fdb_iterator_init(connection_.handle_->kvs, &it, NULL, 0, NULL, 0, opt));
+  common::Error err = CheckResultCommand(
+      DB_SCAN_COMMAND,
+      fdb_iterator_init(connection_.handle_->kvs, &it, prefix.empty() ? NULL : prefix.data(), prefix.size(),
+                        upper_bound.empty() ? NULL : upper_bound.data(), upper_bound.size(), opt));
   if (err) {
     return err;
   }
 
-  fdb_doc* doc = NULL;
   uint64_t offset_pos = cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
   do {
-    fdb_status rc = fdb_iterator_get(it, &doc);
+    fdb_doc* doc = NULL;
+    fdb_status rc = fdb_iterator_get_metaonly(it, &doc);  // keys only, bodies are not read
     if (rc != FDB_RESULT_SUCCESS) {
       break;
     }
 
+    if (!matcher.IsPrefixOf(static_cast<const char*>(doc->key), doc->keylen)) {
+      fdb_doc_free(doc);
+      break;
+    }
+
     if (lkeys_out.size() < count_keys) {
-      std::string skey = std::string(static_cast<const char*>(doc->key), doc->keylen);
-      if (common::MatchPattern(skey, pattern)) {
+      if (match_all || matcher.Match(static_cast<const char*>(doc->key), doc->keylen)) {
         if (offset_pos == 0) {
-          lkeys_out.push_back(skey);
+          lkeys_out.push_back(std::string(static_cast<const char*>(doc->key), doc->keylen));
         } else {
           offset_pos--;
         }
       }
     } else {
       lcursor_out = cursor_in + count_keys;
+      fdb_doc_free(doc);
       break;
     }
     fdb_doc_free(doc);
@@ -522,7 +738,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
                                      uint64_t limit,
                                      std::vector<std::string>* ret) {
   fdb_iterator* it = NULL;
-  fdb_iterator_opt_t opt = FDB_ITR_NONE;
+  fdb_iterator_opt_t opt = FDB_ITR_NO_DELETES;
   common::Error err =
       CheckResultCommand(DB_KEYS_COMMAND, fdb_iterator_init(connection_.handle_->kvs, &it, key_start.c_str(),
                                                             key_start.size(), key_end.c_str(), key_end.size(), opt));
@@ -530,14 +746,15 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
     return err;
   }
 
-  fdb_doc* doc = NULL;
   do {
-    fdb_status rc = fdb_iterator_get(it, &doc);
+    fdb_doc* doc = NULL;
+    fdb_status rc = fdb_iterator_get_metaonly(it, &doc);
     if (rc != FDB_RESULT_SUCCESS) {
       break;
     }
 
     std::string key = std::string(static_cast<const char*>(doc->key), doc->keylen);
+    fdb_doc_free(doc);
     if (ret->size() < limit) {
       if (key < key_end) {
         ret->push_back(key);
@@ -545,42 +762,25 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
     } else {
       break;
     }
-    fdb_doc_free(doc);
   } while (fdb_iterator_next(it) != FDB_RESULT_ITERATOR_FAIL);
   fdb_iterator_close(it);
   return common::Error();
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  fdb_iterator* it = NULL;
-  fdb_iterator_opt_t opt = FDB_ITR_NONE;
-
-  common::Error err =
-      CheckResultCommand(DB_DBKCOUNT_COMMAND, fdb_iterator_init(connection_.handle_->kvs, &it, NULL, 0, NULL, 0, opt));
+  fdb_kvs_info info;
+  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, fdb_get_kvs_info(connection_.handle_->kvs, &info));
   if (err) {
     return err;
   }
 
-  size_t sz = 0;
-  fdb_doc* doc = NULL;
-  do {
-    fdb_status rc = fdb_iterator_get(it, &doc);
-    if (rc != FDB_RESULT_SUCCESS) {
-      break;
-    }
-
-    sz++;
-    fdb_doc_free(doc);
-  } while (fdb_iterator_next(it) != FDB_RESULT_ITERATOR_FAIL);
-  fdb_iterator_close(it);
-
-  *size = sz;
+  *size = info.doc_count;  // live documents, deleted are not counted
   return common::Error();
 }
 
 common::Error DBConnection::FlushDBImpl() {
   fdb_iterator* it = NULL;
-  fdb_iterator_opt_t opt = FDB_ITR_NONE;
+  fdb_iterator_opt_t opt = FDB_ITR_NO_DELETES;
 
   common::Error err =
       CheckResultCommand(DB_FLUSHDB_COMMAND, fdb_iterator_init(connection_.handle_->kvs, &it, NULL, 0, NULL, 0, opt));
@@ -588,20 +788,25 @@ common::Error DBConnection::FlushDBImpl() {
     return err;
   }
 
-  fdb_doc* doc = NULL;
   do {
-    fdb_status rc = fdb_iterator_get(it, &doc);
+    fdb_doc* doc = NULL;
+    fdb_status rc = fdb_iterator_get_metaonly(it, &doc);
     if (rc != FDB_RESULT_SUCCESS) {
       break;
     }
 
-    std::string key;
-    err = CheckResultCommand(DB_FLUSHDB_COMMAND, fdb_del_kv(connection_.handle_->kvs, key.c_str(), key.size()));
+    err = CheckResultCommand(DB_FLUSHDB_COMMAND, fdb_del_kv(connection_.handle_->kvs, doc->key, doc->keylen));
+    fdb_doc_free(doc);
+    if (err) {
+      fdb_iterator_close(it);
+      return err;
+    }
+
+    err = CheckResultCommand(DB_FLUSHDB_COMMAND, forestdb_mutated(connection_.handle_));
     if (err) {
       fdb_iterator_close(it);
       return err;
     }
-    fdb_doc_free(doc);
   } while (fdb_iterator_next(it) != FDB_RESULT_ITERATOR_FAIL);
   fdb_iterator_close(it);
 
@@ -660,11 +865,12 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
@@ -44,12 +44,16 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual std::string GetCurrentDBName() const override;
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
   common::Error ConfigGetDatabases(std::vector<std::string>* dbs) WARN_UNUSED_RESULT;
+  common::Error Commit() WARN_UNUSED_RESULT;  // also flushes WAL in bulk load mode
+  // should be called periodically between commands: commits pending mutations older than commit interval,
+  // compacts file after commits when stale data exceeds limit
+  common::Error Maintenance() WARN_UNUSED_RESULT;
 
  private:
   common::Error CheckResultCommand(const std::string& cmd, fdb_status err) WARN_UNUSED_RESULT;
 
   common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
   common::Error DelInner(key_t key) WARN_UNUSED_RESULT;
 
   virtual common::Error ScanImpl(uint64_t cursor_in,
@@ -67,7 +71,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error RemoveDBImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
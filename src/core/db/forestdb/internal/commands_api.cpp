@@ -57,6 +57,20 @@ common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
+common::Error CommandsApi::Commit(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  UNUSED(argv);
+  DBConnection* mdb = static_cast<DBConnection*>(handler);
+  common::Error err = mdb->Commit();
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue("OK");
+  FastoObject* child = new FastoObject(out, val, mdb->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
 }  // namespace forestdb
 }  // namespace core
 }  // namespace fastonosql
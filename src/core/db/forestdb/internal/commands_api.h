@@ -20,6 +20,8 @@
 
 #include "core/internal/commands_api.h"
 
+#define FORESTDB_COMMIT_COMMAND "COMMIT"
+
 namespace fastonosql {
 namespace core {
 namespace forestdb {
@@ -28,6 +30,7 @@ class DBConnection;
 struct CommandsApi : public internal::ApiTraits<DBConnection> {
   static common::Error Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error Commit(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
 };
 
 }  // namespace forestdb
@@ -31,7 +31,14 @@ namespace {
 
 const std::vector<Field> forestdb_common_fields = {
     Field(FORESTDB_DB_FILE_PATH_LABEL, common::Value::TYPE_STRING),
-    Field(FORESTDB_DB_FILE_SIZE_LABEL, common::Value::TYPE_ULONG_INTEGER)};
+    Field(FORESTDB_DB_FILE_SIZE_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_MUTATIONS_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_MUTATIONS_PER_SEC_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_COMMITS_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_COMMIT_AVG_USEC_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_COMMIT_MAX_USEC_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_COMPACTIONS_LABEL, common::Value::TYPE_ULONG_INTEGER),
+    Field(FORESTDB_STALE_DATA_PERCENT_LABEL, common::Value::TYPE_UINTEGER)};
 
 }  // namespace
 
@@ -47,9 +54,18 @@ std::vector<info_field_t> DBTraits<FORESTDB>::GetInfoFields() {
 }
 namespace forestdb {
 
-ServerInfo::Stats::Stats() : db_path(), db_size() {}
-
-ServerInfo::Stats::Stats(const std::string& common_text) {
+ServerInfo::Stats::Stats()
+    : db_path(),
+      db_size(),
+      mutations(),
+      mutations_per_sec(),
+      commits(),
+      commit_avg_usec(),
+      commit_max_usec(),
+      compactions(),
+      stale_data_percent() {}
+
+ServerInfo::Stats::Stats(const std::string& common_text) : Stats() {
   size_t pos = 0;
   size_t start = 0;
 
@@ -65,6 +81,41 @@ ServerInfo::Stats::Stats(const std::string& common_text) {
       if (common::ConvertFromString(value, &sz)) {
         db_size = sz;
       }
+    } else if (field == FORESTDB_MUTATIONS_LABEL) {
+      uint64_t mut;
+      if (common::ConvertFromString(value, &mut)) {
+        mutations = mut;
+      }
+    } else if (field == FORESTDB_MUTATIONS_PER_SEC_LABEL) {
+      uint64_t mps;
+      if (common::ConvertFromString(value, &mps)) {
+        mutations_per_sec = mps;
+      }
+    } else if (field == FORESTDB_COMMITS_LABEL) {
+      uint64_t com;
+      if (common::ConvertFromString(value, &com)) {
+        commits = com;
+      }
+    } else if (field == FORESTDB_COMMIT_AVG_USEC_LABEL) {
+      uint64_t avg;
+      if (common::ConvertFromString(value, &avg)) {
+        commit_avg_usec = avg;
+      }
+    } else if (field == FORESTDB_COMMIT_MAX_USEC_LABEL) {
+      uint64_t max;
+      if (common::ConvertFromString(value, &max)) {
+        commit_max_usec = max;
+      }
+    } else if (field == FORESTDB_COMPACTIONS_LABEL) {
+      uint64_t comp;
+      if (common::ConvertFromString(value, &comp)) {
+        compactions = comp;
+      }
+    } else if (field == FORESTDB_STALE_DATA_PERCENT_LABEL) {
+      uint32_t stale;
+      if (common::ConvertFromString(value, &stale)) {
+        stale_data_percent = stale;
+      }
     }
     start = pos + 2;
   }
@@ -76,6 +127,20 @@ common::Value* ServerInfo::Stats::GetValueByIndex(unsigned char index) const {
       return new common::StringValue(db_path);
     case 1:
       return new common::FundamentalValue(db_size);
+    case 2:
+      return new common::FundamentalValue(mutations);
+    case 3:
+      return new common::FundamentalValue(mutations_per_sec);
+    case 4:
+      return new common::FundamentalValue(commits);
+    case 5:
+      return new common::FundamentalValue(commit_avg_usec);
+    case 6:
+      return new common::FundamentalValue(commit_max_usec);
+    case 7:
+      return new common::FundamentalValue(compactions);
+    case 8:
+      return new common::FundamentalValue(stale_data_percent);
     default:
       break;
   }
@@ -104,7 +169,12 @@ common::Value* ServerInfo::GetValueByIndexes(unsigned char property, unsigned ch
 
 std::ostream& operator<<(std::ostream& out, const ServerInfo::Stats& value) {
   return out << FORESTDB_DB_FILE_PATH_LABEL ":" << value.db_path << MARKER << FORESTDB_DB_FILE_SIZE_LABEL ":"
-             << value.db_size << MARKER;
+             << value.db_size << MARKER << FORESTDB_MUTATIONS_LABEL ":" << value.mutations << MARKER
+             << FORESTDB_MUTATIONS_PER_SEC_LABEL ":" << value.mutations_per_sec << MARKER << FORESTDB_COMMITS_LABEL ":"
+             << value.commits << MARKER << FORESTDB_COMMIT_AVG_USEC_LABEL ":" << value.commit_avg_usec << MARKER
+             << FORESTDB_COMMIT_MAX_USEC_LABEL ":" << value.commit_max_usec << MARKER << FORESTDB_COMPACTIONS_LABEL ":"
+             << value.compactions << MARKER << FORESTDB_STALE_DATA_PERCENT_LABEL ":" << value.stale_data_percent
+             << MARKER;
 }
 
 std::ostream& operator<<(std::ostream& out, const ServerInfo& value) {
@@ -24,6 +24,13 @@
 
 #define FORESTDB_DB_FILE_PATH_LABEL "db_path"
 #define FORESTDB_DB_FILE_SIZE_LABEL "db_size"
+#define FORESTDB_MUTATIONS_LABEL "mutations"
+#define FORESTDB_MUTATIONS_PER_SEC_LABEL "mutations_per_sec"
+#define FORESTDB_COMMITS_LABEL "commits"
+#define FORESTDB_COMMIT_AVG_USEC_LABEL "commit_avg_usec"
+#define FORESTDB_COMMIT_MAX_USEC_LABEL "commit_max_usec"
+#define FORESTDB_COMPACTIONS_LABEL "compactions"
+#define FORESTDB_STALE_DATA_PERCENT_LABEL "stale_data_percent"
 
 namespace fastonosql {
 namespace core {
@@ -40,6 +47,13 @@ class ServerInfo : public IServerInfo {
 
     std::string db_path;
     off_t db_size;
+    uint64_t mutations;
+    uint64_t mutations_per_sec;
+    uint64_t commits;
+    uint64_t commit_avg_usec;
+    uint64_t commit_max_usec;
+    uint64_t compactions;
+    uint32_t stale_data_percent;
   } stats_;
 
   ServerInfo();
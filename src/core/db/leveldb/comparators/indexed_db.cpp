@@ -897,6 +897,63 @@ void IndexedDB::FindShortSuccessor(std::string* key) const {
   UNUSED(key);
 }
 
+IndexedDBKeyPrefix::IndexedDBKeyPrefix()
+    : database_id(detail::KeyPrefix::kInvalidId),
+      object_store_id(detail::KeyPrefix::kInvalidId),
+      index_id(detail::KeyPrefix::kInvalidId) {}
+
+IndexedDBKeyPrefix::IndexedDBKeyPrefix(int64_t database_id, int64_t object_store_id, int64_t index_id)
+    : database_id(database_id), object_store_id(object_store_id), index_id(index_id) {}
+
+bool IndexedDBKeyPrefix::IsObjectStoreData() const {
+  return database_id && object_store_id && index_id == kObjectStoreDataIndexId;
+}
+
+bool IndexedDBKeyPrefix::IsSameObjectStore(const IndexedDBKeyPrefix& other) const {
+  return database_id == other.database_id && object_store_id == other.object_store_id;
+}
+
+bool DecodeKeyPrefix(const ::leveldb::Slice& key, IndexedDBKeyPrefix* prefix) {
+  if (!prefix) {
+    return false;
+  }
+
+  common::StringPiece slice(key.data(), key.size());
+  detail::KeyPrefix decoded;
+  if (!detail::KeyPrefix::Decode(&slice, &decoded)) {
+    return false;
+  }
+
+  *prefix = IndexedDBKeyPrefix(decoded.database_id_, decoded.object_store_id_, decoded.index_id_);
+  return true;
+}
+
+std::string EncodeKeyPrefix(const IndexedDBKeyPrefix& prefix) {
+  std::string database_id_string;
+  std::string object_store_id_string;
+  std::string index_id_string;
+  EncodeInt(prefix.database_id, &database_id_string);
+  EncodeInt(prefix.object_store_id, &object_store_id_string);
+  EncodeInt(prefix.index_id, &index_id_string);
+  DCHECK(database_id_string.size() <= detail::KeyPrefix::kMaxDatabaseIdSizeBytes);
+  DCHECK(object_store_id_string.size() <= detail::KeyPrefix::kMaxObjectStoreIdSizeBytes);
+  DCHECK(index_id_string.size() <= detail::KeyPrefix::kMaxIndexIdSizeBytes);
+
+  // sizes of the ids minus one packed as 3/3/2 bits, ids follow
+  const unsigned char first_byte =
+      static_cast<unsigned char>((database_id_string.size() - 1) << (detail::KeyPrefix::kMaxObjectStoreIdSizeBits +
+                                                                      detail::KeyPrefix::kMaxIndexIdSizeBits) |
+                                 (object_store_id_string.size() - 1) << detail::KeyPrefix::kMaxIndexIdSizeBits |
+                                 (index_id_string.size() - 1));
+  std::string ret;
+  ret.reserve(1 + database_id_string.size() + object_store_id_string.size() + index_id_string.size());
+  ret.push_back(static_cast<char>(first_byte));
+  ret.append(database_id_string);
+  ret.append(object_store_id_string);
+  ret.append(index_id_string);
+  return ret;
+}
+
 }  // namespace comparator
 }  // namespace leveldb
 }  // namespace core
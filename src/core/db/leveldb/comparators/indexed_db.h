@@ -18,7 +18,12 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include <string>
+
 #include <leveldb/comparator.h>
+#include <leveldb/slice.h>
 
 namespace fastonosql {
 namespace core {
@@ -36,6 +41,24 @@ class IndexedDB : public ::leveldb::Comparator {
   virtual void FindShortSuccessor(std::string* key) const override;
 };
 
+// (database_id, object_store_id, index_id) triple every indexeddb key starts with
+struct IndexedDBKeyPrefix {
+  IndexedDBKeyPrefix();
+  IndexedDBKeyPrefix(int64_t database_id, int64_t object_store_id, int64_t index_id);
+
+  // record of an object store, other store keys are index or blob entries
+  bool IsObjectStoreData() const;
+  bool IsSameObjectStore(const IndexedDBKeyPrefix& other) const;
+
+  int64_t database_id;
+  int64_t object_store_id;
+  int64_t index_id;
+};
+
+bool DecodeKeyPrefix(const ::leveldb::Slice& key, IndexedDBKeyPrefix* prefix);
+// smallest key of the prefix range in idb_cmp1 order, usable as a seek target
+std::string EncodeKeyPrefix(const IndexedDBKeyPrefix& prefix);
+
 }  // namespace comparator
 }  // namespace leveldb
 }  // namespace core
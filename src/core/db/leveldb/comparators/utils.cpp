@@ -82,6 +82,16 @@ int CompareInts(int64_t a, int64_t b) {
   return 0;
 }
 
+void EncodeInt(int64_t value, std::string* into) {
+  // little endian, as few bytes as possible but at least one
+  DCHECK_GE(value, 0);
+  uint64_t n = static_cast<uint64_t>(value);
+  do {
+    into->push_back(static_cast<char>(n & 0xff));
+    n >>= 8;
+  } while (n);
+}
+
 bool DecodeByte(common::StringPiece* slice, unsigned char* value) {
   if (slice->empty())
     return false;
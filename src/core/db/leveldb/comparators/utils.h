@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <common/string_piece.h>
 
 namespace fastonosql {
@@ -29,6 +31,8 @@ int CompareSizes(size_t a, size_t b);
 
 int CompareInts(int64_t a, int64_t b);
 
+void EncodeInt(int64_t value, std::string* into);
+
 bool DecodeByte(common::StringPiece* slice, unsigned char* value);
 
 bool DecodeVarInt(common::StringPiece* slice, int64_t* value);
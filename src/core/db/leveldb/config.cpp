@@ -22,6 +22,7 @@ extern "C" {
 #include "sds.h"
 }
 
+#include <common/convert2string.h>
 #include <common/file_system/types.h>  // for prepare_path
 #include <common/sprintf.h>            // for MemSPrintf
 
@@ -34,6 +35,7 @@ namespace core {
 namespace leveldb {
 
 const std::vector<const char*> g_comparator_types = {"BYTEWISE", "INDEXED_DB"};
+const std::vector<const char*> g_tuning_profiles = {"DEFAULT", "BROWSE_READONLY", "BULK_LOAD", "POINT_LOOKUP"};
 
 namespace {
 
@@ -53,6 +55,33 @@ Config ParseOptions(int argc, char** argv) {
       if (common::ConvertFromString(argv[++i], &lcomparator)) {
         cfg.comparator = lcomparator;
       }
+    } else if (!strcmp(argv[i], "-p") && !lastarg) {
+      TuningProfile lprofile;
+      if (common::ConvertFromString(argv[++i], &lprofile)) {
+        cfg.ApplyProfile(lprofile);
+      }
+    } else if (!strcmp(argv[i], "-cache") && !lastarg) {
+      unsigned int block_cache_mb;
+      if (common::ConvertFromString(argv[++i], &block_cache_mb)) {
+        cfg.block_cache_mb = block_cache_mb;
+      }
+    } else if (!strcmp(argv[i], "-wb") && !lastarg) {
+      unsigned int write_buffer_mb;
+      if (common::ConvertFromString(argv[++i], &write_buffer_mb)) {
+        cfg.write_buffer_mb = write_buffer_mb;
+      }
+    } else if (!strcmp(argv[i], "-mof") && !lastarg) {
+      int max_open_files;
+      if (common::ConvertFromString(argv[++i], &max_open_files)) {
+        cfg.max_open_files = max_open_files;
+      }
+    } else if (!strcmp(argv[i], "-bloom") && !lastarg) {
+      unsigned int bloom_bits_per_key;
+      if (common::ConvertFromString(argv[++i], &bloom_bits_per_key)) {
+        cfg.bloom_bits_per_key = bloom_bits_per_key;
+      }
+    } else if (!strcmp(argv[i], "-nocomp")) {
+      cfg.compression = false;
     } else {
       if (argv[i][0] == '-') {
         std::string buff = common::MemSPrintf(
@@ -75,7 +104,36 @@ Config ParseOptions(int argc, char** argv) {
 Config::Config()
     : LocalConfig(common::file_system::prepare_path("~/test.leveldb")),
       create_if_missing(true),
-      comparator(COMP_BYTEWISE) {}
+      comparator(COMP_BYTEWISE),
+      profile(PROFILE_DEFAULT),
+      block_cache_mb(default_block_cache_mb),
+      write_buffer_mb(default_write_buffer_mb),
+      max_open_files(default_max_open_files),
+      bloom_bits_per_key(default_bloom_bits_per_key),
+      compression(true) {}
+
+void Config::ApplyProfile(TuningProfile prof) {
+  profile = prof;
+  block_cache_mb = default_block_cache_mb;
+  write_buffer_mb = default_write_buffer_mb;
+  max_open_files = default_max_open_files;
+  bloom_bits_per_key = default_bloom_bits_per_key;
+  compression = true;
+
+  if (prof == PROFILE_BROWSE_READONLY) {
+    // bigger cache for repeated pages, fewer descriptors held by the gui process
+    block_cache_mb = 64;
+    max_open_files = 256;
+    bloom_bits_per_key = 10;
+  } else if (prof == PROFILE_BULK_LOAD) {
+    // large memtable means fewer level-0 files and compactions during import
+    write_buffer_mb = 64;
+  } else if (prof == PROFILE_POINT_LOOKUP) {
+    block_cache_mb = 256;
+    max_open_files = 5000;
+    bloom_bits_per_key = 10;
+  }
+}
 
 }  // namespace leveldb
 }  // namespace core
@@ -92,6 +150,20 @@ std::string ConvertToString(const fastonosql::core::leveldb::Config& conf) {
 
   argv.push_back("-comp");
   argv.push_back(common::ConvertToString(conf.comparator));
+
+  argv.push_back("-p");
+  argv.push_back(common::ConvertToString(conf.profile));
+  argv.push_back("-cache");
+  argv.push_back(common::ConvertToString(conf.block_cache_mb));
+  argv.push_back("-wb");
+  argv.push_back(common::ConvertToString(conf.write_buffer_mb));
+  argv.push_back("-mof");
+  argv.push_back(common::ConvertToString(conf.max_open_files));
+  argv.push_back("-bloom");
+  argv.push_back(common::ConvertToString(conf.bloom_bits_per_key));
+  if (!conf.compression) {
+    argv.push_back("-nocomp");
+  }
   return fastonosql::core::ConvertToStringConfigArgs(argv);
 }
 
@@ -131,4 +203,24 @@ bool ConvertFromString(const std::string& from, fastonosql::core::leveldb::Compa
   return false;
 }
 
+std::string ConvertToString(fastonosql::core::leveldb::TuningProfile prof) {
+  return fastonosql::core::leveldb::g_tuning_profiles[prof];
+}
+
+bool ConvertFromString(const std::string& from, fastonosql::core::leveldb::TuningProfile* out) {
+  if (!out || from.empty()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < fastonosql::core::leveldb::g_tuning_profiles.size(); ++i) {
+    if (from == fastonosql::core::leveldb::g_tuning_profiles[i]) {
+      *out = static_cast<fastonosql::core::leveldb::TuningProfile>(i);
+      return true;
+    }
+  }
+
+  NOTREACHED();
+  return false;
+}
+
 }  // namespace common
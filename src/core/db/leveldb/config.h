@@ -27,11 +27,30 @@ namespace leveldb {
 enum ComparatorType { COMP_BYTEWISE = 0, COMP_INDEXED_DB };
 extern const std::vector<const char*> g_comparator_types;
 
+enum TuningProfile { PROFILE_DEFAULT = 0, PROFILE_BROWSE_READONLY, PROFILE_BULK_LOAD, PROFILE_POINT_LOOKUP };
+extern const std::vector<const char*> g_tuning_profiles;
+
 struct Config : public LocalConfig {
+  enum {
+    default_block_cache_mb = 8,
+    default_write_buffer_mb = 4,
+    default_max_open_files = 1000,
+    default_bloom_bits_per_key = 0
+  };
   Config();
 
+  // overwrites tuning fields with profile values
+  void ApplyProfile(TuningProfile prof);
+
   bool create_if_missing;
   ComparatorType comparator;
+
+  TuningProfile profile;
+  unsigned int block_cache_mb;      // shared between connections with equal size
+  unsigned int write_buffer_mb;
+  int max_open_files;
+  unsigned int bloom_bits_per_key;  // 0 - without filter
+  bool compression;                 // snappy
 };
 
 }  // namespace leveldb
@@ -44,4 +63,7 @@ bool ConvertFromString(const std::string& from, fastonosql::core::leveldb::Confi
 
 std::string ConvertToString(fastonosql::core::leveldb::ComparatorType comp);
 bool ConvertFromString(const std::string& from, fastonosql::core::leveldb::ComparatorType* out);
+
+std::string ConvertToString(fastonosql::core::leveldb::TuningProfile prof);
+bool ConvertFromString(const std::string& from, fastonosql::core::leveldb::TuningProfile* out);
 }  // namespace common
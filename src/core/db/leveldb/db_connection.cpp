@@ -18,8 +18,14 @@
 
 #include "core/db/leveldb/db_connection.h"
 
+#include <map>
+#include <mutex>
+
 #include <leveldb/c.h>  // for leveldb_major_version, etc
+#include <leveldb/cache.h>
 #include <leveldb/db.h>
+#include <leveldb/filter_policy.h>
+#include <leveldb/write_batch.h>
 
 #include <common/convert2string.h>
 #include <common/file_system/string_path_utils.h>
@@ -28,6 +34,7 @@
 #include "core/db/leveldb/comparators/indexed_db.h"
 #include "core/db/leveldb/database_info.h"
 #include "core/db/leveldb/internal/commands_api.h"
+#include "core/key_pattern.h"
 
 #define LEVELDB_HEADER_STATS                             \
   "                               Compactions\n"         \
@@ -56,6 +63,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         1,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Info),
+                                          CommandHolder(LEVELDB_IDBSTORES_COMMAND,
+                                                        "-",
+                                                        "Records count and sizes of every object store, "
+                                                        "requires IndexedDB comparator",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::IndexedDBStores),
+                                          CommandHolder(LEVELDB_IDBKEYS_COMMAND,
+                                                        "<database_id> <object_store_id> <limit>",
+                                                        "Keys of the object store records, "
+                                                        "requires IndexedDB comparator",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        3,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::IndexedDBKeys),
                                           CommandHolder(DB_SCAN_COMMAND,
                                                         "<cursor> [MATCH pattern] [COUNT count]",
                                                         "Incrementally iterate the keys space",
@@ -139,6 +166,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         INFINITE_COMMAND_ARGS,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Delete),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -148,6 +195,13 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         0,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Quit)};
+
+// scans touch every block, keep them out of the block cache
+::leveldb::ReadOptions MakeKeysOnlyReadOptions() {
+  ::leveldb::ReadOptions ro;
+  ro.fill_cache = false;
+  return ro;
+}
 }
 }  // namespace leveldb
 template <>
@@ -198,6 +252,32 @@ const ConstantCommandsArray& CDBConnection<leveldb::NativeConnection, leveldb::C
 }
 }  // namespace internal
 namespace leveldb {
+namespace {
+
+// caches and filters must outlive every db opened with them, so they live until exit
+::leveldb::Cache* GetSharedBlockCache(unsigned int size_mb) {
+  static std::mutex caches_lock;
+  static std::map<unsigned int, ::leveldb::Cache*> caches;
+  std::lock_guard<std::mutex> lock(caches_lock);
+  ::leveldb::Cache*& cache = caches[size_mb];
+  if (!cache) {
+    cache = ::leveldb::NewLRUCache(static_cast<size_t>(size_mb) * 1024 * 1024);
+  }
+  return cache;
+}
+
+const ::leveldb::FilterPolicy* GetBloomFilterPolicy(unsigned int bits_per_key) {
+  static std::mutex filters_lock;
+  static std::map<unsigned int, const ::leveldb::FilterPolicy*> filters;
+  std::lock_guard<std::mutex> lock(filters_lock);
+  const ::leveldb::FilterPolicy*& filter = filters[bits_per_key];
+  if (!filter) {
+    filter = ::leveldb::NewBloomFilterPolicy(bits_per_key);
+  }
+  return filter;
+}
+
+}  // namespace
 
 common::Error CreateConnection(const Config& config, NativeConnection** context) {
   if (!context) {
@@ -219,6 +299,19 @@ common::Error CreateConnection(const Config& config, NativeConnection** context)
   } else if (config.comparator == COMP_INDEXED_DB) {
     lv.comparator = new comparator::IndexedDB;
   }
+  if (config.block_cache_mb) {
+    lv.block_cache = GetSharedBlockCache(config.block_cache_mb);
+  }
+  if (config.write_buffer_mb) {
+    lv.write_buffer_size = static_cast<size_t>(config.write_buffer_mb) * 1024 * 1024;
+  }
+  if (config.max_open_files > 0) {
+    lv.max_open_files = config.max_open_files;
+  }
+  if (config.bloom_bits_per_key) {
+    lv.filter_policy = GetBloomFilterPolicy(config.bloom_bits_per_key);
+  }
+  lv.compression = config.compression ? ::leveldb::kSnappyCompression : ::leveldb::kNoCompression;
   auto st = ::leveldb::DB::Open(lv, folder, &lcontext);
   if (!st.ok()) {
     std::string buff = common::MemSPrintf("Fail connect to server: %s!", st.ToString());
@@ -240,6 +333,12 @@ common::Error TestConnection(const Config& config) {
   return common::Error();
 }
 
+IndexedDBObjectStore::IndexedDBObjectStore()
+    : database_id(0), object_store_id(0), records(0), data_size(0), index_size(0) {}
+
+IndexedDBObjectStore::IndexedDBObjectStore(int64_t database_id, int64_t object_store_id)
+    : database_id(database_id), object_store_id(object_store_id), records(0), data_size(0), index_size(0) {}
+
 DBConnection::DBConnection(CDBConnectionClient* client)
     : base_class(client, new CommandTranslator(base_class::GetCommands())) {}
 
@@ -315,6 +414,116 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   return common::Error();
 }
 
+common::Error DBConnection::IndexedDBObjectStores(std::vector<IndexedDBObjectStore>* stores) {
+  if (!stores) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  err = TestIsIndexedDB(LEVELDB_IDBSTORES_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  // idb_cmp1 orders keys by prefix ids, so keys of one store are contiguous
+  // and a single walk builds the whole summary
+  std::vector<IndexedDBObjectStore> lstores;
+  ::leveldb::ReadOptions ro = MakeKeysOnlyReadOptions();
+  ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    const ::leveldb::Slice key = it->key();
+    comparator::IndexedDBKeyPrefix prefix;
+    if (!comparator::DecodeKeyPrefix(key, &prefix) || !prefix.database_id || !prefix.object_store_id) {
+      continue;  // global and database metadata
+    }
+
+    if (lstores.empty() || lstores.back().database_id != prefix.database_id ||
+        lstores.back().object_store_id != prefix.object_store_id) {
+      lstores.push_back(IndexedDBObjectStore(prefix.database_id, prefix.object_store_id));
+    }
+
+    IndexedDBObjectStore& store = lstores.back();
+    const uint64_t entry_size = key.size() + it->value().size();
+    if (prefix.IsObjectStoreData()) {
+      store.records++;
+      store.data_size += entry_size;
+    } else {
+      store.index_size += entry_size;
+    }
+  }
+
+  auto st = it->status();
+  delete it;
+
+  err = CheckResultCommand(LEVELDB_IDBSTORES_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  *stores = lstores;
+  return common::Error();
+}
+
+common::Error DBConnection::IndexedDBKeys(int64_t database_id,
+                                          int64_t object_store_id,
+                                          uint64_t limit,
+                                          std::vector<std::string>* ret) {
+  if (!ret || database_id <= 0 || object_store_id <= 0) {
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  err = TestIsIndexedDB(LEVELDB_IDBKEYS_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  // prefix alone sorts before every record of the store, so the walk touches only its range
+  const comparator::IndexedDBKeyPrefix store_prefix(database_id, object_store_id, 1);
+  std::vector<std::string> lkeys;
+  ::leveldb::ReadOptions ro = MakeKeysOnlyReadOptions();
+  ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
+  for (it->Seek(comparator::EncodeKeyPrefix(store_prefix)); it->Valid() && lkeys.size() < limit; it->Next()) {
+    const ::leveldb::Slice key = it->key();
+    comparator::IndexedDBKeyPrefix prefix;
+    if (!comparator::DecodeKeyPrefix(key, &prefix) || !prefix.IsSameObjectStore(store_prefix) ||
+        !prefix.IsObjectStoreData()) {
+      break;
+    }
+
+    lkeys.push_back(key.ToString());
+  }
+
+  auto st = it->status();
+  delete it;
+
+  err = CheckResultCommand(LEVELDB_IDBKEYS_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  *ret = lkeys;
+  return common::Error();
+}
+
+common::Error DBConnection::TestIsIndexedDB(const std::string& cmd) {
+  auto conf = GetConfig();
+  if (conf->comparator != COMP_INDEXED_DB) {
+    return GenerateError(cmd, "Database is not opened with IndexedDB comparator");
+  }
+
+  return common::Error();
+}
+
 common::Error DBConnection::DelInner(key_t key) {
   std::string exist_key;
   common::Error err = GetInner(key, &exist_key);
@@ -335,11 +544,16 @@ common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   return CheckResultCommand(DB_SET_KEY_COMMAND, connection_.handle_->Put(wo, key_slice, value));
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   const string_key_t key_str = key.GetKeyData();
   const ::leveldb::Slice key_slice(key_str.data(), key_str.size());
   ::leveldb::ReadOptions ro;
-  return CheckResultCommand(DB_GET_KEY_COMMAND, connection_.handle_->Get(ro, key_slice, ret_val));
+  const ::leveldb::Status st = connection_.handle_->Get(ro, key_slice, ret_val);
+  if (st.IsNotFound()) {
+    return KeyNotFound(found);
+  }
+
+  return CheckResultCommand(DB_GET_KEY_COMMAND, st);
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -347,17 +561,30 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t count_keys,
                                      std::vector<std::string>* keys_out,
                                      uint64_t* cursor_out) {
-  ::leveldb::ReadOptions ro;
+  const KeyPattern matcher(pattern);
+  const bool match_all = matcher.IsMatchAll();  // no per key matching for "*"
+  auto conf = GetConfig();
+  const bool prefix_seek = conf->comparator == COMP_BYTEWISE;  // prefix range needs bytewise order
+  ::leveldb::ReadOptions ro = MakeKeysOnlyReadOptions();
   ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
   uint64_t offset_pos = cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
+  if (prefix_seek) {
+    it->Seek(matcher.GetPrefix());
+  } else {
+    it->SeekToFirst();
+  }
+  for (; it->Valid(); it->Next()) {
+    const ::leveldb::Slice key = it->key();
+    if (prefix_seek && !matcher.IsPrefixOf(key.data(), key.size())) {
+      break;
+    }
+
     if (lkeys_out.size() < count_keys) {
-      if (common::MatchPattern(key, pattern)) {
+      if (match_all || matcher.Match(key.data(), key.size())) {
         if (offset_pos == 0) {
-          lkeys_out.push_back(key);
+          lkeys_out.push_back(key.ToString());
         } else {
           offset_pos--;
         }
@@ -388,7 +615,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
   std::string skey_start = common::ConvertToString(key_start);
   std::string skey_end = common::ConvertToString(key_end);
 
-  ::leveldb::ReadOptions ro;
+  ::leveldb::ReadOptions ro = MakeKeysOnlyReadOptions();
   ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);  // keys(key_start, key_end, limit, ret);
   for (it->Seek(skey_start); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
@@ -408,7 +635,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  ::leveldb::ReadOptions ro;
+  ::leveldb::ReadOptions ro = MakeKeysOnlyReadOptions();
   ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
   size_t sz = 0;
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
@@ -428,7 +655,7 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
 }
 
 common::Error DBConnection::FlushDBImpl() {
-  ::leveldb::ReadOptions ro;
+  ::leveldb::ReadOptions ro = MakeKeysOnlyReadOptions();
   ::leveldb::WriteOptions wo;
   ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
@@ -486,11 +713,24 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::StoreKeysImpl(const std::vector<NDbKValue>& keys) {
+  ::leveldb::WriteBatch batch;  // whole dump block in one write
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const string_key_t key_str = keys[i].GetKey().GetKey().GetKeyData();
+    const ::leveldb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
+    batch.Put(key_slice, keys[i].GetValueString());
+  }
+
+  ::leveldb::WriteOptions wo;
+  return CheckResultCommand(DB_IMPORT_COMMAND, connection_.handle_->Write(wo, &batch));
+}
+
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
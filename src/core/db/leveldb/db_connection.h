@@ -34,6 +34,18 @@ namespace leveldb {
 
 typedef ::leveldb::DB NativeConnection;
 
+// totals of one object store of an indexeddb backing store
+struct IndexedDBObjectStore {
+  IndexedDBObjectStore();
+  IndexedDBObjectStore(int64_t database_id, int64_t object_store_id);
+
+  int64_t database_id;
+  int64_t object_store_id;
+  uint64_t records;
+  uint64_t data_size;   // keys and values of records
+  uint64_t index_size;  // keys and values of indexes, exists and blob entries
+};
+
 common::Error CreateConnection(const Config& config, NativeConnection** context);
 common::Error TestConnection(const Config& config);
 
@@ -43,13 +55,19 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   explicit DBConnection(CDBConnectionClient* client);
 
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
+  common::Error IndexedDBObjectStores(std::vector<IndexedDBObjectStore>* stores) WARN_UNUSED_RESULT;
+  common::Error IndexedDBKeys(int64_t database_id,
+                              int64_t object_store_id,
+                              uint64_t limit,
+                              std::vector<std::string>* ret) WARN_UNUSED_RESULT;
 
  private:
+  common::Error TestIsIndexedDB(const std::string& cmd) WARN_UNUSED_RESULT;
   common::Error CheckResultCommand(const std::string& cmd, const ::leveldb::Status& err) WARN_UNUSED_RESULT;
 
   common::Error DelInner(key_t key) WARN_UNUSED_RESULT;
   common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
 
   virtual common::Error ScanImpl(uint64_t cursor_in,
                                  const std::string& pattern,
@@ -65,9 +83,10 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
+  virtual common::Error StoreKeysImpl(const std::vector<NDbKValue>& keys) override;
 };
 
 }  // namespace leveldb
@@ -18,6 +18,8 @@
 
 #include "core/db/leveldb/internal/commands_api.h"
 
+#include <common/convert2string.h>
+
 #include "core/db/leveldb/db_connection.h"
 
 namespace fastonosql {
@@ -151,6 +153,66 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
+common::Error CommandsApi::IndexedDBStores(internal::CommandHandler* handler,
+                                           commands_args_t argv,
+                                           FastoObject* out) {
+  UNUSED(argv);
+  DBConnection* level = static_cast<DBConnection*>(handler);
+  std::vector<IndexedDBObjectStore> stores;
+  common::Error err = level->IndexedDBObjectStores(&stores);
+  if (err) {
+    return err;
+  }
+
+  for (size_t i = 0; i < stores.size(); ++i) {
+    const IndexedDBObjectStore& store = stores[i];
+    common::ArrayValue* arr = common::Value::CreateArrayValue();
+    arr->Append(common::Value::CreateStringValue("database_id"));
+    arr->Append(common::Value::CreateLongLongIntegerValue(store.database_id));
+    arr->Append(common::Value::CreateStringValue("object_store_id"));
+    arr->Append(common::Value::CreateLongLongIntegerValue(store.object_store_id));
+    arr->Append(common::Value::CreateStringValue("records"));
+    arr->Append(common::Value::CreateULongLongIntegerValue(store.records));
+    arr->Append(common::Value::CreateStringValue("data_size"));
+    arr->Append(common::Value::CreateULongLongIntegerValue(store.data_size));
+    arr->Append(common::Value::CreateStringValue("index_size"));
+    arr->Append(common::Value::CreateULongLongIntegerValue(store.index_size));
+    FastoObject* child = new FastoObject(out, arr, level->GetDelimiter());
+    out->AddChildren(child);
+  }
+  return common::Error();
+}
+
+common::Error CommandsApi::IndexedDBKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  DBConnection* level = static_cast<DBConnection*>(handler);
+  int64_t database_id;
+  if (!common::ConvertFromString(argv[0], &database_id)) {
+    return common::make_error_inval();
+  }
+
+  int64_t object_store_id;
+  if (!common::ConvertFromString(argv[1], &object_store_id)) {
+    return common::make_error_inval();
+  }
+
+  uint64_t limit;
+  if (!common::ConvertFromString(argv[2], &limit)) {
+    return common::make_error_inval();
+  }
+
+  std::vector<std::string> keys;
+  common::Error err = level->IndexedDBKeys(database_id, object_store_id, limit, &keys);
+  if (err) {
+    return err;
+  }
+
+  common::ArrayValue* arr = common::Value::CreateArrayValue();
+  arr->AppendStrings(keys);
+  FastoObject* child = new FastoObject(out, arr, level->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
 }  // namespace leveldb
 }  // namespace core
 }  // namespace fastonosql
@@ -20,6 +20,9 @@
 
 #include "core/internal/commands_api.h"
 
+#define LEVELDB_IDBSTORES_COMMAND "IDBSTORES"
+#define LEVELDB_IDBKEYS_COMMAND "IDBKEYS"
+
 namespace fastonosql {
 namespace core {
 namespace leveldb {
@@ -27,6 +30,8 @@ namespace leveldb {
 class DBConnection;
 struct CommandsApi : public internal::ApiTraits<DBConnection> {
   static common::Error Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error IndexedDBStores(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error IndexedDBKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
 };
 
 }  // namespace leveldb
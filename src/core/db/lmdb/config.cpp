@@ -54,6 +54,21 @@ Config ParseOptions(int argc, char** argv) {
       if (common::ConvertFromString(argv[++i], &max_dbs)) {
         cfg.max_dbs = max_dbs;
       }
+    } else if (!strcmp(argv[i], "-s") && !lastarg) {
+      unsigned int map_size_mb;
+      if (common::ConvertFromString(argv[++i], &map_size_mb)) {
+        cfg.map_size_mb = map_size_mb;
+      }
+    } else if (!strcmp(argv[i], "-g") && !lastarg) {
+      unsigned int map_growth_percent;
+      if (common::ConvertFromString(argv[++i], &map_growth_percent)) {
+        cfg.map_growth_percent = map_growth_percent;
+      }
+    } else if (!strcmp(argv[i], "-b") && !lastarg) {
+      unsigned int write_batch_size;
+      if (common::ConvertFromString(argv[++i], &write_batch_size)) {
+        cfg.write_batch_size = write_batch_size;
+      }
     } else if (!strcmp(argv[i], "-e") && !lastarg) {
       int env_flags;
       if (common::ConvertFromString(argv[++i], &env_flags)) {
@@ -84,7 +99,10 @@ Config::Config()
     : LocalConfig(common::file_system::prepare_path("~/test.lmdb")),
       env_flags(LMDB_DEFAULT_ENV_FLAGS),
       db_name(default_db_name),
-      max_dbs(default_dbs_count) {}
+      max_dbs(default_dbs_count),
+      map_size_mb(default_map_size_mb),
+      map_growth_percent(default_map_growth_percent),
+      write_batch_size(default_write_batch_size) {}
 
 bool Config::ReadOnlyDB() const {
   return env_flags & MDB_RDONLY;
@@ -110,6 +128,30 @@ void Config::SetReadOnlyDB(bool ro) {
   }
 }
 
+bool Config::IsNoTLS() const {
+  return env_flags & MDB_NOTLS;
+}
+
+void Config::SetNoTLS(bool no_tls) {
+  if (no_tls) {
+    env_flags |= MDB_NOTLS;
+  } else {
+    env_flags &= ~MDB_NOTLS;
+  }
+}
+
+bool Config::IsNoReadAhead() const {
+  return env_flags & MDB_NORDAHEAD;
+}
+
+void Config::SetNoReadAhead(bool no_read_ahead) {
+  if (no_read_ahead) {
+    env_flags |= MDB_NORDAHEAD;
+  } else {
+    env_flags &= ~MDB_NORDAHEAD;
+  }
+}
+
 }  // namespace lmdb
 }  // namespace core
 }  // namespace fastonosql
@@ -128,6 +170,12 @@ std::string ConvertToString(const fastonosql::core::lmdb::Config& conf) {
 
   argv.push_back("-m");
   argv.push_back(common::ConvertToString(conf.max_dbs));
+  argv.push_back("-s");
+  argv.push_back(common::ConvertToString(conf.map_size_mb));
+  argv.push_back("-g");
+  argv.push_back(common::ConvertToString(conf.map_growth_percent));
+  argv.push_back("-b");
+  argv.push_back(common::ConvertToString(conf.write_batch_size));
 
   return fastonosql::core::ConvertToStringConfigArgs(argv);
 }
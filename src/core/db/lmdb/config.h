@@ -26,7 +26,12 @@ namespace lmdb {
 
 struct Config : public LocalConfig {
   static const std::string default_db_name;
-  enum { default_dbs_count = 1024 };
+  enum {
+    default_dbs_count = 1024,
+    default_map_size_mb = 64,
+    default_map_growth_percent = 100,
+    default_write_batch_size = 1000
+  };
   Config();
 
   bool ReadOnlyDB() const;
@@ -35,9 +40,19 @@ struct Config : public LocalConfig {
   bool IsSingleFileDB() const;
   void SetSingleFileDB(bool single);
 
+  // MDB_NOTLS, MDB_NORDAHEAD for large random read workloads
+  bool IsNoTLS() const;
+  void SetNoTLS(bool no_tls);
+
+  bool IsNoReadAhead() const;
+  void SetNoReadAhead(bool no_read_ahead);
+
   int env_flags;
   std::string db_name;
   unsigned int max_dbs;
+  unsigned int map_size_mb;         // initial map size, 0 means lmdb default or size on disk
+  unsigned int map_growth_percent;  // growth of map size on MDB_MAP_FULL, 0 disables growth
+  unsigned int write_batch_size;    // keys per transaction for bulk writes (multi key DEL, FLUSHDB)
 };
 
 }  // namespace lmdb
@@ -18,11 +18,12 @@
 
 #include "core/db/lmdb/db_connection.h"
 
-#include <errno.h>   // for EACCES
-#include <lmdb.h>    // for mdb_txn_abort, MDB_val
-#include <stdlib.h>  // for NULL, free, calloc
-#include <time.h>    // for time_t
-#include <string>    // for string
+#include <errno.h>    // for EACCES
+#include <lmdb.h>     // for mdb_txn_abort, MDB_val
+#include <stdlib.h>   // for NULL, free, calloc
+#include <time.h>     // for time_t
+#include <algorithm>  // for min
+#include <string>     // for string
 
 #include <common/convert2string.h>
 #include <common/file_system/string_path_utils.h>
@@ -33,6 +34,7 @@
 #include "core/db/lmdb/config.h"  // for Config
 #include "core/db/lmdb/database_info.h"
 #include "core/db/lmdb/internal/commands_api.h"
+#include "core/key_pattern.h"
 
 #define LMDB_OK 0
 
@@ -177,6 +179,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         INFINITE_COMMAND_ARGS,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Delete),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -211,6 +233,8 @@ struct lmdb {
   MDB_env* env;
   MDB_dbi dbi;
   char* db_name;
+  MDB_txn* read_txn;        // pooled, reset between reads
+  MDB_cursor* read_cursor;  // bound to dbi, renewed with read_txn
 };
 
 namespace {
@@ -219,6 +243,119 @@ unsigned int lmdb_db_flag_from_env_flags(int env_flags) {
   return (env_flags & MDB_RDONLY) ? MDB_RDONLY : 0;
 }
 
+int lmdb_grow_map(MDB_env* env, unsigned int growth_percent) {
+  if (growth_percent == 0) {
+    return MDB_MAP_FULL;
+  }
+
+  MDB_envinfo info;
+  int rc = mdb_env_info(env, &info);
+  if (rc != LMDB_OK) {
+    return rc;
+  }
+
+  static const size_t align = 1 << 20;
+  size_t map_size = info.me_mapsize + info.me_mapsize / 100 * growth_percent;
+  map_size = (map_size + align - 1) / align * align;
+  return mdb_env_set_mapsize(env, map_size);
+}
+
+// runs write transaction, on MDB_MAP_FULL grows map and retries whole transaction
+template <typename Func>
+int lmdb_write_txn(MDB_env* env, int env_flags, unsigned int growth_percent, Func func) {
+  while (true) {
+    MDB_txn* txn = NULL;
+    int rc = mdb_txn_begin(env, NULL, lmdb_db_flag_from_env_flags(env_flags), &txn);
+    if (rc == MDB_MAP_RESIZED) {  // grown by other process
+      rc = mdb_env_set_mapsize(env, 0);
+      if (rc != LMDB_OK) {
+        return rc;
+      }
+      continue;
+    }
+    if (rc != LMDB_OK) {
+      return rc;
+    }
+
+    rc = func(txn);
+    if (rc == LMDB_OK) {
+      rc = mdb_txn_commit(txn);
+    } else {
+      mdb_txn_abort(txn);
+    }
+
+    if (rc != MDB_MAP_FULL) {
+      return rc;
+    }
+
+    rc = lmdb_grow_map(env, growth_percent);
+    if (rc != LMDB_OK) {
+      return rc;
+    }
+  }
+}
+
+// read transaction is renewed for every read and reset after it, cursor is reused
+int lmdb_read_begin(lmdb* context, MDB_txn** txn) {
+  if (context->read_txn) {
+    int rc = mdb_txn_renew(context->read_txn);
+    if (rc == LMDB_OK) {
+      *txn = context->read_txn;
+      return LMDB_OK;
+    }
+
+    mdb_txn_abort(context->read_txn);
+    context->read_txn = NULL;
+  }
+
+  int rc = mdb_txn_begin(context->env, NULL, MDB_RDONLY, &context->read_txn);
+  if (rc == MDB_MAP_RESIZED) {  // grown by other process
+    rc = mdb_env_set_mapsize(context->env, 0);
+    if (rc != LMDB_OK) {
+      return rc;
+    }
+    rc = mdb_txn_begin(context->env, NULL, MDB_RDONLY, &context->read_txn);
+  }
+
+  if (rc != LMDB_OK) {
+    context->read_txn = NULL;
+    return rc;
+  }
+
+  *txn = context->read_txn;
+  return LMDB_OK;
+}
+
+int lmdb_read_cursor(lmdb* context, MDB_cursor** cursor) {
+  int rc = context->read_cursor ? mdb_cursor_renew(context->read_txn, context->read_cursor)
+                                : mdb_cursor_open(context->read_txn, context->dbi, &context->read_cursor);
+  if (rc != LMDB_OK) {
+    return rc;
+  }
+
+  *cursor = context->read_cursor;
+  return LMDB_OK;
+}
+
+void lmdb_read_end(lmdb* context) {
+  if (context->read_txn) {
+    mdb_txn_reset(context->read_txn);
+  }
+}
+
+// should be called before dbi handle changes
+void lmdb_read_release(lmdb* context) {
+  if (context->read_cursor) {
+    mdb_cursor_close(context->read_cursor);
+    context->read_cursor = NULL;
+  }
+
+  if (context->read_txn) {
+    mdb_txn_abort(context->read_txn);
+    context->read_txn = NULL;
+  }
+}
+
 int lmdb_create_db(lmdb* context, const char* db_name, int env_flags) {
   if (!context || !db_name) {
     return EINVAL;
@@ -248,6 +385,7 @@ int lmdb_remove_db(lmdb* context, const char* db_name, int env_flags) {
     return EINVAL;
   }
 
+  lmdb_read_release(context);
   const unsigned int flg = lmdb_db_flag_from_env_flags(env_flags);
   MDB_dbi ldbi = 0;
   MDB_txn* txn = NULL;
@@ -301,6 +439,7 @@ int lmdb_select(lmdb* context, const char* db_name, int env_flags) {
   }
 
   // cleanup old ref
+  lmdb_read_release(context);
   common::utils::freeifnotnull(context->db_name);
   context->db_name = NULL;
   mdb_dbi_close(context->env, context->dbi);
@@ -312,7 +451,12 @@ int lmdb_select(lmdb* context, const char* db_name, int env_flags) {
   return LMDB_OK;
 }
 
-int lmdb_open(lmdb** context, const char* db_path, const char* db_name, int env_flags, MDB_dbi max_dbs) {
+int lmdb_open(lmdb** context,
+              const char* db_path,
+              const char* db_name,
+              int env_flags,
+              MDB_dbi max_dbs,
+              size_t map_size) {
   lmdb* lcontext = reinterpret_cast<lmdb*>(calloc(1, sizeof(lmdb)));
   int rc = mdb_env_create(&lcontext->env);
   if (rc != LMDB_OK) {
@@ -322,18 +466,34 @@ int lmdb_open(lmdb** context, const char* db_path, const char* db_name, int env_
 
   rc = mdb_env_set_maxdbs(lcontext->env, max_dbs);
   if (rc != LMDB_OK) {
+    mdb_env_close(lcontext->env);
     free(lcontext);
     return rc;
   }
 
+  if (map_size) {  // lmdb takes the bigger one of this and size on disk
+    rc = mdb_env_set_mapsize(lcontext->env, map_size);
+    if (rc != LMDB_OK) {
+      mdb_env_close(lcontext->env);
+      free(lcontext);
+      return rc;
+    }
+  }
+
   rc = mdb_env_open(lcontext->env, db_path, env_flags, 0664);
   if (rc != LMDB_OK) {
+    mdb_env_close(lcontext->env);
     free(lcontext);
     return rc;
   }
 
+  // release reader slots of crashed processes, otherwise they pin old pages
+  int dead_readers = 0;
+  mdb_reader_check(lcontext->env, &dead_readers);
+
   rc = lmdb_select(lcontext, db_name, env_flags);
   if (rc != LMDB_OK) {
+    mdb_env_close(lcontext->env);
     free(lcontext);
     return rc;
   }
@@ -352,6 +512,7 @@ void lmdb_close(lmdb** context) {
     return;
   }
 
+  lmdb_read_release(lcontext);
   common::utils::freeifnotnull(lcontext->db_name);
   lcontext->db_name = NULL;
   mdb_dbi_close(lcontext->env, lcontext->dbi);
@@ -443,8 +604,9 @@ common::Error CreateConnection(const Config& config, NativeConnection** context)
   const char* db_path_ptr = db_path.c_str();
   int env_flags = config.env_flags;
   unsigned int max_dbs = config.max_dbs;
+  size_t map_size = static_cast<size_t>(config.map_size_mb) * 1024 * 1024;
   const char* db_name_ptr = config.db_name.c_str();
-  int st = lmdb_open(&lcontext, db_path_ptr, db_name_ptr, env_flags, max_dbs);
+  int st = lmdb_open(&lcontext, db_path_ptr, db_name_ptr, env_flags, max_dbs, map_size);
   if (st != LMDB_OK) {
     std::string buff = common::MemSPrintf("Fail open database: %s", mdb_strerror(st));
     return common::make_error(buff);
@@ -560,6 +722,9 @@ common::Error DBConnection::DropDatabase() {
     return err;
   }
 
+  // cached read txn and cursor hold dbi which is dropped
+  lmdb_read_release(connection_.handle_);
+
   MDB_txn* txn = NULL;
   auto conf = GetConfig();
   int env_flags = conf->env_flags;
@@ -585,42 +750,38 @@ common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   mval.mv_size = value.size();
   mval.mv_data = const_cast<char*>(value.c_str());
 
-  MDB_txn* txn = NULL;
   auto conf = GetConfig();
-  int env_flags = conf->env_flags;
-  common::Error err = CheckResultCommand(
-      DB_SET_KEY_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, lmdb_db_flag_from_env_flags(env_flags), &txn));
-  if (err) {
-    return err;
-  }
-  err = CheckResultCommand(DB_SET_KEY_COMMAND, mdb_put(txn, connection_.handle_->dbi, &key_slice, &mval, 0));
-  if (err) {
-    mdb_txn_abort(txn);
-    return err;
-  }
-
-  return CheckResultCommand(DB_SET_KEY_COMMAND, mdb_txn_commit(txn));
+  MDB_dbi dbi = connection_.handle_->dbi;
+  int rc = lmdb_write_txn(connection_.handle_->env, conf->env_flags, conf->map_growth_percent,
+                          [dbi, &key_slice, &mval](MDB_txn* txn) { return mdb_put(txn, dbi, &key_slice, &mval, 0); });
+  return CheckResultCommand(DB_SET_KEY_COMMAND, rc);
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   const string_key_t key_str = key.GetKeyData();
   MDB_val key_slice = ConvertToLMDBSlice(key_str.data(), key_str.size());
   MDB_val mval;
 
   MDB_txn* txn = NULL;
-  common::Error err =
-      CheckResultCommand(DB_GET_KEY_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, MDB_RDONLY, &txn));
+  common::Error err = CheckResultCommand(DB_GET_KEY_COMMAND, lmdb_read_begin(connection_.handle_, &txn));
   if (err) {
     return err;
   }
 
-  err = CheckResultCommand(DB_GET_KEY_COMMAND, mdb_get(txn, connection_.handle_->dbi, &key_slice, &mval));
-  mdb_txn_abort(txn);
+  const int rc = mdb_get(txn, connection_.handle_->dbi, &key_slice, &mval);
+  if (rc == MDB_NOTFOUND) {
+    lmdb_read_end(connection_.handle_);
+    return KeyNotFound(found);
+  }
+
+  err = CheckResultCommand(DB_GET_KEY_COMMAND, rc);
   if (err) {
+    lmdb_read_end(connection_.handle_);
     return err;
   }
 
   *ret_val = std::string(reinterpret_cast<const char*>(mval.mv_data), mval.mv_size);
+  lmdb_read_end(connection_.handle_);
   return common::Error();
 }
 
@@ -628,23 +789,11 @@ common::Error DBConnection::DelInner(key_t key) {
   const string_key_t key_str = key.GetKeyData();
   MDB_val key_slice = ConvertToLMDBSlice(key_str.data(), key_str.size());
 
-  MDB_txn* txn = NULL;
   auto conf = GetConfig();
-  int env_flags = conf->env_flags;
-  common::Error err =
-      CheckResultCommand(DB_DELETE_KEY_COMMAND,
-                         mdb_txn_begin(connection_.handle_->env, NULL, lmdb_db_flag_from_env_flags(env_flags), &txn));
-  if (err) {
-    return err;
-  }
-
-  err = CheckResultCommand(DB_DELETE_KEY_COMMAND, mdb_del(txn, connection_.handle_->dbi, &key_slice, NULL));
-  if (err) {
-    mdb_txn_abort(txn);
-    return err;
-  }
-
-  return CheckResultCommand(DB_DELETE_KEY_COMMAND, mdb_txn_commit(txn));
+  MDB_dbi dbi = connection_.handle_->dbi;
+  int rc = lmdb_write_txn(connection_.handle_->env, conf->env_flags, conf->map_growth_percent,
+                          [dbi, &key_slice](MDB_txn* txn) { return mdb_del(txn, dbi, &key_slice, NULL); });
+  return CheckResultCommand(DB_DELETE_KEY_COMMAND, rc);
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -654,29 +803,40 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t* cursor_out) {
   MDB_cursor* cursor = NULL;
   MDB_txn* txn = NULL;
-  common::Error err =
-      CheckResultCommand(DB_SCAN_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, MDB_RDONLY, &txn));
+  common::Error err = CheckResultCommand(DB_SCAN_COMMAND, lmdb_read_begin(connection_.handle_, &txn));
   if (err) {
     return err;
   }
 
-  err = CheckResultCommand(DB_SCAN_COMMAND, mdb_cursor_open(txn, connection_.handle_->dbi, &cursor));
+  err = CheckResultCommand(DB_SCAN_COMMAND, lmdb_read_cursor(connection_.handle_, &cursor));
   if (err) {
-    mdb_txn_abort(txn);
+    lmdb_read_end(connection_.handle_);
     return err;
   }
 
-  MDB_val key;
-  MDB_val data;
+  const KeyPattern matcher(pattern);
+  const bool match_all = matcher.IsMatchAll();  // no per key matching for "*"
+  const std::string& prefix = matcher.GetPrefix();
+  MDB_val key;  // data is not requested, big values stay on overflow pages untouched
+  MDB_cursor_op op = MDB_NEXT;
+  if (!prefix.empty()) {  // first key not less than prefix
+    key.mv_size = prefix.size();
+    key.mv_data = const_cast<char*>(prefix.data());
+    op = MDB_SET_RANGE;
+  }
   uint64_t offset_pos = cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  while ((mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == LMDB_OK)) {
+  for (; mdb_cursor_get(cursor, &key, NULL, op) == LMDB_OK; op = MDB_NEXT) {
+    const char* key_data = reinterpret_cast<const char*>(key.mv_data);
+    if (!matcher.IsPrefixOf(key_data, key.mv_size)) {
+      break;
+    }
+
     if (lkeys_out.size() < count_keys) {
-      std::string skey(reinterpret_cast<const char*>(key.mv_data), key.mv_size);
-      if (common::MatchPattern(skey, pattern)) {
+      if (match_all || matcher.Match(key_data, key.mv_size)) {
         if (offset_pos == 0) {
-          lkeys_out.push_back(skey);
+          lkeys_out.push_back(std::string(key_data, key.mv_size));
         } else {
           offset_pos--;
         }
@@ -689,8 +849,7 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
 
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
-  mdb_cursor_close(cursor);
-  mdb_txn_abort(txn);
+  lmdb_read_end(connection_.handle_);
   return common::Error();
 }
 
@@ -700,57 +859,44 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
                                      std::vector<std::string>* ret) {
   MDB_cursor* cursor = NULL;
   MDB_txn* txn = NULL;
-  common::Error err =
-      CheckResultCommand(DB_KEYS_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, MDB_RDONLY, &txn));
+  common::Error err = CheckResultCommand(DB_KEYS_COMMAND, lmdb_read_begin(connection_.handle_, &txn));
   if (err) {
     return err;
   }
 
-  err = CheckResultCommand(DB_KEYS_COMMAND, mdb_cursor_open(txn, connection_.handle_->dbi, &cursor));
+  err = CheckResultCommand(DB_KEYS_COMMAND, lmdb_read_cursor(connection_.handle_, &cursor));
   if (err) {
-    mdb_txn_abort(txn);
+    lmdb_read_end(connection_.handle_);
     return err;
   }
 
   MDB_val key;
-  MDB_val data;
-  while ((mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == LMDB_OK) && limit > ret->size()) {
+  while ((mdb_cursor_get(cursor, &key, NULL, MDB_NEXT) == LMDB_OK) && limit > ret->size()) {
     std::string skey(reinterpret_cast<const char*>(key.mv_data), key.mv_size);
     if (key_start < skey && key_end > skey) {
       ret->push_back(skey);
     }
   }
 
-  mdb_cursor_close(cursor);
-  mdb_txn_abort(txn);
+  lmdb_read_end(connection_.handle_);
   return common::Error();
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  MDB_cursor* cursor = NULL;
   MDB_txn* txn = NULL;
-  common::Error err =
-      CheckResultCommand(DB_DBKCOUNT_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, MDB_RDONLY, &txn));
+  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, lmdb_read_begin(connection_.handle_, &txn));
   if (err) {
     return err;
   }
 
-  err = CheckResultCommand(DB_DBKCOUNT_COMMAND, mdb_cursor_open(txn, connection_.handle_->dbi, &cursor));
+  MDB_stat stat;
+  err = CheckResultCommand(DB_DBKCOUNT_COMMAND, mdb_stat(txn, connection_.handle_->dbi, &stat));
+  lmdb_read_end(connection_.handle_);
   if (err) {
-    mdb_txn_abort(txn);
     return err;
   }
 
-  MDB_val key;
-  MDB_val data;
-  size_t sz = 0;
-  while (mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == LMDB_OK) {
-    sz++;
-  }
-  mdb_cursor_close(cursor);
-  mdb_txn_abort(txn);
-
-  *size = sz;
+  *size = stat.ms_entries;
   return common::Error();
 }
 
@@ -781,41 +927,39 @@ common::Error DBConnection::RemoveDBImpl(const std::string& name, IDataBaseInfo*
 }
 
 common::Error DBConnection::FlushDBImpl() {
-  MDB_cursor* cursor = NULL;
-  MDB_txn* txn = NULL;
   auto conf = GetConfig();
-  int env_flags = conf->env_flags;
-  common::Error err = CheckResultCommand(
-      DB_FLUSHDB_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, lmdb_db_flag_from_env_flags(env_flags), &txn));
-  if (err) {
-    return err;
-  }
-
-  err = CheckResultCommand(DB_FLUSHDB_COMMAND, mdb_cursor_open(txn, connection_.handle_->dbi, &cursor));
-  if (err) {
-    mdb_txn_abort(txn);
-    return err;
-  }
-
-  MDB_val key;
-  MDB_val data;
-  size_t sz = 0;
-  while (mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == LMDB_OK) {
-    sz++;
-    err = CheckResultCommand(DB_FLUSHDB_COMMAND, mdb_del(txn, connection_.handle_->dbi, &key, NULL));
+  const size_t batch_size = conf->write_batch_size ? conf->write_batch_size : 1;
+  MDB_dbi dbi = connection_.handle_->dbi;
+  size_t deleted = 0;
+  do {  // commit every batch_size keys
+    int rc = lmdb_write_txn(connection_.handle_->env, conf->env_flags, conf->map_growth_percent,
+                            [dbi, batch_size, &deleted](MDB_txn* txn) -> int {
+                              MDB_cursor* cursor = NULL;
+                              int rc = mdb_cursor_open(txn, dbi, &cursor);
+                              if (rc != LMDB_OK) {
+                                return rc;
+                              }
+
+                              MDB_val key;
+                              deleted = 0;
+                              while (deleted < batch_size &&
+                                     (rc = mdb_cursor_get(cursor, &key, NULL, MDB_NEXT)) == LMDB_OK) {
+                                rc = mdb_cursor_del(cursor, 0);
+                                if (rc != LMDB_OK) {
+                                  break;
+                                }
+                                deleted++;
+                              }
+
+                              mdb_cursor_close(cursor);
+                              return rc == MDB_NOTFOUND ? LMDB_OK : rc;
+                            });
+    common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, rc);
     if (err) {
-      mdb_cursor_close(cursor);
-      mdb_txn_abort(txn);
       return err;
     }
-  }
+  } while (deleted == batch_size);
 
-  mdb_cursor_close(cursor);
-  if (sz != 0) {
-    return CheckResultCommand(DB_DELETE_KEY_COMMAND, mdb_txn_commit(txn));
-  }
-
-  mdb_txn_abort(txn);
   return common::Error();
 }
 
@@ -849,11 +993,43 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::StoreKeysImpl(const std::vector<NDbKValue>& keys) {
+  auto conf = GetConfig();
+  const size_t batch_size = conf->write_batch_size ? conf->write_batch_size : 1;
+  MDB_dbi dbi = connection_.handle_->dbi;
+  for (size_t offset = 0; offset < keys.size(); offset += batch_size) {  // commit every batch_size keys
+    const size_t last = std::min(keys.size(), offset + batch_size);
+    int rc = lmdb_write_txn(connection_.handle_->env, conf->env_flags, conf->map_growth_percent,
+                            [dbi, offset, last, &keys](MDB_txn* txn) -> int {
+                              for (size_t i = offset; i < last; ++i) {
+                                const string_key_t key_str = keys[i].GetKey().GetKey().GetKeyData();
+                                const std::string value = keys[i].GetValueString();
+                                MDB_val key_slice = ConvertToLMDBSlice(key_str.data(), key_str.size());
+                                MDB_val mval;
+                                mval.mv_size = value.size();
+                                mval.mv_data = const_cast<char*>(value.c_str());
+                                int rc = mdb_put(txn, dbi, &key_slice, &mval, 0);
+                                if (rc != LMDB_OK) {
+                                  return rc;
+                                }
+                              }
+                              return LMDB_OK;
+                            });
+    common::Error err = CheckResultCommand(DB_IMPORT_COMMAND, rc);
+    if (err) {
+      return err;
+    }
+  }
+
+  return common::Error();
+}
+
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
@@ -863,15 +1039,35 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
-  for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
+  auto conf = GetConfig();
+  const size_t batch_size = conf->write_batch_size ? conf->write_batch_size : 1;
+  MDB_dbi dbi = connection_.handle_->dbi;
+  for (size_t offset = 0; offset < keys.size(); offset += batch_size) {  // commit every batch_size keys
+    const size_t last = std::min(keys.size(), offset + batch_size);
+    NKeys deleted;
+    int rc = lmdb_write_txn(connection_.handle_->env, conf->env_flags, conf->map_growth_percent,
+                            [dbi, offset, last, &keys, &deleted](MDB_txn* txn) -> int {
+                              deleted.clear();  // whole batch retried after map growth
+                              for (size_t i = offset; i < last; ++i) {
+                                const string_key_t key_str = keys[i].GetKey().GetKeyData();
+                                MDB_val key_slice = ConvertToLMDBSlice(key_str.data(), key_str.size());
+                                int rc = mdb_del(txn, dbi, &key_slice, NULL);
+                                if (rc == MDB_NOTFOUND) {
+                                  continue;
+                                }
+                                if (rc != LMDB_OK) {
+                                  return rc;
+                                }
+                                deleted.push_back(keys[i]);
+                              }
+                              return LMDB_OK;
+                            });
+    common::Error err = CheckResultCommand(DB_DELETE_KEY_COMMAND, rc);
     if (err) {
-      continue;
+      return err;
     }
 
-    deleted_keys->push_back(key);
+    deleted_keys->insert(deleted_keys->end(), deleted.begin(), deleted.end());
   }
 
   return common::Error();
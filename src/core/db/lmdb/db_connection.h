@@ -47,7 +47,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   common::Error CheckResultCommand(const std::string& cmd, int err) WARN_UNUSED_RESULT;
 
   common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
   common::Error DelInner(key_t key) WARN_UNUSED_RESULT;
 
   virtual common::Error ScanImpl(uint64_t cursor_in,
@@ -65,10 +65,11 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error RemoveDBImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
+  virtual common::Error StoreKeysImpl(const std::vector<NDbKValue>& keys) override;
 };
 
 }  // namespace lmdb
@@ -404,6 +404,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         0,
                                                         CommandInfo::Native,
                                                         &CommandsApi::GetTTL),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Extended,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Extended,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -766,7 +786,7 @@ common::Error DBConnection::SetInner(key_t key, const std::string& value, time_t
                                                               value.c_str(), value.length(), expiration, flags));
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   if (!ret_val) {
     DNOTREACHED();
     return common::make_error_inval();
@@ -779,6 +799,10 @@ common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
   const string_key_t key_slice = key.GetKeyData();
   const char* key_slice_ptr = reinterpret_cast<const char*>(key_slice.data());
   char* value = memcached_get(connection_.handle_, key_slice_ptr, key_slice.size(), &value_length, &flags, &error);
+  if (error == MEMCACHED_NOTFOUND) {
+    return KeyNotFound(found);
+  }
+
   common::Error err = CheckResultCommand(DB_GET_KEY_COMMAND, error);
   if (err) {
     return err;
@@ -920,11 +944,12 @@ common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
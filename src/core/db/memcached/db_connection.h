@@ -58,7 +58,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   common::Error CheckResultCommand(const std::string& cmd, int err) WARN_UNUSED_RESULT;
 
   common::Error DelInner(key_t key, time_t expiration) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
   common::Error SetInner(key_t key, const std::string& value, time_t expiration, uint32_t flags) WARN_UNUSED_RESULT;
   common::Error ExpireInner(key_t key, ttl_t expiration) WARN_UNUSED_RESULT;
 
@@ -75,7 +75,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error FlushDBImpl() override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error SetTTLImpl(const NKey& key, ttl_t ttl) override;
@@ -0,0 +1,74 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/rdb/command_translator.h"
+
+#include "core/connection_types.h"
+
+#define RDB_GET_KEY_COMMAND DB_GET_KEY_COMMAND
+
+namespace fastonosql {
+namespace core {
+namespace rdb {
+
+CommandTranslator::CommandTranslator(const std::vector<CommandHolder>& commands) : ICommandTranslatorBase(commands) {}
+
+common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const {
+  UNUSED(key);
+  UNUSED(cmdstring);
+  return common::make_error(RDB_READ_ONLY_ERROR);
+}
+
+common::Error CommandTranslator::LoadKeyCommandImpl(const NKey& key,
+                                                    common::Value::Type type,
+                                                    command_buffer_t* cmdstring) const {
+  UNUSED(type);
+
+  key_t key_str = key.GetKey();
+  command_buffer_writer_t wr;
+  wr << RDB_GET_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
+  *cmdstring = wr.str();
+  return common::Error();
+}
+
+common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+  UNUSED(key);
+  UNUSED(cmdstring);
+  return common::make_error(RDB_READ_ONLY_ERROR);
+}
+
+common::Error CommandTranslator::RenameKeyCommandImpl(const NKey& key,
+                                                      const key_t& new_name,
+                                                      command_buffer_t* cmdstring) const {
+  UNUSED(key);
+  UNUSED(new_name);
+  UNUSED(cmdstring);
+  return common::make_error(RDB_READ_ONLY_ERROR);
+}
+
+bool CommandTranslator::IsLoadKeyCommandImpl(const CommandInfo& cmd) const {
+  return cmd.IsEqualName(RDB_GET_KEY_COMMAND);
+}
+
+const char* CommandTranslator::GetDBName() const {
+  return ConnectionTraits<RDB>::GetDBName();
+}
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,50 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "core/icommand_translator_base.h"
+
+#define RDB_READ_ONLY_ERROR "RDB file is opened read only."
+
+namespace fastonosql {
+namespace core {
+namespace rdb {
+
+class CommandTranslator : public ICommandTranslatorBase {
+ public:
+  explicit CommandTranslator(const std::vector<CommandHolder>& commands);
+
+ private:
+  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error LoadKeyCommandImpl(const NKey& key,
+                                           common::Value::Type type,
+                                           command_buffer_t* cmdstring) const override;
+  virtual common::Error DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error RenameKeyCommandImpl(const NKey& key,
+                                             const key_t& new_name,
+                                             command_buffer_t* cmdstring) const override;
+
+  virtual bool IsLoadKeyCommandImpl(const CommandInfo& cmd) const override;
+
+  virtual const char* GetDBName() const override;
+};
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,812 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/rdb/db_connection.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+
+#include <common/convert2string.h>
+#include <common/sprintf.h>
+#include <common/time.h>
+
+#include "core/commands_stats.h"  // for CommandsStats::Now
+#include "core/db/rdb/command_translator.h"
+#include "core/db/rdb/database_info.h"
+#include "core/db/rdb/internal/commands_api.h"
+#include "core/db/rdb/rdb_reader.h"
+#include "core/key_pattern.h"
+
+#define RDB_INDEX_OFFSET_BITS 40
+#define RDB_INDEX_OFFSET_MASK ((UINT64_C(1) << RDB_INDEX_OFFSET_BITS) - 1)
+#define RDB_INDEX_HASH_MASK ((UINT64_C(1) << (64 - RDB_INDEX_OFFSET_BITS)) - 1)
+
+namespace fastonosql {
+namespace core {
+template <>
+const char* ConnectionTraits<RDB>::GetBasedOn() {
+  return "builtin rdb parser";
+}
+
+template <>
+const char* ConnectionTraits<RDB>::GetVersionApi() {
+  return "12";  // newest supported dump version
+}
+namespace rdb {
+
+// key records of one database, dump can split database into several sections
+struct rdb_db {
+  typedef std::pair<uint64_t, uint64_t> range_t;  // [first key record, end of last key record)
+
+  bool Contains(uint64_t offset) const {
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      if (offset >= ranges[i].first && offset < ranges[i].second) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  uint64_t number;
+  std::vector<range_t> ranges;
+  uint64_t keys;
+  uint64_t expires;
+};
+
+struct rdb_dump {
+  RdbReader reader;
+  std::vector<rdb_db> dbs;  // in order of dump
+  size_t current;
+  std::map<std::string, std::string> aux;
+  // sorted (key hash << offset bits | record offset), for GET without file walk
+  std::vector<uint64_t> index;
+  bool index_complete;
+};
+
+namespace {
+
+const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
+                                                        "[command]",
+                                                        "Return how to use command",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        1,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Help),
+                                          CommandHolder(DB_INFO_COMMAND,
+                                                        "[section]",
+                                                        "These command return dump file information.",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        1,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Info),
+                                          CommandHolder("CONFIG GET",
+                                                        "<parameter>",
+                                                        "Get the value of a configuration parameter",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::ConfigGet),
+                                          CommandHolder(DB_SCAN_COMMAND,
+                                                        "<cursor> [MATCH pattern] [COUNT count]",
+                                                        "Incrementally iterate the keys space",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        4,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Scan),
+                                          CommandHolder(DB_KEYS_COMMAND,
+                                                        "<key_start> <key_end> <limit>",
+                                                        "Find all keys matching the given limits.",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        3,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Keys),
+                                          CommandHolder(DB_DBKCOUNT_COMMAND,
+                                                        "-",
+                                                        "Return the number of keys in the "
+                                                        "selected database",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::DBkcount),
+                                          CommandHolder(DB_FLUSHDB_COMMAND,
+                                                        "-",
+                                                        "Remove all keys from the current database",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        1,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::FlushDB),
+                                          CommandHolder(DB_SELECTDB_COMMAND,
+                                                        "<name>",
+                                                        "Change the selected database for the "
+                                                        "current connection",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Select),
+                                          CommandHolder(DB_SET_KEY_COMMAND,
+                                                        "<key> <value>",
+                                                        "Set the value of a key.",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        2,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Set),
+                                          CommandHolder(DB_GET_KEY_COMMAND,
+                                                        "<key>",
+                                                        "Get the value of a key.",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Get),
+                                          CommandHolder(DB_RENAME_KEY_COMMAND,
+                                                        "<key> <newkey>",
+                                                        "Rename a key",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        2,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Rename),
+                                          CommandHolder(DB_DELETE_KEY_COMMAND,
+                                                        "<key> [key ...]",
+                                                        "Delete key.",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        INFINITE_COMMAND_ARGS,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Delete),
+                                          CommandHolder(DB_GET_TTL_COMMAND,
+                                                        "<key>",
+                                                        "Get the time to live for a key in seconds at now",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::GetTTL),
+                                          CommandHolder(RDB_DEBUG_OBJECT_COMMAND,
+                                                        "<key>",
+                                                        "Get type, encoding, serialized length and ttl of key",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::DebugObject),
+                                          CommandHolder(RDB_MEMKEYS_COMMAND,
+                                                        "[MATCH <pattern>] [TOP <n>] [DEPTH <n>] [SEPARATOR <str>] "
+                                                        "[BY MEMORY|LENGTH]",
+                                                        "Biggest keys and size per namespace prefix and type "
+                                                        "of the selected database",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        16,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::MemKeys),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_QUIT_COMMAND,
+                                                        "-",
+                                                        "Close the connection",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Quit)};
+
+uint64_t GetKeyHash(const std::string& key) {
+  return std::hash<std::string>()(key) & RDB_INDEX_HASH_MASK;
+}
+
+rdb_db* FindDB(rdb_dump* context, uint64_t number, size_t* pos) {
+  for (size_t i = 0; i < context->dbs.size(); ++i) {
+    if (context->dbs[i].number == number) {
+      *pos = i;
+      return &context->dbs[i];
+    }
+  }
+
+  rdb_db db;
+  db.number = number;
+  db.keys = 0;
+  db.expires = 0;
+  *pos = context->dbs.size();
+  context->dbs.push_back(db);
+  return &context->dbs.back();
+}
+
+// one pass over dump: database sections, counters, aux fields and index of keys up to limit
+common::Error rdb_load(rdb_dump* context, uint64_t index_limit) {
+  const RdbReader& reader = context->reader;
+  rdb_db* db = nullptr;
+  size_t db_pos = 0;
+  bool range_opened = false;
+  uint64_t range_first = 0;
+  uint64_t range_end = 0;
+  context->index_complete = true;
+  for (uint64_t offset = reader.GetFirstOffset();;) {
+    RdbRecord record;
+    common::Error err = reader.ReadRecord(offset, &record);
+    if (err) {
+      return err;
+    }
+
+    if (record.kind == RdbRecord::KEY_VALUE) {
+      if (!db) {  // old dumps without select db
+        db = FindDB(context, 0, &db_pos);
+      }
+      if (!range_opened) {
+        range_opened = true;
+        range_first = record.offset;
+      }
+      range_end = record.next_offset;
+      db->keys++;
+      if (record.expire_ms != -1) {
+        db->expires++;
+      }
+
+      if (context->index.size() < index_limit && record.offset <= RDB_INDEX_OFFSET_MASK) {
+        context->index.push_back(GetKeyHash(record.key) << RDB_INDEX_OFFSET_BITS | record.offset);
+      } else {
+        context->index_complete = false;
+      }
+    } else {
+      if (range_opened) {
+        db->ranges.push_back(std::make_pair(range_first, range_end));
+        range_opened = false;
+      }
+
+      if (record.kind == RdbRecord::SELECT_DB) {
+        db = FindDB(context, record.db, &db_pos);
+      } else if (record.kind == RdbRecord::AUX) {
+        context->aux[record.key] = record.aux_value;
+      } else if (record.kind == RdbRecord::END) {
+        break;
+      }
+    }
+    offset = record.next_offset;
+  }
+
+  if (!context->index_complete) {  // partial index is useless for misses
+    std::vector<uint64_t>().swap(context->index);
+  }
+  std::sort(context->index.begin(), context->index.end());
+  context->current = 0;
+  return common::Error();
+}
+
+void rdb_close(rdb_dump** context) {
+  if (!context) {
+    return;
+  }
+
+  delete *context;
+  *context = nullptr;
+}
+
+}  // namespace
+}  // namespace rdb
+namespace internal {
+template <>
+common::Error ConnectionAllocatorTraits<rdb::NativeConnection, rdb::Config>::Connect(const rdb::Config& config,
+                                                                                   rdb::NativeConnection** hout) {
+  rdb::NativeConnection* context = nullptr;
+  common::Error err = rdb::CreateConnection(config, &context);
+  if (err) {
+    return err;
+  }
+
+  *hout = context;
+  return common::Error();
+}
+
+template <>
+common::Error ConnectionAllocatorTraits<rdb::NativeConnection, rdb::Config>::Disconnect(
+    rdb::NativeConnection** handle) {
+  rdb::rdb_close(handle);
+  *handle = nullptr;
+  return common::Error();
+}
+
+template <>
+bool ConnectionAllocatorTraits<rdb::NativeConnection, rdb::Config>::IsConnected(rdb::NativeConnection* handle) {
+  if (!handle) {
+    return false;
+  }
+
+  return true;
+}
+
+template <>
+const ConstantCommandsArray& CDBConnection<rdb::NativeConnection, rdb::Config, RDB>::GetCommands() {
+  return rdb::g_commands;
+}
+
+}  // namespace internal
+
+namespace rdb {
+
+common::Error CreateConnection(const Config& config, NativeConnection** context) {
+  if (!context) {
+    return common::make_error_inval();
+  }
+
+  DCHECK(*context == NULL);
+  NativeConnection* lcontext = new NativeConnection;
+  common::Error err = lcontext->reader.Open(config.db_path);
+  if (err) {
+    delete lcontext;
+    return err;
+  }
+
+  err = rdb_load(lcontext, config.index_limit);
+  if (err) {
+    delete lcontext;
+    return common::make_error(common::MemSPrintf("Fail open dump: %s", err->GetDescription()));
+  }
+
+  *context = lcontext;
+  return common::Error();
+}
+
+common::Error TestConnection(const Config& config) {
+  RdbReader reader;  // header only, whole dump is read on connect
+  common::Error err = reader.Open(config.db_path);
+  if (err) {
+    return err;
+  }
+
+  reader.Close();
+  return common::Error();
+}
+
+DBConnection::DBConnection(CDBConnectionClient* client)
+    : base_class(client, new CommandTranslator(base_class::GetCommands())) {}
+
+std::string DBConnection::GetCurrentDBName() const {
+  if (IsConnected()) {  // if connected
+    const rdb_dump* context = connection_.handle_;
+    if (context->current < context->dbs.size()) {
+      return common::ConvertToString(context->dbs[context->current].number);
+    }
+    return "0";
+  }
+
+  DNOTREACHED() << "GetCurrentDBName failed!";
+  return base_class::GetCurrentDBName();
+}
+
+common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* statsout) {
+  UNUSED(args);
+  if (!statsout) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  const rdb_dump* context = connection_.handle_;
+  ServerInfo::Stats linfo;
+  auto conf = GetConfig();
+  linfo.db_path = conf->db_path;
+  linfo.db_size = context->reader.GetFileSize();
+  linfo.rdb_version = context->reader.GetVersion();
+  auto redis_ver = context->aux.find("redis-ver");
+  if (redis_ver != context->aux.end()) {
+    linfo.redis_version = redis_ver->second;
+  }
+  auto ctime = context->aux.find("ctime");
+  if (ctime != context->aux.end()) {
+    linfo.rdb_ctime = ctime->second;
+  }
+  linfo.databases = context->dbs.size();
+  for (size_t i = 0; i < context->dbs.size(); ++i) {
+    linfo.keys += context->dbs[i].keys;
+    linfo.expires += context->dbs[i].expires;
+  }
+  *statsout = linfo;
+  return common::Error();
+}
+
+common::Error DBConnection::ConfigGetDatabases(std::vector<std::string>* dbs) {
+  if (!dbs) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  const rdb_dump* context = connection_.handle_;
+  for (size_t i = 0; i < context->dbs.size(); ++i) {
+    dbs->push_back(common::ConvertToString(context->dbs[i].number));
+  }
+  return common::Error();
+}
+
+common::Error DBConnection::DebugObject(const NKey& key, std::string* info) {
+  if (!info) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  RdbRecord record;
+  err = FindRecord(key.GetKey(), &record);
+  if (err) {
+    return err;
+  }
+
+  uint64_t length = 0;
+  err = connection_.handle_->reader.GetValueLength(record, &length);
+  if (err) {
+    return err;
+  }
+
+  ttl_t ttl = NO_TTL;
+  err = GetTTLImpl(key, &ttl);
+  if (err) {
+    return err;
+  }
+
+  *info = common::MemSPrintf(
+      "type:%s encoding:%s serializedlength:%llu length:%llu ttl:%lld offset:%llu", GetTypeName(record.type),
+      GetEncodingName(record.type), static_cast<unsigned long long>(record.value_size),
+      static_cast<unsigned long long>(length), ttl, static_cast<unsigned long long>(record.offset));
+  return common::Error();
+}
+
+common::Error DBConnection::AnalyzeMemory(const MemoryAnalyzerConfig& aconfig,
+                                          memory_report_observer_t observer,
+                                          MemoryReport* report) {
+  if (!report) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  static const CommandsStats::usec_t progress_interval = 1000000;
+  const rdb_dump* context = connection_.handle_;
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  CommandsStats::usec_t progress_ts = start_ts;
+  const KeyPattern matcher(aconfig.pattern);
+  MemoryAnalyzer analyzer(aconfig);
+  bool completed = true;
+  if (context->current < context->dbs.size()) {
+    const rdb_db& db = context->dbs[context->current];
+    for (size_t i = 0; i < db.ranges.size() && completed; ++i) {
+      for (uint64_t offset = db.ranges[i].first; offset < db.ranges[i].second;) {
+        if (IsInterrupted()) {
+          completed = false;
+          break;
+        }
+
+        RdbRecord record;
+        err = context->reader.ReadRecord(offset, &record);
+        if (err) {
+          return err;
+        }
+        offset = record.next_offset;
+        if (!matcher.Match(record.key)) {
+          continue;
+        }
+
+        uint64_t length = 0;
+        err = context->reader.GetValueLength(record, &length);
+        if (err) {
+          return err;
+        }
+        analyzer.Add(MemoryKeyInfo(record.key, GetTypeName(record.type), record.next_offset - record.offset, length));
+
+        if (observer && CommandsStats::Now() - progress_ts >= progress_interval) {
+          progress_ts = CommandsStats::Now();
+          MemoryReport progress = analyzer.GetReport();
+          progress.msec = (progress_ts - start_ts) / 1000;
+          observer(progress);
+        }
+      }
+    }
+  }
+
+  MemoryReport lreport = analyzer.GetReport();
+  lreport.msec = (CommandsStats::Now() - start_ts) / 1000;
+  lreport.completed = completed;
+  *report = lreport;
+  return common::Error();
+}
+
+common::Error DBConnection::FindRecord(const key_t& key, RdbRecord* record, bool* found) {
+  const rdb_dump* context = connection_.handle_;
+  if (context->current >= context->dbs.size()) {
+    return KeyNotFound(found);
+  }
+
+  const rdb_db& db = context->dbs[context->current];
+  const std::string key_data = key.GetKeyData();
+  if (context->index_complete) {
+    const uint64_t hash = GetKeyHash(key_data);
+    auto it = std::lower_bound(context->index.begin(), context->index.end(), hash << RDB_INDEX_OFFSET_BITS);
+    for (; it != context->index.end() && (*it >> RDB_INDEX_OFFSET_BITS) == hash; ++it) {
+      const uint64_t offset = *it & RDB_INDEX_OFFSET_MASK;
+      if (!db.Contains(offset)) {  // same key in other database or hash collision
+        continue;
+      }
+
+      std::string lkey;
+      common::Error err = context->reader.ReadKey(offset, &lkey);
+      if (err) {
+        return err;
+      }
+      if (lkey == key_data) {
+        return context->reader.ReadRecord(offset, record);
+      }
+    }
+    return KeyNotFound(found);
+  }
+
+  for (size_t i = 0; i < db.ranges.size(); ++i) {
+    for (uint64_t offset = db.ranges[i].first; offset < db.ranges[i].second;) {
+      common::Error err = context->reader.ReadRecord(offset, record);
+      if (err) {
+        return err;
+      }
+      if (record->key == key_data) {
+        return common::Error();
+      }
+      offset = record->next_offset;
+    }
+  }
+  return KeyNotFound(found);
+}
+
+common::Error DBConnection::ScanImpl(uint64_t cursor_in,
+                                     const std::string& pattern,
+                                     uint64_t count_keys,
+                                     std::vector<std::string>* keys_out,
+                                     uint64_t* cursor_out) {
+  const rdb_dump* context = connection_.handle_;
+  if (context->current >= context->dbs.size()) {
+    *keys_out = std::vector<std::string>();
+    *cursor_out = 0;
+    return common::Error();
+  }
+
+  // cursor is offset of next record in dump
+  const rdb_db& db = context->dbs[context->current];
+  size_t range = 0;
+  uint64_t offset = db.ranges.empty() ? 0 : db.ranges[0].first;
+  if (cursor_in) {
+    for (range = 0; range < db.ranges.size(); ++range) {
+      if (cursor_in >= db.ranges[range].first && cursor_in < db.ranges[range].second) {
+        break;
+      }
+    }
+    if (range == db.ranges.size()) {
+      return GenerateError(DB_SCAN_COMMAND, "invalid cursor");
+    }
+    offset = cursor_in;
+  }
+
+  const KeyPattern matcher(pattern);
+  uint64_t lcursor_out = 0;
+  std::vector<std::string> lkeys_out;
+  while (range < db.ranges.size()) {
+    if (offset >= db.ranges[range].second) {
+      if (++range < db.ranges.size()) {
+        offset = db.ranges[range].first;
+      }
+      continue;
+    }
+
+    if (lkeys_out.size() >= count_keys) {
+      lcursor_out = offset;
+      break;
+    }
+
+    RdbRecord record;
+    common::Error err = context->reader.ReadRecord(offset, &record);
+    if (err) {
+      return err;
+    }
+    if (matcher.Match(record.key)) {
+      lkeys_out.push_back(record.key);
+    }
+    offset = record.next_offset;
+  }
+
+  *keys_out = lkeys_out;
+  *cursor_out = lcursor_out;
+  return common::Error();
+}
+
+common::Error DBConnection::KeysImpl(const std::string& key_start,
+                                     const std::string& key_end,
+                                     uint64_t limit,
+                                     std::vector<std::string>* ret) {
+  const rdb_dump* context = connection_.handle_;
+  if (context->current >= context->dbs.size()) {
+    return common::Error();
+  }
+
+  const rdb_db& db = context->dbs[context->current];
+  for (size_t i = 0; i < db.ranges.size() && ret->size() < limit; ++i) {
+    for (uint64_t offset = db.ranges[i].first; offset < db.ranges[i].second && ret->size() < limit;) {
+      RdbRecord record;
+      common::Error err = context->reader.ReadRecord(offset, &record);
+      if (err) {
+        return err;
+      }
+      if (record.key >= key_start && record.key < key_end) {
+        ret->push_back(record.key);
+      }
+      offset = record.next_offset;
+    }
+  }
+  return common::Error();
+}
+
+common::Error DBConnection::DBkcountImpl(size_t* size) {
+  const rdb_dump* context = connection_.handle_;
+  *size = context->current < context->dbs.size() ? context->dbs[context->current].keys : 0;
+  return common::Error();
+}
+
+common::Error DBConnection::FlushDBImpl() {
+  return GenerateError(DB_FLUSHDB_COMMAND, RDB_READ_ONLY_ERROR);
+}
+
+common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo** info) {
+  rdb_dump* context = connection_.handle_;
+  uint64_t number;
+  if (!common::ConvertFromString(name, &number)) {
+    return GenerateError(DB_SELECTDB_COMMAND, "invalid database index");
+  }
+
+  size_t pos = context->dbs.size();
+  for (size_t i = 0; i < context->dbs.size(); ++i) {
+    if (context->dbs[i].number == number) {
+      pos = i;
+      break;
+    }
+  }
+
+  size_t kcount = 0;
+  if (pos != context->dbs.size()) {
+    context->current = pos;
+    kcount = context->dbs[pos].keys;
+  } else if (!context->dbs.empty() || number != 0) {  // empty dump has only empty db 0
+    return GenerateError(DB_SELECTDB_COMMAND, common::MemSPrintf("database %s not found in dump", name));
+  }
+
+  *info = new DataBaseInfo(name, true, kcount);
+  return common::Error();
+}
+
+common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key) {
+  UNUSED(key);
+  UNUSED(added_key);
+  return GenerateError(DB_SET_KEY_COMMAND, RDB_READ_ONLY_ERROR);
+}
+
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
+  RdbRecord record;
+  *found = true;
+  common::Error err = FindRecord(key.GetKey(), &record, found);
+  if (err || !*found) {
+    return err;
+  }
+
+  common::Value* value = nullptr;
+  err = connection_.handle_->reader.ReadValue(record, &value);
+  if (err) {
+    return err;
+  }
+
+  NValue val(value);
+  *loaded_key = NDbKValue(key, val);
+  return common::Error();
+}
+
+common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
+  UNUSED(keys);
+  UNUSED(deleted_keys);
+  return GenerateError(DB_DELETE_KEY_COMMAND, RDB_READ_ONLY_ERROR);
+}
+
+common::Error DBConnection::RenameImpl(const NKey& key, string_key_t new_key) {
+  UNUSED(key);
+  UNUSED(new_key);
+  return GenerateError(DB_RENAME_KEY_COMMAND, RDB_READ_ONLY_ERROR);
+}
+
+common::Error DBConnection::GetTTLImpl(const NKey& key, ttl_t* ttl) {
+  RdbRecord record;
+  common::Error err = FindRecord(key.GetKey(), &record);
+  if (err) {  // as redis for missing key
+    *ttl = EXPIRED_TTL;
+    return common::Error();
+  }
+
+  if (record.expire_ms == -1) {
+    *ttl = NO_TTL;
+    return common::Error();
+  }
+
+  // relative to now, keys expired after dump was made are reported as expired
+  const int64_t left_ms = record.expire_ms - static_cast<int64_t>(common::time::current_mstime());
+  *ttl = left_ms > 0 ? (left_ms + 500) / 1000 : EXPIRED_TTL;
+  return common::Error();
+}
+
+common::Error DBConnection::QuitImpl() {
+  common::Error err = Disconnect();
+  if (err) {
+    return err;
+  }
+
+  return common::Error();
+}
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
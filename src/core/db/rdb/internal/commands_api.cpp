@@ -0,0 +1,108 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/rdb/internal/commands_api.h"
+
+#include <common/sprintf.h>
+
+#include "core/db/rdb/db_connection.h"
+
+namespace fastonosql {
+namespace core {
+namespace rdb {
+
+common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  DBConnection* cdb = static_cast<DBConnection*>(handler);
+  ServerInfo::Stats statsout;
+  common::Error err = cdb->Info(argv.size() == 1 ? argv[0] : std::string(), &statsout);
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue(ServerInfo(statsout).ToString());
+  FastoObject* child = new FastoObject(out, val, cdb->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  DBConnection* cdb = static_cast<DBConnection*>(handler);
+  if (argv[0] != "databases") {
+    return common::make_error_inval();
+  }
+
+  std::vector<std::string> dbs;
+  common::Error err = cdb->ConfigGetDatabases(&dbs);
+  if (err) {
+    return err;
+  }
+
+  common::ArrayValue* arr = new common::ArrayValue;
+  arr->AppendStrings(dbs);
+  FastoObject* child = new FastoObject(out, arr, cdb->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::DebugObject(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  DBConnection* cdb = static_cast<DBConnection*>(handler);
+  key_t raw_key(argv[0]);
+  NKey key(raw_key);
+
+  std::string info;
+  common::Error err = cdb->DebugObject(key, &info);
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue(info);
+  FastoObject* child = new FastoObject(out, val, cdb->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::MemKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  MemoryAnalyzerConfig aconfig;
+  common::Error err = ParseMemoryAnalyzerArgs(argv, &aconfig);
+  if (err) {
+    return err;
+  }
+
+  DBConnection* cdb = static_cast<DBConnection*>(handler);
+  auto progress = [cdb, out](const MemoryReport& report) {
+    const std::string line =
+        common::MemSPrintf("%llu keys, %llu bytes, %.2f seconds", static_cast<unsigned long long>(report.keys),
+                           static_cast<unsigned long long>(report.bytes), static_cast<double>(report.msec) / 1000);
+    FastoObject* child = new FastoObject(out, common::Value::CreateStringValue(line), cdb->GetDelimiter());
+    out->AddChildren(child);
+  };
+  MemoryReport report;
+  err = cdb->AnalyzeMemory(aconfig, progress, &report);
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue(common::ConvertToString(report));
+  FastoObject* child = new FastoObject(out, val, cdb->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
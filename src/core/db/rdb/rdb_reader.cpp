@@ -0,0 +1,1443 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/rdb/rdb_reader.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef OS_WIN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <limits>
+#include <vector>
+
+#include <common/convert2string.h>
+#include <common/sprintf.h>
+
+#define RDB_OPCODE_SLOT_INFO 244
+#define RDB_OPCODE_FUNCTION2 245
+#define RDB_OPCODE_FUNCTION_PRE_GA 246
+#define RDB_OPCODE_MODULE_AUX 247
+#define RDB_OPCODE_IDLE 248
+#define RDB_OPCODE_FREQ 249
+#define RDB_OPCODE_AUX 250
+#define RDB_OPCODE_RESIZEDB 251
+#define RDB_OPCODE_EXPIRETIME_MS 252
+#define RDB_OPCODE_EXPIRETIME 253
+#define RDB_OPCODE_SELECTDB 254
+#define RDB_OPCODE_EOF 255
+
+#define RDB_ENC_INT8 0
+#define RDB_ENC_INT16 1
+#define RDB_ENC_INT32 2
+#define RDB_ENC_LZF 3
+
+#define RDB_MODULE_OPCODE_EOF 0
+#define RDB_MODULE_OPCODE_SINT 1
+#define RDB_MODULE_OPCODE_UINT 2
+#define RDB_MODULE_OPCODE_FLOAT 3
+#define RDB_MODULE_OPCODE_DOUBLE 4
+#define RDB_MODULE_OPCODE_STRING 5
+
+#define RDB_QUICKLIST_NODE_PLAIN 1
+#define RDB_QUICKLIST_NODE_PACKED 2
+
+#define RDB_MAGIC "REDIS"
+#define RDB_MAGIC_SIZE 5
+#define RDB_HEADER_SIZE 9
+
+namespace fastonosql {
+namespace core {
+namespace rdb {
+
+namespace {
+
+typedef std::vector<std::string> elements_t;
+
+// longest lzf back reference: 3 bytes expand to 264
+const uint64_t kLzfMaxExpansion = 88;
+
+common::Error MakeCorruptedError(uint64_t offset) {
+  return common::make_error(
+      common::MemSPrintf("Corrupted RDB file at offset %llu", static_cast<unsigned long long>(offset)));
+}
+
+uint64_t LoadLE(const unsigned char* data, size_t size) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return result;
+}
+
+uint64_t LoadBE(const unsigned char* data, size_t size) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result = (result << 8) | data[i];
+  }
+  return result;
+}
+
+// sign extension of little endian integer with size bytes
+int64_t LoadSignedLE(const unsigned char* data, size_t size) {
+  const uint64_t value = LoadLE(data, size);
+  const unsigned shift = 64 - size * 8;
+  return static_cast<int64_t>(value << shift) >> shift;
+}
+
+std::string IntegerToString(int64_t value) {
+  return common::ConvertToString(static_cast<long long>(value));
+}
+
+bool LzfDecompress(const unsigned char* in, size_t in_len, unsigned char* out, size_t out_len) {
+  size_t ip = 0;
+  size_t op = 0;
+  while (ip < in_len) {
+    size_t ctrl = in[ip++];
+    if (ctrl < 32) {  // literal run
+      ctrl++;
+      if (ip + ctrl > in_len || op + ctrl > out_len) {
+        return false;
+      }
+      memcpy(out + op, in + ip, ctrl);
+      ip += ctrl;
+      op += ctrl;
+      continue;
+    }
+
+    // back reference
+    size_t len = ctrl >> 5;
+    if (len == 7) {
+      if (ip >= in_len) {
+        return false;
+      }
+      len += in[ip++];
+    }
+    if (ip >= in_len) {
+      return false;
+    }
+    const size_t back = ((ctrl & 0x1f) << 8) + in[ip++] + 1;
+    len += 2;
+    if (back > op || op + len > out_len) {
+      return false;
+    }
+    for (size_t i = 0; i < len; ++i, ++op) {
+      out[op] = out[op - back];
+    }
+  }
+  return op == out_len;
+}
+
+class Cursor {
+ public:
+  Cursor(const unsigned char* data, uint64_t size, uint64_t pos) : data_(data), size_(size), pos_(pos) {}
+
+  uint64_t GetPos() const { return pos_; }
+
+  common::Error ReadRaw(uint64_t size, const unsigned char** out) WARN_UNUSED_RESULT {
+    if (pos_ > size_ || size > size_ - pos_) {
+      return MakeCorruptedError(pos_);
+    }
+    *out = data_ + pos_;
+    pos_ += size;
+    return common::Error();
+  }
+
+  common::Error Skip(uint64_t size) WARN_UNUSED_RESULT {
+    const unsigned char* unused = nullptr;
+    return ReadRaw(size, &unused);
+  }
+
+  common::Error ReadByte(unsigned char* out) WARN_UNUSED_RESULT {
+    const unsigned char* raw = nullptr;
+    common::Error err = ReadRaw(1, &raw);
+    if (err) {
+      return err;
+    }
+    *out = raw[0];
+    return common::Error();
+  }
+
+  common::Error ReadLength(uint64_t* len, bool* encoded = nullptr) WARN_UNUSED_RESULT {
+    const uint64_t start = pos_;
+    unsigned char first;
+    common::Error err = ReadByte(&first);
+    if (err) {
+      return err;
+    }
+
+    if (encoded) {
+      *encoded = false;
+    }
+    const unsigned char type = (first & 0xC0) >> 6;
+    if (type == 0) {  // 6 bit
+      *len = first & 0x3F;
+      return common::Error();
+    }
+
+    const unsigned char* raw = nullptr;
+    if (type == 1) {  // 14 bit
+      err = ReadRaw(1, &raw);
+      if (err) {
+        return err;
+      }
+      *len = ((first & 0x3F) << 8) | raw[0];
+      return common::Error();
+    }
+
+    if (type == 3) {  // special string encoding
+      if (!encoded) {
+        return MakeCorruptedError(start);
+      }
+      *encoded = true;
+      *len = first & 0x3F;
+      return common::Error();
+    }
+
+    size_t size = 0;
+    if (first == 0x80) {
+      size = 4;
+    } else if (first == 0x81) {
+      size = 8;
+    } else {
+      return MakeCorruptedError(start);
+    }
+    err = ReadRaw(size, &raw);
+    if (err) {
+      return err;
+    }
+    *len = LoadBE(raw, size);
+    return common::Error();
+  }
+
+  common::Error ReadString(std::string* out) WARN_UNUSED_RESULT {
+    const uint64_t start = pos_;
+    uint64_t len;
+    bool encoded;
+    common::Error err = ReadLength(&len, &encoded);
+    if (err) {
+      return err;
+    }
+
+    const unsigned char* raw = nullptr;
+    if (!encoded) {
+      err = ReadRaw(len, &raw);
+      if (err) {
+        return err;
+      }
+      out->assign(reinterpret_cast<const char*>(raw), len);
+      return common::Error();
+    }
+
+    if (len == RDB_ENC_INT8 || len == RDB_ENC_INT16 || len == RDB_ENC_INT32) {
+      const size_t size = static_cast<size_t>(1) << len;
+      err = ReadRaw(size, &raw);
+      if (err) {
+        return err;
+      }
+      *out = IntegerToString(LoadSignedLE(raw, size));
+      return common::Error();
+    }
+
+    if (len != RDB_ENC_LZF) {
+      return MakeCorruptedError(start);
+    }
+
+    uint64_t clen;
+    uint64_t ulen;
+    err = ReadLength(&clen);
+    if (err) {
+      return err;
+    }
+    err = ReadLength(&ulen);
+    if (err) {
+      return err;
+    }
+    err = ReadRaw(clen, &raw);
+    if (err) {
+      return err;
+    }
+    if (ulen > clen * kLzfMaxExpansion) {
+      return MakeCorruptedError(start);
+    }
+    out->resize(ulen);
+    if (!LzfDecompress(raw, clen, reinterpret_cast<unsigned char*>(&(*out)[0]), ulen)) {
+      return MakeCorruptedError(start);
+    }
+    return common::Error();
+  }
+
+  // uncompressed size without decoding
+  common::Error ReadStringSize(uint64_t* size) WARN_UNUSED_RESULT {
+    const uint64_t start = pos_;
+    uint64_t len;
+    bool encoded;
+    common::Error err = ReadLength(&len, &encoded);
+    if (err) {
+      return err;
+    }
+
+    if (!encoded) {
+      *size = len;
+      return Skip(len);
+    }
+
+    if (len == RDB_ENC_LZF) {
+      uint64_t clen;
+      err = ReadLength(&clen);
+      if (err) {
+        return err;
+      }
+      err = ReadLength(size);
+      if (err) {
+        return err;
+      }
+      return Skip(clen);
+    }
+
+    pos_ = start;
+    std::string number;
+    err = ReadString(&number);
+    if (err) {
+      return err;
+    }
+    *size = number.size();
+    return common::Error();
+  }
+
+  common::Error SkipString() WARN_UNUSED_RESULT {
+    uint64_t unused;
+    return ReadStringSize(&unused);
+  }
+
+  // zset score of RDB_TYPE_ZSET, length prefixed text
+  common::Error ReadDoubleString(std::string* out) WARN_UNUSED_RESULT {
+    unsigned char len;
+    common::Error err = ReadByte(&len);
+    if (err) {
+      return err;
+    }
+    if (len == 253) {
+      *out = "nan";
+      return common::Error();
+    } else if (len == 254) {
+      *out = "inf";
+      return common::Error();
+    } else if (len == 255) {
+      *out = "-inf";
+      return common::Error();
+    }
+
+    const unsigned char* raw = nullptr;
+    err = ReadRaw(len, &raw);
+    if (err) {
+      return err;
+    }
+    out->assign(reinterpret_cast<const char*>(raw), len);
+    return common::Error();
+  }
+
+  // zset score of RDB_TYPE_ZSET_2, little endian ieee 754
+  common::Error ReadBinaryDouble(std::string* out) WARN_UNUSED_RESULT {
+    const unsigned char* raw = nullptr;
+    common::Error err = ReadRaw(sizeof(double), &raw);
+    if (err) {
+      return err;
+    }
+    const uint64_t bits = LoadLE(raw, sizeof(double));
+    double value;
+    memcpy(&value, &bits, sizeof(double));
+    *out = common::ConvertToString(value);
+    return common::Error();
+  }
+
+ private:
+  const unsigned char* const data_;
+  const uint64_t size_;
+  uint64_t pos_;
+};
+
+// ziplist: <zlbytes:4><zltail:4><zllen:2><entry>...<0xff>
+common::Error ParseZiplist(const std::string& blob, uint64_t* count, elements_t* elements) {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(blob.data());
+  const size_t size = blob.size();
+  if (size < 11) {
+    return common::make_error("Invalid ziplist");
+  }
+
+  const uint64_t header_count = LoadLE(data + 8, 2);
+  if (!elements && header_count != std::numeric_limits<uint16_t>::max()) {
+    *count = header_count;
+    return common::Error();
+  }
+
+  *count = 0;
+  size_t pos = 10;
+  while (true) {
+    if (pos >= size) {
+      return common::make_error("Invalid ziplist");
+    }
+    if (data[pos] == 0xff) {
+      break;
+    }
+
+    pos += data[pos] < 254 ? 1 : 5;  // prevlen
+    if (pos >= size) {
+      return common::make_error("Invalid ziplist");
+    }
+
+    const unsigned char enc = data[pos];
+    size_t header = 1;
+    size_t len = 0;
+    bool is_string = true;
+    switch (enc >> 6) {
+      case 0:
+        len = enc & 0x3F;
+        break;
+      case 1:
+        header = 2;
+        if (pos + header > size) {
+          return common::make_error("Invalid ziplist");
+        }
+        len = ((enc & 0x3F) << 8) | data[pos + 1];
+        break;
+      case 2:
+        header = 5;
+        if (pos + header > size) {
+          return common::make_error("Invalid ziplist");
+        }
+        len = LoadBE(data + pos + 1, 4);
+        break;
+      default:
+        is_string = false;
+        if (enc == 0xC0) {
+          len = 2;
+        } else if (enc == 0xD0) {
+          len = 4;
+        } else if (enc == 0xE0) {
+          len = 8;
+        } else if (enc == 0xF0) {
+          len = 3;
+        } else if (enc == 0xFE) {
+          len = 1;
+        } else if (enc >= 0xF1 && enc <= 0xFD) {
+          len = 0;
+        } else {
+          return common::make_error("Invalid ziplist");
+        }
+        break;
+    }
+
+    if (pos + header + len > size) {
+      return common::make_error("Invalid ziplist");
+    }
+    if (elements) {
+      const unsigned char* value = data + pos + header;
+      if (is_string) {
+        elements->push_back(std::string(reinterpret_cast<const char*>(value), len));
+      } else if (len == 0) {
+        elements->push_back(IntegerToString((enc & 0x0F) - 1));
+      } else {
+        elements->push_back(IntegerToString(LoadSignedLE(value, len)));
+      }
+    }
+    pos += header + len;
+    (*count)++;
+  }
+  return common::Error();
+}
+
+// listpack: <total:4><count:2><entry><backlen>...<0xff>
+common::Error ParseListpack(const std::string& blob, uint64_t* count, elements_t* elements) {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(blob.data());
+  const size_t size = blob.size();
+  if (size < 7) {
+    return common::make_error("Invalid listpack");
+  }
+
+  const uint64_t header_count = LoadLE(data + 4, 2);
+  if (!elements && header_count != std::numeric_limits<uint16_t>::max()) {
+    *count = header_count;
+    return common::Error();
+  }
+
+  *count = 0;
+  size_t pos = 6;
+  while (true) {
+    if (pos >= size) {
+      return common::make_error("Invalid listpack");
+    }
+
+    const unsigned char enc = data[pos];
+    if (enc == 0xff) {
+      break;
+    }
+
+    size_t header = 1;
+    size_t len = 0;
+    bool is_string = false;
+    int64_t number = 0;
+    if ((enc & 0x80) == 0) {  // 7 bit uint
+      number = enc & 0x7F;
+    } else if ((enc & 0xC0) == 0x80) {  // 6 bit str
+      is_string = true;
+      len = enc & 0x3F;
+    } else if ((enc & 0xE0) == 0xC0) {  // 13 bit int
+      header = 2;
+      if (pos + header > size) {
+        return common::make_error("Invalid listpack");
+      }
+      const int64_t value = ((enc & 0x1F) << 8) | data[pos + 1];
+      number = value >= (1 << 12) ? value - (1 << 13) : value;
+    } else if ((enc & 0xF0) == 0xE0) {  // 12 bit str
+      header = 2;
+      if (pos + header > size) {
+        return common::make_error("Invalid listpack");
+      }
+      is_string = true;
+      len = ((enc & 0x0F) << 8) | data[pos + 1];
+    } else if (enc == 0xF0) {  // 32 bit str
+      header = 5;
+      if (pos + header > size) {
+        return common::make_error("Invalid listpack");
+      }
+      is_string = true;
+      len = LoadLE(data + pos + 1, 4);
+    } else if (enc >= 0xF1 && enc <= 0xF4) {
+      static const size_t int_sizes[] = {2, 3, 4, 8};
+      len = int_sizes[enc - 0xF1];
+    } else {
+      return common::make_error("Invalid listpack");
+    }
+
+    if (pos + header + len > size) {
+      return common::make_error("Invalid listpack");
+    }
+    if (elements) {
+      const unsigned char* value = data + pos + header;
+      if (is_string) {
+        elements->push_back(std::string(reinterpret_cast<const char*>(value), len));
+      } else if (len != 0) {
+        elements->push_back(IntegerToString(LoadSignedLE(value, len)));
+      } else {
+        elements->push_back(IntegerToString(number));
+      }
+    }
+
+    const size_t entry = header + len;
+    size_t backlen = 5;
+    if (entry < 128) {
+      backlen = 1;
+    } else if (entry < 16383) {  // thresholds of lpEncodeBacklen
+      backlen = 2;
+    } else if (entry < 2097151) {
+      backlen = 3;
+    } else if (entry < 268435455) {
+      backlen = 4;
+    }
+    pos += entry + backlen;
+    (*count)++;
+  }
+  return common::Error();
+}
+
+// intset: <encoding:4><length:4><values>
+common::Error ParseIntset(const std::string& blob, uint64_t* count, elements_t* elements) {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(blob.data());
+  const size_t size = blob.size();
+  if (size < 8) {
+    return common::make_error("Invalid intset");
+  }
+
+  const uint64_t encoding = LoadLE(data, 4);
+  const uint64_t length = LoadLE(data + 4, 4);
+  if ((encoding != 2 && encoding != 4 && encoding != 8) || 8 + encoding * length > size) {
+    return common::make_error("Invalid intset");
+  }
+
+  *count = length;
+  if (elements) {
+    for (uint64_t i = 0; i < length; ++i) {
+      elements->push_back(IntegerToString(LoadSignedLE(data + 8 + i * encoding, encoding)));
+    }
+  }
+  return common::Error();
+}
+
+// zipmap: <zmlen:1><len>key<len><free>value...<0xff>, counts key and value entries
+common::Error ParseZipmap(const std::string& blob, uint64_t* count, elements_t* elements) {
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(blob.data());
+  const size_t size = blob.size();
+  *count = 0;
+  size_t pos = 1;
+  while (true) {
+    if (pos >= size) {
+      return common::make_error("Invalid zipmap");
+    }
+    if (data[pos] == 0xff) {
+      break;
+    }
+
+    const bool is_value = *count % 2 == 1;
+    size_t len = data[pos];
+    size_t header = 1;
+    if (len >= 254) {
+      header = 5;
+      if (pos + header > size) {
+        return common::make_error("Invalid zipmap");
+      }
+      len = LoadLE(data + pos + 1, 4);
+    }
+    size_t free = 0;
+    if (is_value) {
+      if (pos + header >= size) {
+        return common::make_error("Invalid zipmap");
+      }
+      free = data[pos + header];
+      header++;
+    }
+
+    if (pos + header + len + free > size) {
+      return common::make_error("Invalid zipmap");
+    }
+    if (elements) {
+      elements->push_back(std::string(reinterpret_cast<const char*>(data + pos + header), len));
+    }
+    pos += header + len + free;
+    (*count)++;
+  }
+  return common::Error();
+}
+
+typedef common::Error (*blob_parser_t)(const std::string& blob, uint64_t* count, elements_t* elements);
+
+blob_parser_t GetBlobParser(unsigned char type) {
+  switch (type) {
+    case RDB_TYPE_HASH_ZIPMAP:
+      return &ParseZipmap;
+    case RDB_TYPE_LIST_ZIPLIST:
+    case RDB_TYPE_ZSET_ZIPLIST:
+    case RDB_TYPE_HASH_ZIPLIST:
+      return &ParseZiplist;
+    case RDB_TYPE_SET_INTSET:
+      return &ParseIntset;
+    case RDB_TYPE_HASH_LISTPACK:
+    case RDB_TYPE_ZSET_LISTPACK:
+    case RDB_TYPE_SET_LISTPACK:
+    case RDB_TYPE_HASH_LISTPACK_EX:
+      return &ParseListpack;
+    default:
+      return nullptr;
+  }
+}
+
+// entries per element, field value ttl triplets in listpack ex
+uint64_t GetBlobStep(unsigned char type) {
+  switch (type) {
+    case RDB_TYPE_HASH_ZIPMAP:
+    case RDB_TYPE_ZSET_ZIPLIST:
+    case RDB_TYPE_HASH_ZIPLIST:
+    case RDB_TYPE_HASH_LISTPACK:
+    case RDB_TYPE_ZSET_LISTPACK:
+      return 2;
+    case RDB_TYPE_HASH_LISTPACK_EX:
+      return 3;
+    default:
+      return 1;
+  }
+}
+
+bool IsStreamType(unsigned char type) {
+  return type == RDB_TYPE_STREAM_LISTPACKS || type == RDB_TYPE_STREAM_LISTPACKS_2 ||
+         type == RDB_TYPE_STREAM_LISTPACKS_3;
+}
+
+common::Error SkipModuleOpcodes(Cursor* cursor) {
+  while (true) {
+    const uint64_t start = cursor->GetPos();
+    uint64_t opcode;
+    common::Error err = cursor->ReadLength(&opcode);
+    if (err) {
+      return err;
+    }
+
+    uint64_t unused;
+    switch (opcode) {
+      case RDB_MODULE_OPCODE_EOF:
+        return common::Error();
+      case RDB_MODULE_OPCODE_SINT:
+      case RDB_MODULE_OPCODE_UINT:
+        err = cursor->ReadLength(&unused);
+        break;
+      case RDB_MODULE_OPCODE_FLOAT:
+        err = cursor->Skip(4);
+        break;
+      case RDB_MODULE_OPCODE_DOUBLE:
+        err = cursor->Skip(8);
+        break;
+      case RDB_MODULE_OPCODE_STRING:
+        err = cursor->SkipString();
+        break;
+      default:
+        return MakeCorruptedError(start);
+    }
+    if (err) {
+      return err;
+    }
+  }
+}
+
+common::Error SkipLengths(Cursor* cursor, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t unused;
+    common::Error err = cursor->ReadLength(&unused);
+    if (err) {
+      return err;
+    }
+  }
+  return common::Error();
+}
+
+common::Error SkipStream(Cursor* cursor, unsigned char type, uint64_t* length) {
+  uint64_t nodes;
+  common::Error err = cursor->ReadLength(&nodes);
+  if (err) {
+    return err;
+  }
+  for (uint64_t i = 0; i < nodes * 2; ++i) {  // master id and listpack
+    err = cursor->SkipString();
+    if (err) {
+      return err;
+    }
+  }
+
+  err = cursor->ReadLength(length);
+  if (err) {
+    return err;
+  }
+  // last id, since v2 first id, max deleted id and entries added
+  err = SkipLengths(cursor, type == RDB_TYPE_STREAM_LISTPACKS ? 2 : 7);
+  if (err) {
+    return err;
+  }
+
+  uint64_t groups;
+  err = cursor->ReadLength(&groups);
+  if (err) {
+    return err;
+  }
+  for (uint64_t i = 0; i < groups; ++i) {
+    err = cursor->SkipString();
+    if (err) {
+      return err;
+    }
+    // last id, since v2 entries read
+    err = SkipLengths(cursor, type == RDB_TYPE_STREAM_LISTPACKS ? 2 : 3);
+    if (err) {
+      return err;
+    }
+
+    uint64_t pel;
+    err = cursor->ReadLength(&pel);
+    if (err) {
+      return err;
+    }
+    for (uint64_t j = 0; j < pel; ++j) {
+      err = cursor->Skip(16 + 8);  // id and delivery time
+      if (err) {
+        return err;
+      }
+      err = SkipLengths(cursor, 1);  // delivery count
+      if (err) {
+        return err;
+      }
+    }
+
+    uint64_t consumers;
+    err = cursor->ReadLength(&consumers);
+    if (err) {
+      return err;
+    }
+    for (uint64_t j = 0; j < consumers; ++j) {
+      err = cursor->SkipString();
+      if (err) {
+        return err;
+      }
+      // seen time, since v3 active time
+      err = cursor->Skip(type == RDB_TYPE_STREAM_LISTPACKS_3 ? 16 : 8);
+      if (err) {
+        return err;
+      }
+      uint64_t consumer_pel;
+      err = cursor->ReadLength(&consumer_pel);
+      if (err) {
+        return err;
+      }
+      err = cursor->Skip(consumer_pel * 16);
+      if (err) {
+        return err;
+      }
+    }
+  }
+  return common::Error();
+}
+
+// one pass over encoded value: skips it if length and elements are null,
+// zset elements are member score pairs, hash elements are field value pairs
+common::Error ParseValue(Cursor* cursor, unsigned char type, uint64_t* length, elements_t* elements) {
+  const uint64_t start = cursor->GetPos();
+  const bool decode = elements != nullptr;
+  const bool need_length = length != nullptr || decode;
+  uint64_t count = 0;
+  common::Error err;
+
+  if (type == RDB_TYPE_STRING) {
+    if (decode) {
+      std::string value;
+      err = cursor->ReadString(&value);
+      count = value.size();
+      elements->push_back(value);
+    } else {
+      err = cursor->ReadStringSize(&count);
+    }
+  } else if (type == RDB_TYPE_LIST || type == RDB_TYPE_SET || type == RDB_TYPE_ZSET || type == RDB_TYPE_ZSET_2 ||
+             type == RDB_TYPE_HASH || type == RDB_TYPE_HASH_METADATA) {
+    if (type == RDB_TYPE_HASH_METADATA) {
+      err = cursor->Skip(8);  // min expire
+      if (err) {
+        return err;
+      }
+    }
+    err = cursor->ReadLength(&count);
+    if (err) {
+      return err;
+    }
+    for (uint64_t i = 0; i < count && !err; ++i) {
+      if (type == RDB_TYPE_HASH_METADATA) {
+        err = SkipLengths(cursor, 1);  // field ttl
+        if (err) {
+          return err;
+        }
+      }
+
+      std::string value;
+      err = decode ? cursor->ReadString(&value) : cursor->SkipString();
+      if (err) {
+        return err;
+      }
+      if (decode) {
+        elements->push_back(value);
+      }
+
+      if (type == RDB_TYPE_ZSET || type == RDB_TYPE_ZSET_2) {
+        err = type == RDB_TYPE_ZSET ? cursor->ReadDoubleString(&value) : cursor->ReadBinaryDouble(&value);
+      } else if (type == RDB_TYPE_HASH || type == RDB_TYPE_HASH_METADATA) {
+        err = decode ? cursor->ReadString(&value) : cursor->SkipString();
+      } else {
+        continue;
+      }
+      if (!err && decode) {
+        elements->push_back(value);
+      }
+    }
+  } else if (type == RDB_TYPE_LIST_QUICKLIST || type == RDB_TYPE_LIST_QUICKLIST_2) {
+    uint64_t nodes;
+    err = cursor->ReadLength(&nodes);
+    for (uint64_t i = 0; i < nodes && !err; ++i) {
+      uint64_t container = RDB_QUICKLIST_NODE_PACKED;
+      if (type == RDB_TYPE_LIST_QUICKLIST_2) {
+        err = cursor->ReadLength(&container);
+        if (err) {
+          return err;
+        }
+      }
+      if (!need_length) {
+        err = cursor->SkipString();
+        continue;
+      }
+
+      std::string blob;
+      err = cursor->ReadString(&blob);
+      if (err) {
+        return err;
+      }
+      if (container == RDB_QUICKLIST_NODE_PLAIN) {
+        count++;
+        if (decode) {
+          elements->push_back(blob);
+        }
+        continue;
+      }
+
+      uint64_t node_count = 0;
+      err = type == RDB_TYPE_LIST_QUICKLIST ? ParseZiplist(blob, &node_count, elements)
+                                            : ParseListpack(blob, &node_count, elements);
+      count += node_count;
+    }
+  } else if (IsStreamType(type)) {
+    if (decode) {
+      return common::make_error("Stream values are not supported, use DEBUG OBJECT for details");
+    }
+    err = SkipStream(cursor, type, &count);
+  } else if (type == RDB_TYPE_MODULE_2) {
+    if (decode) {
+      return common::make_error("Module values are not supported");
+    }
+    err = SkipLengths(cursor, 1);  // module id
+    if (!err) {
+      err = SkipModuleOpcodes(cursor);
+    }
+  } else if (blob_parser_t parser = GetBlobParser(type)) {
+    if (type == RDB_TYPE_HASH_LISTPACK_EX) {
+      err = cursor->Skip(8);  // min expire
+      if (err) {
+        return err;
+      }
+    }
+    if (!need_length) {
+      err = cursor->SkipString();
+    } else {
+      std::string blob;
+      err = cursor->ReadString(&blob);
+      if (err) {
+        return err;
+      }
+      elements_t entries;
+      err = parser(blob, &count, decode ? &entries : nullptr);
+      if (err) {
+        return err;
+      }
+      const uint64_t step = GetBlobStep(type);
+      count /= step;
+      if (decode) {
+        for (size_t i = 0; i < entries.size(); i += step) {
+          elements->push_back(entries[i]);
+          if (step > 1 && i + 1 < entries.size()) {
+            elements->push_back(entries[i + 1]);
+          }
+        }
+      }
+    }
+  } else {
+    return common::make_error(common::MemSPrintf("Unsupported RDB value type %u at offset %llu",
+                                                 static_cast<unsigned>(type), static_cast<unsigned long long>(start)));
+  }
+
+  if (err) {
+    return err;
+  }
+  if (length) {
+    *length = count;
+  }
+  return common::Error();
+}
+
+bool IsListType(unsigned char type) {
+  return type == RDB_TYPE_LIST || type == RDB_TYPE_LIST_ZIPLIST || type == RDB_TYPE_LIST_QUICKLIST ||
+         type == RDB_TYPE_LIST_QUICKLIST_2;
+}
+
+bool IsSetType(unsigned char type) {
+  return type == RDB_TYPE_SET || type == RDB_TYPE_SET_INTSET || type == RDB_TYPE_SET_LISTPACK;
+}
+
+bool IsZSetType(unsigned char type) {
+  return type == RDB_TYPE_ZSET || type == RDB_TYPE_ZSET_2 || type == RDB_TYPE_ZSET_ZIPLIST ||
+         type == RDB_TYPE_ZSET_LISTPACK;
+}
+
+bool IsHashType(unsigned char type) {
+  return type == RDB_TYPE_HASH || type == RDB_TYPE_HASH_ZIPMAP || type == RDB_TYPE_HASH_ZIPLIST ||
+         type == RDB_TYPE_HASH_LISTPACK || type == RDB_TYPE_HASH_METADATA || type == RDB_TYPE_HASH_LISTPACK_EX;
+}
+
+}  // namespace
+
+MappedFile::MappedFile()
+    : data_(nullptr),
+      size_(0)
+#ifdef OS_WIN
+      ,
+      file_(INVALID_HANDLE_VALUE),
+      mapping_(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+common::Error MappedFile::Open(const std::string& path) {
+  if (IsOpen()) {
+    return common::make_error("File already opened");
+  }
+
+#ifdef OS_WIN
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return common::make_error(common::MemSPrintf("Can't open file: %s", path));
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    CloseHandle(file);
+    return common::make_error(common::MemSPrintf("Invalid file size: %s", path));
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!mapping) {
+    CloseHandle(file);
+    return common::make_error(common::MemSPrintf("Can't map file: %s", path));
+  }
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return common::make_error(common::MemSPrintf("Can't map file: %s", path));
+  }
+
+  file_ = file;
+  mapping_ = mapping;
+  data_ = static_cast<const unsigned char*>(data);
+  size_ = size.QuadPart;
+#else
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return common::make_error(common::MemSPrintf("Can't open file: %s, error: %s", path, strerror(errno)));
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == -1 || st.st_size == 0) {
+    close(fd);
+    return common::make_error(common::MemSPrintf("Invalid file size: %s", path));
+  }
+
+  void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // mapping keeps file referenced
+  if (data == MAP_FAILED) {
+    return common::make_error(common::MemSPrintf("Can't map file: %s, error: %s", path, strerror(errno)));
+  }
+  madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+  data_ = static_cast<const unsigned char*>(data);
+  size_ = st.st_size;
+#endif
+  return common::Error();
+}
+
+void MappedFile::Close() {
+  if (!IsOpen()) {
+    return;
+  }
+
+#ifdef OS_WIN
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_);
+  CloseHandle(file_);
+  mapping_ = nullptr;
+  file_ = INVALID_HANDLE_VALUE;
+#else
+  munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+bool MappedFile::IsOpen() const {
+  return data_ != nullptr;
+}
+
+const unsigned char* MappedFile::GetData() const {
+  return data_;
+}
+
+uint64_t MappedFile::GetSize() const {
+  return size_;
+}
+
+RdbRecord::RdbRecord()
+    : kind(END),
+      offset(0),
+      next_offset(0),
+      db(0),
+      key(),
+      aux_value(),
+      type(RDB_TYPE_STRING),
+      value_offset(0),
+      value_size(0),
+      expire_ms(-1) {}
+
+RdbReader::RdbReader() : file_(), version_(0) {}
+
+common::Error RdbReader::Open(const std::string& path) {
+  common::Error err = file_.Open(path);
+  if (err) {
+    return err;
+  }
+
+  const unsigned char* data = file_.GetData();
+  if (file_.GetSize() < RDB_HEADER_SIZE || memcmp(data, RDB_MAGIC, RDB_MAGIC_SIZE) != 0) {
+    file_.Close();
+    return common::make_error(common::MemSPrintf("Not a RDB file: %s", path));
+  }
+
+  const std::string version_str(reinterpret_cast<const char*>(data) + RDB_MAGIC_SIZE,
+                                RDB_HEADER_SIZE - RDB_MAGIC_SIZE);
+  int version = atoi(version_str.c_str());
+  if (version < min_version || version > max_version) {
+    file_.Close();
+    return common::make_error(common::MemSPrintf("Unsupported RDB version: %s", version_str));
+  }
+
+  version_ = version;
+  return common::Error();
+}
+
+void RdbReader::Close() {
+  file_.Close();
+  version_ = 0;
+}
+
+bool RdbReader::IsOpen() const {
+  return file_.IsOpen();
+}
+
+int RdbReader::GetVersion() const {
+  return version_;
+}
+
+uint64_t RdbReader::GetFileSize() const {
+  return file_.GetSize();
+}
+
+uint64_t RdbReader::GetFirstOffset() const {
+  return RDB_HEADER_SIZE;
+}
+
+common::Error RdbReader::ReadRecord(uint64_t offset, RdbRecord* record) const {
+  if (!record) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (!IsOpen()) {
+    return common::make_error("Not connected");
+  }
+
+  Cursor cursor(file_.GetData(), file_.GetSize(), offset);
+  RdbRecord result;
+  result.offset = offset;
+  while (true) {
+    const uint64_t start = cursor.GetPos();
+    unsigned char opcode;
+    common::Error err = cursor.ReadByte(&opcode);
+    if (err) {
+      return err;
+    }
+
+    const unsigned char* raw = nullptr;
+    switch (opcode) {
+      case RDB_OPCODE_EOF:
+        result.kind = RdbRecord::END;
+        result.next_offset = cursor.GetPos();
+        *record = result;
+        return common::Error();
+      case RDB_OPCODE_SELECTDB:
+        err = cursor.ReadLength(&result.db);
+        if (err) {
+          return err;
+        }
+        result.kind = RdbRecord::SELECT_DB;
+        result.next_offset = cursor.GetPos();
+        *record = result;
+        return common::Error();
+      case RDB_OPCODE_AUX:
+        err = cursor.ReadString(&result.key);
+        if (err) {
+          return err;
+        }
+        err = cursor.ReadString(&result.aux_value);
+        if (err) {
+          return err;
+        }
+        result.kind = RdbRecord::AUX;
+        result.next_offset = cursor.GetPos();
+        *record = result;
+        return common::Error();
+      case RDB_OPCODE_EXPIRETIME:
+        err = cursor.ReadRaw(4, &raw);
+        if (err) {
+          return err;
+        }
+        result.expire_ms = static_cast<int64_t>(LoadLE(raw, 4)) * 1000;
+        break;
+      case RDB_OPCODE_EXPIRETIME_MS:
+        err = cursor.ReadRaw(8, &raw);
+        if (err) {
+          return err;
+        }
+        result.expire_ms = static_cast<int64_t>(LoadLE(raw, 8));
+        break;
+      case RDB_OPCODE_RESIZEDB:
+        err = SkipLengths(&cursor, 2);
+        break;
+      case RDB_OPCODE_SLOT_INFO:
+        err = SkipLengths(&cursor, 3);
+        break;
+      case RDB_OPCODE_FREQ:
+        err = cursor.Skip(1);
+        break;
+      case RDB_OPCODE_IDLE:
+        err = SkipLengths(&cursor, 1);
+        break;
+      case RDB_OPCODE_FUNCTION2:
+        err = cursor.SkipString();
+        break;
+      case RDB_OPCODE_MODULE_AUX:
+        err = SkipLengths(&cursor, 3);  // module id, when opcode, when
+        if (!err) {
+          err = SkipModuleOpcodes(&cursor);
+        }
+        break;
+      case RDB_OPCODE_FUNCTION_PRE_GA:
+        return common::make_error(common::MemSPrintf("Unsupported RDB opcode %u at offset %llu",
+                                                     static_cast<unsigned>(opcode),
+                                                     static_cast<unsigned long long>(start)));
+      default:
+        err = cursor.ReadString(&result.key);
+        if (err) {
+          return err;
+        }
+        result.kind = RdbRecord::KEY_VALUE;
+        result.type = opcode;
+        result.value_offset = cursor.GetPos();
+        err = ParseValue(&cursor, opcode, nullptr, nullptr);
+        if (err) {
+          return err;
+        }
+        result.value_size = cursor.GetPos() - result.value_offset;
+        result.next_offset = cursor.GetPos();
+        *record = result;
+        return common::Error();
+    }
+
+    if (err) {
+      return err;
+    }
+    if (opcode != RDB_OPCODE_EXPIRETIME && opcode != RDB_OPCODE_EXPIRETIME_MS && opcode != RDB_OPCODE_FREQ &&
+        opcode != RDB_OPCODE_IDLE) {
+      result.offset = cursor.GetPos();  // not a key prefix
+    }
+  }
+}
+
+common::Error RdbReader::ReadKey(uint64_t offset, std::string* key) const {
+  if (!key) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (!IsOpen()) {
+    return common::make_error("Not connected");
+  }
+
+  Cursor cursor(file_.GetData(), file_.GetSize(), offset);
+  while (true) {
+    unsigned char opcode;
+    common::Error err = cursor.ReadByte(&opcode);
+    if (err) {
+      return err;
+    }
+
+    if (opcode == RDB_OPCODE_EXPIRETIME) {
+      err = cursor.Skip(4);
+    } else if (opcode == RDB_OPCODE_EXPIRETIME_MS) {
+      err = cursor.Skip(8);
+    } else if (opcode == RDB_OPCODE_FREQ) {
+      err = cursor.Skip(1);
+    } else if (opcode == RDB_OPCODE_IDLE) {
+      err = SkipLengths(&cursor, 1);
+    } else if (opcode >= RDB_OPCODE_SLOT_INFO) {
+      return MakeCorruptedError(offset);
+    } else {
+      return cursor.ReadString(key);
+    }
+
+    if (err) {
+      return err;
+    }
+  }
+}
+
+common::Error RdbReader::GetValueLength(const RdbRecord& record, uint64_t* length) const {
+  if (!length || record.kind != RdbRecord::KEY_VALUE) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (!IsOpen()) {
+    return common::make_error("Not connected");
+  }
+
+  if (record.type == RDB_TYPE_MODULE_2) {
+    *length = 0;
+    return common::Error();
+  }
+
+  Cursor cursor(file_.GetData(), file_.GetSize(), record.value_offset);
+  return ParseValue(&cursor, record.type, length, nullptr);
+}
+
+common::Error RdbReader::ReadValue(const RdbRecord& record, common::Value** out) const {
+  if (!out || record.kind != RdbRecord::KEY_VALUE) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (!IsOpen()) {
+    return common::make_error("Not connected");
+  }
+
+  Cursor cursor(file_.GetData(), file_.GetSize(), record.value_offset);
+  elements_t elements;
+  common::Error err = ParseValue(&cursor, record.type, nullptr, &elements);
+  if (err) {
+    return err;
+  }
+
+  const unsigned char type = record.type;
+  if (type == RDB_TYPE_STRING) {
+    *out = common::Value::CreateStringValue(elements.empty() ? std::string() : elements[0]);
+  } else if (IsListType(type)) {
+    common::ArrayValue* arr = common::Value::CreateArrayValue();
+    for (size_t i = 0; i < elements.size(); ++i) {
+      arr->AppendString(elements[i]);
+    }
+    *out = arr;
+  } else if (IsSetType(type)) {
+    common::SetValue* set = common::Value::CreateSetValue();
+    for (size_t i = 0; i < elements.size(); ++i) {
+      set->Insert(common::Value::CreateStringValue(elements[i]));
+    }
+    *out = set;
+  } else if (IsZSetType(type)) {
+    common::ZSetValue* zset = common::Value::CreateZSetValue();
+    for (size_t i = 0; i + 1 < elements.size(); i += 2) {
+      zset->Insert(common::Value::CreateStringValue(elements[i + 1]), common::Value::CreateStringValue(elements[i]));
+    }
+    *out = zset;
+  } else if (IsHashType(type)) {
+    common::HashValue* hash = common::Value::CreateHashValue();
+    for (size_t i = 0; i + 1 < elements.size(); i += 2) {
+      hash->Insert(common::Value::CreateStringValue(elements[i]), common::Value::CreateStringValue(elements[i + 1]));
+    }
+    *out = hash;
+  } else {
+    DNOTREACHED();
+    return common::make_error("Unknown value type");
+  }
+  return common::Error();
+}
+
+const char* GetTypeName(unsigned char type) {
+  if (type == RDB_TYPE_STRING) {
+    return "string";
+  } else if (IsListType(type)) {
+    return "list";
+  } else if (IsSetType(type)) {
+    return "set";
+  } else if (IsZSetType(type)) {
+    return "zset";
+  } else if (IsHashType(type)) {
+    return "hash";
+  } else if (IsStreamType(type)) {
+    return "stream";
+  } else if (type == RDB_TYPE_MODULE_2) {
+    return "module";
+  }
+  return "unknown";
+}
+
+const char* GetEncodingName(unsigned char type) {
+  switch (type) {
+    case RDB_TYPE_STRING:
+      return "raw";
+    case RDB_TYPE_LIST:
+      return "linkedlist";
+    case RDB_TYPE_SET:
+    case RDB_TYPE_HASH:
+    case RDB_TYPE_HASH_METADATA:
+      return "hashtable";
+    case RDB_TYPE_ZSET:
+    case RDB_TYPE_ZSET_2:
+      return "skiplist";
+    case RDB_TYPE_MODULE_2:
+      return "module";
+    case RDB_TYPE_HASH_ZIPMAP:
+      return "zipmap";
+    case RDB_TYPE_LIST_ZIPLIST:
+    case RDB_TYPE_ZSET_ZIPLIST:
+    case RDB_TYPE_HASH_ZIPLIST:
+      return "ziplist";
+    case RDB_TYPE_SET_INTSET:
+      return "intset";
+    case RDB_TYPE_LIST_QUICKLIST:
+    case RDB_TYPE_LIST_QUICKLIST_2:
+      return "quicklist";
+    case RDB_TYPE_STREAM_LISTPACKS:
+    case RDB_TYPE_STREAM_LISTPACKS_2:
+    case RDB_TYPE_STREAM_LISTPACKS_3:
+      return "stream";
+    case RDB_TYPE_HASH_LISTPACK:
+    case RDB_TYPE_ZSET_LISTPACK:
+    case RDB_TYPE_SET_LISTPACK:
+      return "listpack";
+    case RDB_TYPE_HASH_LISTPACK_EX:
+      return "listpackex";
+    default:
+      return "unknown";
+  }
+}
+
+common::Value::Type GetValueType(unsigned char type) {
+  if (IsListType(type)) {
+    return common::Value::TYPE_ARRAY;
+  } else if (IsSetType(type)) {
+    return common::Value::TYPE_SET;
+  } else if (IsZSetType(type)) {
+    return common::Value::TYPE_ZSET;
+  } else if (IsHashType(type)) {
+    return common::Value::TYPE_HASH;
+  }
+  return common::Value::TYPE_STRING;
+}
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,131 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+
+#include <common/error.h>
+#include <common/macros.h>
+#include <common/value.h>
+
+// value types of redis rdb.h
+#define RDB_TYPE_STRING 0
+#define RDB_TYPE_LIST 1
+#define RDB_TYPE_SET 2
+#define RDB_TYPE_ZSET 3
+#define RDB_TYPE_HASH 4
+#define RDB_TYPE_ZSET_2 5
+#define RDB_TYPE_MODULE_PRE_GA 6
+#define RDB_TYPE_MODULE_2 7
+#define RDB_TYPE_HASH_ZIPMAP 9
+#define RDB_TYPE_LIST_ZIPLIST 10
+#define RDB_TYPE_SET_INTSET 11
+#define RDB_TYPE_ZSET_ZIPLIST 12
+#define RDB_TYPE_HASH_ZIPLIST 13
+#define RDB_TYPE_LIST_QUICKLIST 14
+#define RDB_TYPE_STREAM_LISTPACKS 15
+#define RDB_TYPE_HASH_LISTPACK 16
+#define RDB_TYPE_ZSET_LISTPACK 17
+#define RDB_TYPE_LIST_QUICKLIST_2 18
+#define RDB_TYPE_STREAM_LISTPACKS_2 19
+#define RDB_TYPE_SET_LISTPACK 20
+#define RDB_TYPE_STREAM_LISTPACKS_3 21
+#define RDB_TYPE_HASH_METADATA 24
+#define RDB_TYPE_HASH_LISTPACK_EX 25
+
+namespace fastonosql {
+namespace core {
+namespace rdb {
+
+// read only memory mapping of whole file, pages are loaded by os on access
+class MappedFile {
+ public:
+  MappedFile();
+  ~MappedFile();
+
+  common::Error Open(const std::string& path) WARN_UNUSED_RESULT;
+  void Close();
+
+  bool IsOpen() const;
+  const unsigned char* GetData() const;
+  uint64_t GetSize() const;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(MappedFile);
+
+  const unsigned char* data_;
+  uint64_t size_;
+#ifdef OS_WIN
+  void* file_;
+  void* mapping_;
+#endif
+};
+
+struct RdbRecord {
+  enum Kind { KEY_VALUE, SELECT_DB, AUX, END };
+  RdbRecord();
+
+  Kind kind;
+  uint64_t offset;       // record start, expire and other key prefix opcodes included
+  uint64_t next_offset;  // start of next record
+  uint64_t db;           // SELECT_DB
+  std::string key;       // KEY_VALUE key or AUX field
+  std::string aux_value;
+  unsigned char type;     // KEY_VALUE value type, one of RDB_TYPE_*
+  uint64_t value_offset;  // KEY_VALUE encoded value
+  uint64_t value_size;
+  int64_t expire_ms;  // unix time in msec, -1 if key has no expire
+};
+
+// Redis dump file reader, records are parsed in place from mapping, nothing is cached between calls
+class RdbReader {
+ public:
+  enum { min_version = 1, max_version = 12 };
+
+  RdbReader();
+
+  common::Error Open(const std::string& path) WARN_UNUSED_RESULT;
+  void Close();
+  bool IsOpen() const;
+
+  int GetVersion() const;
+  uint64_t GetFileSize() const;
+  uint64_t GetFirstOffset() const;
+
+  // resize, function, slot and module aux opcodes are skipped, other opcodes are returned as records
+  common::Error ReadRecord(uint64_t offset, RdbRecord* record) const WARN_UNUSED_RESULT;
+  common::Error ReadKey(uint64_t offset, std::string* key) const WARN_UNUSED_RESULT;  // KEY_VALUE key only
+
+  // elements of collection, bytes of string, entries of stream, 0 for modules
+  common::Error GetValueLength(const RdbRecord& record, uint64_t* length) const WARN_UNUSED_RESULT;
+  // streams and modules have no value representation
+  common::Error ReadValue(const RdbRecord& record, common::Value** out) const WARN_UNUSED_RESULT;
+
+ private:
+  MappedFile file_;
+  int version_;
+};
+
+const char* GetTypeName(unsigned char type);      // redis TYPE reply
+const char* GetEncodingName(unsigned char type);  // redis OBJECT ENCODING reply
+common::Value::Type GetValueType(unsigned char type);
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
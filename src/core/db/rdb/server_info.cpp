@@ -0,0 +1,191 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/rdb/server_info.h"
+
+#include <common/convert2string.h>
+
+#include "core/db_traits.h"
+
+#define MARKER "\r\n"
+
+namespace fastonosql {
+namespace core {
+namespace {
+
+const std::vector<Field> g_rdb_common_fields = {Field(RDB_DB_FILE_PATH_LABEL, common::Value::TYPE_STRING),
+                                                Field(RDB_DB_FILE_SIZE_LABEL, common::Value::TYPE_ULONG_INTEGER),
+                                                Field(RDB_VERSION_LABEL, common::Value::TYPE_UINTEGER),
+                                                Field(RDB_REDIS_VERSION_LABEL, common::Value::TYPE_STRING),
+                                                Field(RDB_CTIME_LABEL, common::Value::TYPE_STRING),
+                                                Field(RDB_DATABASES_LABEL, common::Value::TYPE_UINTEGER),
+                                                Field(RDB_KEYS_LABEL, common::Value::TYPE_UINTEGER),
+                                                Field(RDB_EXPIRES_LABEL, common::Value::TYPE_UINTEGER)};
+
+}  // namespace
+
+template <>
+std::vector<common::Value::Type> DBTraits<RDB>::GetSupportedValueTypes() {
+  return {common::Value::TYPE_STRING, common::Value::TYPE_ARRAY, common::Value::TYPE_SET, common::Value::TYPE_ZSET,
+          common::Value::TYPE_HASH};
+}
+
+template <>
+std::vector<info_field_t> DBTraits<RDB>::GetInfoFields() {
+  return {std::make_pair(RDB_STATS_LABEL, g_rdb_common_fields)};
+}
+
+namespace rdb {
+
+ServerInfo::Stats::Stats()
+    : db_path(), db_size(0), rdb_version(0), redis_version(), rdb_ctime(), databases(0), keys(0), expires(0) {}
+
+ServerInfo::Stats::Stats(const std::string& common_text) : Stats() {
+  size_t pos = 0;
+  size_t start = 0;
+
+  while ((pos = common_text.find(MARKER, start)) != std::string::npos) {
+    std::string line = common_text.substr(start, pos - start);
+    size_t delem = line.find_first_of(':');
+    std::string field = line.substr(0, delem);
+    std::string value = line.substr(delem + 1);
+    if (field == RDB_DB_FILE_PATH_LABEL) {
+      db_path = value;
+    } else if (field == RDB_DB_FILE_SIZE_LABEL) {
+      off_t sz;
+      if (common::ConvertFromString(value, &sz)) {
+        db_size = sz;
+      }
+    } else if (field == RDB_VERSION_LABEL) {
+      uint32_t ver;
+      if (common::ConvertFromString(value, &ver)) {
+        rdb_version = ver;
+      }
+    } else if (field == RDB_REDIS_VERSION_LABEL) {
+      redis_version = value;
+    } else if (field == RDB_CTIME_LABEL) {
+      rdb_ctime = value;
+    } else if (field == RDB_DATABASES_LABEL) {
+      uint32_t dbs;
+      if (common::ConvertFromString(value, &dbs)) {
+        databases = dbs;
+      }
+    } else if (field == RDB_KEYS_LABEL) {
+      uint32_t kc;
+      if (common::ConvertFromString(value, &kc)) {
+        keys = kc;
+      }
+    } else if (field == RDB_EXPIRES_LABEL) {
+      uint32_t ec;
+      if (common::ConvertFromString(value, &ec)) {
+        expires = ec;
+      }
+    }
+    start = pos + 2;
+  }
+}
+
+common::Value* ServerInfo::Stats::GetValueByIndex(unsigned char index) const {
+  switch (index) {
+    case 0:
+      return new common::StringValue(db_path);
+    case 1:
+      return new common::FundamentalValue(db_size);
+    case 2:
+      return new common::FundamentalValue(rdb_version);
+    case 3:
+      return new common::StringValue(redis_version);
+    case 4:
+      return new common::StringValue(rdb_ctime);
+    case 5:
+      return new common::FundamentalValue(databases);
+    case 6:
+      return new common::FundamentalValue(keys);
+    case 7:
+      return new common::FundamentalValue(expires);
+    default:
+      break;
+  }
+
+  NOTREACHED();
+  return nullptr;
+}
+
+ServerInfo::ServerInfo() : IServerInfo(RDB) {}
+
+ServerInfo::ServerInfo(const Stats& stats) : IServerInfo(RDB), stats_(stats) {}
+
+common::Value* ServerInfo::GetValueByIndexes(unsigned char property, unsigned char field) const {
+  switch (property) {
+    case 0:
+      return stats_.GetValueByIndex(field);
+    default:
+      break;
+  }
+
+  NOTREACHED();
+  return nullptr;
+}
+
+std::ostream& operator<<(std::ostream& out, const ServerInfo::Stats& value) {
+  return out << RDB_DB_FILE_PATH_LABEL ":" << value.db_path << MARKER << RDB_DB_FILE_SIZE_LABEL ":" << value.db_size
+             << MARKER << RDB_VERSION_LABEL ":" << value.rdb_version << MARKER << RDB_REDIS_VERSION_LABEL ":"
+             << value.redis_version << MARKER << RDB_CTIME_LABEL ":" << value.rdb_ctime << MARKER
+             << RDB_DATABASES_LABEL ":" << value.databases << MARKER << RDB_KEYS_LABEL ":" << value.keys << MARKER
+             << RDB_EXPIRES_LABEL ":" << value.expires << MARKER;
+}
+
+std::ostream& operator<<(std::ostream& out, const ServerInfo& value) {
+  return out << value.ToString();
+}
+
+ServerInfo* MakeRdbServerInfo(const std::string& content) {
+  if (content.empty()) {
+    return nullptr;
+  }
+
+  ServerInfo* result = new ServerInfo;
+  static const std::vector<info_field_t> fields = DBTraits<RDB>::GetInfoFields();
+  std::string word;
+  DCHECK_EQ(fields.size(), 1);
+
+  for (size_t i = 0; i < content.size(); ++i) {
+    word += content[i];
+    if (word == fields[0].first) {
+      std::string part = content.substr(i + 1);
+      result->stats_ = ServerInfo::Stats(part);
+      break;
+    }
+  }
+
+  return result;
+}
+
+std::string ServerInfo::ToString() const {
+  std::stringstream str;
+  str << RDB_STATS_LABEL MARKER << stats_;
+  return str.str();
+}
+
+uint32_t ServerInfo::GetVersion() const {
+  return stats_.rdb_version;
+}
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,69 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "core/server/iserver_info.h"
+
+#define RDB_STATS_LABEL "# Stats"
+
+#define RDB_DB_FILE_PATH_LABEL "db_path"
+#define RDB_DB_FILE_SIZE_LABEL "db_size"
+#define RDB_VERSION_LABEL "rdb_version"
+#define RDB_REDIS_VERSION_LABEL "redis_version"
+#define RDB_CTIME_LABEL "rdb_ctime"
+#define RDB_DATABASES_LABEL "databases"
+#define RDB_KEYS_LABEL "keys"
+#define RDB_EXPIRES_LABEL "expires"
+
+namespace fastonosql {
+namespace core {
+namespace rdb {
+
+class ServerInfo : public IServerInfo {
+ public:
+  struct Stats : IStateField {
+    Stats();
+    explicit Stats(const std::string& common_text);
+    common::Value* GetValueByIndex(unsigned char index) const override;
+
+    std::string db_path;
+    off_t db_size;
+    uint32_t rdb_version;
+    std::string redis_version;  // aux fields, empty for old dumps
+    std::string rdb_ctime;
+    uint32_t databases;
+    uint32_t keys;
+    uint32_t expires;
+  } stats_;
+
+  ServerInfo();
+  explicit ServerInfo(const Stats& stats);
+
+  virtual common::Value* GetValueByIndexes(unsigned char property, unsigned char field) const override;
+  virtual std::string ToString() const override;
+  virtual uint32_t GetVersion() const override;
+};
+
+std::ostream& operator<<(std::ostream& out, const ServerInfo& value);
+
+ServerInfo* MakeRdbServerInfo(const std::string& content);
+
+}  // namespace rdb
+}  // namespace core
+}  // namespace fastonosql
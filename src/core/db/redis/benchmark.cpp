@@ -0,0 +1,259 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/redis/benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <common/convert2string.h>
+#include <common/sprintf.h>
+#include <common/string_util.h>
+
+#include "core/db/redis/db_connection.h"
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+namespace {
+
+const std::chrono::milliseconds kInterruptPollInterval(50);
+
+struct BenchmarkState {
+  BenchmarkState() : issued(0), completed(0), errors(0), finished(0), stop(false), mutex(), latency(), error() {}
+
+  std::atomic<uint64_t> issued;
+  std::atomic<uint64_t> completed;
+  std::atomic<uint64_t> errors;
+  std::atomic<uint64_t> finished;
+  std::atomic<bool> stop;
+
+  std::mutex mutex;  // guards latency and error
+  LatencyHistogram latency;
+  common::Error error;
+};
+
+command_buffer_t MakeKey(const BenchmarkConfig& bconfig, uint64_t index) {
+  return bconfig.key_prefix + common::MemSPrintf("%012llu", static_cast<unsigned long long>(index));
+}
+
+void BenchmarkWorker(const RConfig& config, const BenchmarkConfig& bconfig, uint64_t seed, BenchmarkState* state) {
+  DBConnection connection(nullptr);
+  common::Error err = connection.Connect(config);
+  if (err) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (!state->error) {
+      state->error = err;
+    }
+    state->stop = true;
+    state->finished++;
+    return;
+  }
+
+  std::mt19937_64 generator(seed);
+  std::uniform_int_distribution<uint64_t> key_distribution(0, bconfig.keyspace ? bconfig.keyspace - 1 : 0);
+  std::uniform_int_distribution<int> ratio_distribution(0, 99);
+  const command_buffer_t value(bconfig.data_size, 'x');
+
+  LatencyHistogram latency;
+  std::vector<commands_args_t> cmds;
+  std::vector<CommandsStats::usec_t> latencies;
+  while (!state->stop) {
+    const uint64_t start = state->issued.fetch_add(bconfig.pipeline);
+    if (start >= bconfig.requests) {
+      break;
+    }
+
+    const uint64_t count = std::min(bconfig.pipeline, bconfig.requests - start);
+    cmds.clear();
+    for (uint64_t i = 0; i < count; ++i) {
+      const command_buffer_t key = MakeKey(bconfig, key_distribution(generator));
+      if (ratio_distribution(generator) < bconfig.read_ratio) {
+        cmds.push_back({DB_GET_KEY_COMMAND, key});
+      } else {
+        cmds.push_back({DB_SET_KEY_COMMAND, key, value});
+      }
+    }
+
+    size_t failed = 0;
+    err = connection.ExecuteAsPipeline(cmds, &latencies, &failed);
+    if (err) {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      if (!state->error) {
+        state->error = err;
+      }
+      state->stop = true;
+      break;
+    }
+
+    for (size_t i = 0; i < latencies.size(); ++i) {
+      latency.Record(latencies[i]);
+    }
+    state->completed += latencies.size();
+    state->errors += failed;
+  }
+
+  err = connection.Disconnect();
+  UNUSED(err);
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->latency.Merge(latency);
+  }
+  state->finished++;
+}
+
+}  // namespace
+
+BenchmarkConfig::BenchmarkConfig()
+    : clients(default_clients),
+      requests(default_requests),
+      pipeline(default_pipeline),
+      keyspace(0),
+      data_size(default_data_size),
+      read_ratio(50),
+      key_prefix("key:") {}
+
+BenchmarkResult::BenchmarkResult() : requests(0), errors(0), msec(0), rps(0), latency(), completed(false) {}
+
+common::Error ParseBenchmarkArgs(const commands_args_t& argv, BenchmarkConfig* bconfig) {
+  if (!bconfig) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  BenchmarkConfig lconfig;
+  for (size_t i = 0; i < argv.size(); i += 2) {
+    if (i + 1 >= argv.size()) {
+      return common::make_error(common::MemSPrintf("Missing value for option: %s", argv[i]));
+    }
+
+    const std::string option = common::StringToUpperASCII(argv[i]);
+    const command_buffer_t& value = argv[i + 1];
+    if (option == "PREFIX") {
+      lconfig.key_prefix = value;
+      continue;
+    }
+
+    uint64_t number;
+    if (!common::ConvertFromString(value, &number)) {
+      return common::make_error(common::MemSPrintf("Invalid value for option %s: %s", option, value));
+    }
+
+    if (option == "CLIENTS") {
+      if (number > BenchmarkConfig::max_clients) {
+        return common::make_error(
+            common::MemSPrintf("CLIENTS should be in range [1, %d]", static_cast<int>(BenchmarkConfig::max_clients)));
+      }
+      lconfig.clients = number;
+    } else if (option == "REQUESTS") {
+      lconfig.requests = number;
+    } else if (option == "PIPELINE") {
+      lconfig.pipeline = number;
+    } else if (option == "KEYSPACE") {
+      lconfig.keyspace = number;
+    } else if (option == "DATASIZE") {
+      lconfig.data_size = number;
+    } else if (option == "READRATIO") {
+      if (number > 100) {
+        return common::make_error("READRATIO should be in range [0, 100]");
+      }
+      lconfig.read_ratio = static_cast<int>(number);
+    } else {
+      return common::make_error(common::MemSPrintf("Unknown option: %s", argv[i]));
+    }
+  }
+
+  if (lconfig.clients == 0 || lconfig.requests == 0 || lconfig.pipeline == 0) {
+    return common::make_error("CLIENTS, REQUESTS and PIPELINE should be positive");
+  }
+
+  *bconfig = lconfig;
+  return common::Error();
+}
+
+common::Error RunBenchmark(const RConfig& config,
+                           const BenchmarkConfig& bconfig,
+                           std::function<bool()> is_interrupted,
+                           BenchmarkResult* result) {
+  if (!result) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  BenchmarkState state;
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  std::vector<std::thread> workers;
+  for (uint64_t i = 0; i < bconfig.clients; ++i) {
+    workers.push_back(std::thread(&BenchmarkWorker, std::cref(config), std::cref(bconfig), start_ts + i, &state));
+  }
+
+  bool interrupted = false;
+  while (state.finished < bconfig.clients) {
+    if (!interrupted && is_interrupted && is_interrupted()) {
+      interrupted = true;
+      state.stop = true;
+    }
+    std::this_thread::sleep_for(kInterruptPollInterval);
+  }
+
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+  const CommandsStats::usec_t elapsed = CommandsStats::Now() - start_ts;
+
+  if (state.error) {
+    return state.error;
+  }
+
+  BenchmarkResult lresult;
+  lresult.requests = state.completed;
+  lresult.errors = state.errors;
+  lresult.msec = elapsed / 1000;
+  lresult.rps = elapsed ? static_cast<double>(lresult.requests) * 1000000 / elapsed : 0;
+  lresult.latency = LatencyInfo(state.latency);
+  lresult.completed = !interrupted;
+  *result = lresult;
+  return common::Error();
+}
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+
+std::string ConvertToString(const fastonosql::core::redis::BenchmarkResult& result) {
+  const fastonosql::core::LatencyInfo& latency = result.latency;
+  return MemSPrintf(
+      "%llu requests %s in %.2f seconds\n"
+      "%llu errors\n"
+      "%.2f requests per second\n"
+      "latency (usec): min %llu, p50 %llu, p99 %llu, p99.9 %llu, max %llu, mean %.2f",
+      static_cast<unsigned long long>(result.requests), result.completed ? "completed" : "interrupted",
+      static_cast<double>(result.msec) / 1000,
+      static_cast<unsigned long long>(result.errors), result.rps, static_cast<unsigned long long>(latency.min),
+      static_cast<unsigned long long>(latency.p50), static_cast<unsigned long long>(latency.p99),
+      static_cast<unsigned long long>(latency.p999), static_cast<unsigned long long>(latency.max), latency.mean);
+}
+
+}  // namespace common
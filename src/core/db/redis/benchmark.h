@@ -0,0 +1,82 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <common/error.h>
+
+#include "core/commands_stats.h"  // for LatencyInfo
+#include "core/types.h"           // for commands_args_t
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+struct RConfig;
+
+// redis-benchmark like load: GET/SET mix on random keys
+struct BenchmarkConfig {
+  enum {
+    default_clients = 50,
+    max_clients = 1024,  // thread and connection per client
+    default_requests = 100000,
+    default_pipeline = 1,
+    default_data_size = 3
+  };
+  BenchmarkConfig();
+
+  uint64_t clients;    // parallel connections
+  uint64_t requests;   // total requests for all connections
+  uint64_t pipeline;   // requests per pipeline
+  uint64_t keyspace;   // range of random keys, 0 means one key
+  uint64_t data_size;  // SET value size in bytes
+  int read_ratio;      // percent of GET requests
+  std::string key_prefix;
+};
+
+struct BenchmarkResult {
+  BenchmarkResult();
+
+  uint64_t requests;  // completed
+  uint64_t errors;
+  uint64_t msec;
+  double rps;
+  LatencyInfo latency;  // usec, from pipeline send till reply received
+  bool completed;       // false if interrupted
+};
+
+// [CLIENTS <n>] [REQUESTS <n>] [PIPELINE <n>] [KEYSPACE <n>] [DATASIZE <n>] [READRATIO <percent>] [PREFIX <str>]
+common::Error ParseBenchmarkArgs(const commands_args_t& argv, BenchmarkConfig* bconfig) WARN_UNUSED_RESULT;
+
+// blocks caller, is_interrupted polled from caller thread,
+// interrupt stops workers with partial result
+common::Error RunBenchmark(const RConfig& config,
+                           const BenchmarkConfig& bconfig,
+                           std::function<bool()> is_interrupted,
+                           BenchmarkResult* result) WARN_UNUSED_RESULT;
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+std::string ConvertToString(const fastonosql::core::redis::BenchmarkResult& result);  // human readable report
+}  // namespace common
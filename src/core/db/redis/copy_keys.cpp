@@ -0,0 +1,472 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/redis/copy_keys.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <hiredis/hiredis.h>
+
+#include <common/convert2string.h>
+#include <common/sprintf.h>
+#include <common/string_util.h>
+
+#include "core/connection_types.h"  // for ALL_KEYS_PATTERNS
+#include "core/db/redis/db_connection.h"
+#include "core/logical_dump.h"  // for DumpQueue
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+namespace {
+
+const std::chrono::milliseconds kInterruptPollInterval(50);
+const CommandsStats::usec_t kProgressInterval = 1000000;
+const CommandsStats::usec_t kMaxThrottleSleep = 100000;  // interrupt latency
+
+typedef std::vector<command_buffer_t> keys_batch_t;
+
+struct CopyState {
+  explicit CopyState(size_t queue_size)
+      : queue(queue_size), keys(0), skipped(0), errors(0), bytes(0), finished(0), stop(false), mutex(), error() {}
+
+  DumpQueue<keys_batch_t> queue;
+  std::atomic<uint64_t> keys;
+  std::atomic<uint64_t> skipped;
+  std::atomic<uint64_t> errors;
+  std::atomic<uint64_t> bytes;
+  std::atomic<uint64_t> finished;
+  std::atomic<bool> stop;
+
+  std::mutex mutex;  // guards error and last_error
+  common::Error error;
+  std::string last_error;
+};
+
+void SetFatalError(CopyState* state, common::Error err) {
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (!state->error) {
+      state->error = err;
+    }
+  }
+  state->stop = true;
+  state->queue.Close();
+}
+
+void FreeReplies(const std::vector<redisReply*>& replies) {
+  for (size_t i = 0; i < replies.size(); ++i) {
+    freeReplyObject(replies[i]);
+  }
+}
+
+// PTTL and DUMP of batch in one source round trip, RESTORE of all found keys in one destination round trip
+common::Error RestoreKeys(DBConnection* source,
+                          DBConnection* destination,
+                          const CopyKeysConfig& cconfig,
+                          const keys_batch_t& keys,
+                          CopyState* state) {
+  std::vector<commands_args_t> cmds;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    cmds.push_back({"PTTL", keys[i]});
+    cmds.push_back({"DUMP", keys[i]});
+  }
+
+  std::vector<redisReply*> replies;
+  common::Error err = source->ExecuteAsPipeline(cmds, &replies);
+  if (err) {
+    return err;
+  }
+
+  cmds.clear();
+  for (size_t i = 0; i < keys.size(); ++i) {
+    redisReply* pttl_reply = replies[i * 2];
+    redisReply* dump_reply = replies[i * 2 + 1];
+    if (pttl_reply->type != REDIS_REPLY_INTEGER || dump_reply->type != REDIS_REPLY_STRING) {
+      state->skipped++;  // expired or deleted after scan
+      continue;
+    }
+
+    const long long pttl = pttl_reply->integer > 0 ? pttl_reply->integer : 0;
+    commands_args_t restore = {"RESTORE", keys[i], common::ConvertToString(pttl),
+                               command_buffer_t(dump_reply->str, dump_reply->len)};
+    if (cconfig.replace) {
+      restore.push_back("REPLACE");
+    }
+    cmds.push_back(restore);
+    state->bytes += dump_reply->len;
+  }
+  FreeReplies(replies);
+
+  if (cmds.empty()) {
+    return common::Error();
+  }
+
+  err = destination->ExecuteAsPipeline(cmds, &replies);
+  if (err) {
+    return err;
+  }
+
+  for (size_t i = 0; i < replies.size(); ++i) {
+    redisReply* reply = replies[i];
+    if (reply->type != REDIS_REPLY_ERROR) {
+      state->keys++;
+      continue;
+    }
+
+    const std::string message(reply->str, reply->len);
+    if (message.compare(0, 7, "BUSYKEY") == 0) {
+      state->skipped++;
+      continue;
+    }
+
+    // payload version, MOVED on cluster destination and so on, copy goes on
+    state->errors++;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->last_error = message;
+  }
+  FreeReplies(replies);
+  return common::Error();
+}
+
+// one MIGRATE ... COPY KEYS per batch, data goes directly from source to destination
+common::Error MigrateKeys(DBConnection* source,
+                          const RConfig& destination,
+                          const CopyKeysConfig& cconfig,
+                          const keys_batch_t& keys,
+                          CopyState* state) {
+  commands_args_t migrate = {"MIGRATE",
+                             destination.host.GetHost(),
+                             common::ConvertToString(destination.host.GetPort()),
+                             command_buffer_t(),
+                             common::ConvertToString(destination.db_num),
+                             common::ConvertToString(cconfig.timeout),
+                             "COPY"};
+  if (cconfig.replace) {
+    migrate.push_back("REPLACE");
+  }
+  if (!destination.auth.empty()) {
+    migrate.push_back("AUTH");
+    migrate.push_back(destination.auth);
+  }
+  migrate.push_back("KEYS");
+  migrate.insert(migrate.end(), keys.begin(), keys.end());
+
+  const std::vector<commands_args_t> cmds = {migrate};
+  std::vector<redisReply*> replies;
+  common::Error err = source->ExecuteAsPipeline(cmds, &replies);
+  if (err) {
+    return err;
+  }
+
+  redisReply* reply = replies[0];
+  if (reply->type == REDIS_REPLY_ERROR) {
+    // whole batch is rejected, following ones would fail the same way
+    state->errors += keys.size();
+    err = common::make_error(common::MemSPrintf("MIGRATE failed: %s", std::string(reply->str, reply->len)));
+  } else if (reply->type == REDIS_REPLY_STATUS && std::string(reply->str, reply->len) == "NOKEY") {
+    state->skipped += keys.size();
+  } else {
+    state->keys += keys.size();
+  }
+  FreeReplies(replies);
+  return err;
+}
+
+void CopyWorker(const RConfig& source, const RConfig& destination, const CopyKeysConfig& cconfig, CopyState* state) {
+  DBConnection source_connection(nullptr);
+  DBConnection destination_connection(nullptr);
+  common::Error err = source_connection.Connect(source);
+  if (!err && !cconfig.migrate) {
+    err = destination_connection.Connect(destination);
+  }
+
+  keys_batch_t keys;
+  while (!err && !state->stop && state->queue.Pop(&keys)) {
+    if (cconfig.migrate) {
+      err = MigrateKeys(&source_connection, destination, cconfig, keys, state);
+    } else {
+      err = RestoreKeys(&source_connection, &destination_connection, cconfig, keys, state);
+    }
+  }
+
+  if (err) {
+    SetFatalError(state, err);
+  }
+
+  if (source_connection.IsConnected()) {
+    common::Error derr = source_connection.Disconnect();
+    UNUSED(derr);
+  }
+  if (destination_connection.IsConnected()) {
+    common::Error derr = destination_connection.Disconnect();
+    UNUSED(derr);
+  }
+  state->finished++;
+}
+
+CopyKeysReport MakeReport(const CopyState& state, uint64_t scanned, CommandsStats::usec_t start_ts) {
+  CopyKeysReport report;
+  report.scanned = scanned;
+  report.keys = state.keys;
+  report.skipped = state.skipped;
+  report.errors = state.errors;
+  report.bytes = state.bytes;
+  report.msec = (CommandsStats::Now() - start_ts) / 1000;
+  return report;
+}
+
+}  // namespace
+
+CopyKeysConfig::CopyKeysConfig()
+    : pattern(ALL_KEYS_PATTERNS),
+      count(default_count),
+      workers(default_workers),
+      ops(0),
+      timeout(default_timeout),
+      replace(false),
+      migrate(false) {}
+
+CopyKeysReport::CopyKeysReport()
+    : scanned(0), keys(0), skipped(0), errors(0), bytes(0), msec(0), completed(false), last_error() {}
+
+common::Error ParseCopyKeysArgs(const commands_args_t& argv, RConfig* destination, CopyKeysConfig* cconfig) {
+  if (!destination || !cconfig) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (argv.size() < 2) {
+    return common::make_error("Destination host and port are required");
+  }
+
+  uint64_t port = 0;
+  if (!common::ConvertFromString(argv[1], &port) || port == 0 || port > UINT16_MAX) {
+    return common::make_error(common::MemSPrintf("Invalid destination port: %s", argv[1]));
+  }
+
+  RConfig ldestination;
+  ldestination.host = common::net::HostAndPort(argv[0], static_cast<uint16_t>(port));
+  CopyKeysConfig lconfig;
+  for (size_t i = 2; i < argv.size(); ++i) {
+    const std::string option = common::StringToUpperASCII(argv[i]);
+    if (option == "SSL") {
+      ldestination.is_ssl = true;
+      continue;
+    } else if (option == "REPLACE") {
+      lconfig.replace = true;
+      continue;
+    } else if (option == "MIGRATE") {
+      lconfig.migrate = true;
+      continue;
+    }
+
+    if (i + 1 >= argv.size()) {
+      return common::make_error(common::MemSPrintf("Missing value for option: %s", argv[i]));
+    }
+
+    const command_buffer_t& value = argv[++i];
+    if (option == "AUTH") {
+      ldestination.auth = value;
+      continue;
+    } else if (option == "MATCH") {
+      lconfig.pattern = value;
+      continue;
+    } else if (option == "DB") {
+      if (!common::ConvertFromString(value, &ldestination.db_num) || ldestination.db_num < 0) {
+        return common::make_error(common::MemSPrintf("Invalid value for option %s: %s", option, value));
+      }
+      continue;
+    }
+
+    uint64_t number;
+    if (!common::ConvertFromString(value, &number)) {
+      return common::make_error(common::MemSPrintf("Invalid value for option %s: %s", option, value));
+    }
+
+    if (option == "COUNT") {
+      lconfig.count = number;
+    } else if (option == "WORKERS") {
+      if (number > CopyKeysConfig::max_workers) {
+        return common::make_error(
+            common::MemSPrintf("WORKERS should be in range [1, %d]", static_cast<int>(CopyKeysConfig::max_workers)));
+      }
+      lconfig.workers = number;
+    } else if (option == "OPS") {
+      lconfig.ops = number;
+    } else if (option == "TIMEOUT") {
+      lconfig.timeout = number;
+    } else {
+      return common::make_error(common::MemSPrintf("Unknown option: %s", argv[i - 1]));
+    }
+  }
+
+  if (lconfig.count == 0 || lconfig.workers == 0) {
+    return common::make_error("COUNT and WORKERS should be positive");
+  }
+
+  if (lconfig.migrate && ldestination.is_ssl) {
+    return common::make_error("MIGRATE can't connect to SSL destination");
+  }
+
+  // BUSYKEY of one key rejects rest of batch, so existing keys can't be skipped
+  if (lconfig.migrate && !lconfig.replace) {
+    return common::make_error("MIGRATE requires REPLACE");
+  }
+
+  *destination = ldestination;
+  *cconfig = lconfig;
+  return common::Error();
+}
+
+common::Error RunCopyKeys(const RConfig& source,
+                          const RConfig& destination,
+                          const CopyKeysConfig& cconfig,
+                          std::function<bool()> is_interrupted,
+                          copy_keys_report_observer_t observer,
+                          CopyKeysReport* report) {
+  if (!report) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  // SCAN cursor is sequential, one connection pages keys and workers copy pages
+  DBConnection scanner(nullptr);
+  common::Error err = scanner.Connect(source);
+  if (err) {
+    return err;
+  }
+
+  CopyState state(cconfig.workers * 2);
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  std::vector<std::thread> workers;
+  for (uint64_t i = 0; i < cconfig.workers; ++i) {
+    workers.push_back(
+        std::thread(&CopyWorker, std::cref(source), std::cref(destination), std::cref(cconfig), &state));
+  }
+
+  CommandsStats::usec_t progress_ts = start_ts;
+  auto report_progress = [&](uint64_t scanned) {
+    if (observer && CommandsStats::Now() - progress_ts >= kProgressInterval) {
+      progress_ts = CommandsStats::Now();
+      observer(MakeReport(state, scanned, start_ts));
+    }
+  };
+
+  bool interrupted = false;
+  bool completed = false;
+  uint64_t scanned = 0;
+  uint64_t cursor = 0;
+  while (!state.stop) {
+    if (is_interrupted && is_interrupted()) {
+      interrupted = true;
+      break;
+    }
+
+    keys_batch_t keys;
+    uint64_t cursor_out = 0;
+    err = scanner.Scan(cursor, cconfig.pattern, cconfig.count, &keys, &cursor_out);
+    if (err) {
+      SetFatalError(&state, err);
+      break;
+    }
+
+    scanned += keys.size();
+    if (!keys.empty() && !state.queue.Push(&keys)) {
+      break;  // closed by failed worker
+    }
+
+    cursor = cursor_out;
+    if (cursor == 0) {
+      completed = true;
+      break;
+    }
+
+    report_progress(scanned);
+
+    // keep average rate under OPS, sleep is split to react on interrupt
+    if (cconfig.ops) {
+      const CommandsStats::usec_t planned_ts = start_ts + scanned * 1000000 / cconfig.ops;
+      CommandsStats::usec_t now = CommandsStats::Now();
+      while (now < planned_ts && !(is_interrupted && is_interrupted())) {
+        std::this_thread::sleep_for(std::chrono::microseconds(std::min(planned_ts - now, kMaxThrottleSleep)));
+        now = CommandsStats::Now();
+      }
+    }
+  }
+
+  // workers drain queued pages unless interrupted
+  if (interrupted) {
+    state.stop = true;
+  }
+  state.queue.Close();
+  while (state.finished < cconfig.workers) {
+    if (!interrupted && is_interrupted && is_interrupted()) {
+      interrupted = true;
+      state.stop = true;
+    }
+    report_progress(scanned);
+    std::this_thread::sleep_for(kInterruptPollInterval);
+  }
+
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+
+  common::Error derr = scanner.Disconnect();
+  UNUSED(derr);
+
+  if (state.error) {
+    return state.error;
+  }
+
+  CopyKeysReport lreport = MakeReport(state, scanned, start_ts);
+  lreport.completed = completed && !interrupted;
+  lreport.last_error = state.last_error;
+  *report = lreport;
+  return common::Error();
+}
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+
+std::string ConvertToString(const fastonosql::core::redis::CopyKeysReport& report) {
+  const double seconds = static_cast<double>(report.msec) / 1000;
+  std::string result = MemSPrintf(
+      "%s: %llu keys copied, %llu skipped, %llu errors of %llu scanned, %llu bytes, %.2f seconds\n"
+      "%.2f keys per second, %.2f MB per second",
+      report.completed ? "completed" : "interrupted", static_cast<unsigned long long>(report.keys),
+      static_cast<unsigned long long>(report.skipped), static_cast<unsigned long long>(report.errors),
+      static_cast<unsigned long long>(report.scanned), static_cast<unsigned long long>(report.bytes), seconds,
+      report.msec ? static_cast<double>(report.keys) / seconds : 0,
+      report.msec ? static_cast<double>(report.bytes) / (1024 * 1024) / seconds : 0);
+  if (!report.last_error.empty()) {
+    result += "\nlast error: " + report.last_error;
+  }
+  return result;
+}
+
+}  // namespace common
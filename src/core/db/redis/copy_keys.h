@@ -0,0 +1,90 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <common/error.h>
+
+#include "core/types.h"  // for commands_args_t
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+struct RConfig;
+
+// server to server copy: pipelined PTTL/DUMP on source and RESTORE on destination,
+// or server side MIGRATE ... COPY KEYS when source can reach destination
+struct CopyKeysConfig {
+  enum {
+    default_count = 1000,
+    default_workers = 4,
+    max_workers = 64,  // thread and connection pair per worker
+    default_timeout = 5000
+  };
+  CopyKeysConfig();
+
+  std::string pattern;
+  uint64_t count;    // SCAN COUNT, keys of one page are copied as one batch
+  uint64_t workers;  // parallel source/destination connection pairs
+  uint64_t ops;      // scanned keys per second for all workers, 0 means unlimited
+  uint64_t timeout;  // MIGRATE timeout in msec
+  bool replace;      // overwrite existing destination keys, otherwise they are skipped
+  bool migrate;      // requires replace, MIGRATE fails whole batch on existing key
+};
+
+struct CopyKeysReport {
+  CopyKeysReport();
+
+  uint64_t scanned;
+  uint64_t keys;     // copied
+  uint64_t skipped;  // expired before DUMP or existing on destination
+  uint64_t errors;
+  uint64_t bytes;  // DUMP payloads, unknown for MIGRATE
+  uint64_t msec;
+  bool completed;
+  std::string last_error;  // of failed RESTORE
+};
+
+typedef std::function<void(const CopyKeysReport& report)> copy_keys_report_observer_t;
+
+// <host> <port> [AUTH <password>] [DB <n>] [SSL] [MATCH <pattern>] [COUNT <n>] [WORKERS <n>] [OPS <n>]
+// [TIMEOUT <msec>] [REPLACE] [MIGRATE]
+common::Error ParseCopyKeysArgs(const commands_args_t& argv,
+                                RConfig* destination,
+                                CopyKeysConfig* cconfig) WARN_UNUSED_RESULT;
+
+// blocks caller, scans source from own connection, is_interrupted and observer are called from caller thread,
+// interrupt stops copy with partial report
+common::Error RunCopyKeys(const RConfig& source,
+                          const RConfig& destination,
+                          const CopyKeysConfig& cconfig,
+                          std::function<bool()> is_interrupted,
+                          copy_keys_report_observer_t observer,
+                          CopyKeysReport* report) WARN_UNUSED_RESULT;
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+std::string ConvertToString(const fastonosql::core::redis::CopyKeysReport& report);  // human readable report
+}  // namespace common
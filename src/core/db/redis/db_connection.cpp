@@ -20,6 +20,11 @@
 
 #include <errno.h>
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 extern "C" {
 #include "sds.h"
 }
@@ -63,7 +68,10 @@ namespace {
 
 const struct RedisInit {
   RedisInit() { libssh2_init(0); }
-  ~RedisInit() { libssh2_exit(); }
+  ~RedisInit() {
+    redisFreeIdleSshSessions();
+    libssh2_exit();
+  }
 } rInit;
 
 bool isPipeLineCommand(const char* command) {
@@ -81,6 +89,17 @@ bool isPipeLineCommand(const char* command) {
   return !skip;
 }
 
+// native commands handled by plain CommonExec: they don't switch database, block, delete, rename
+// or expire keys, so no client bookkeeping is lost when they are sent in a pipeline
+const char* const kSilentPipelineCommands[] = {
+    "append", "bitcount", "bitfield", "bitop", "bitpos", "dump", "echo", "exists", "geoadd", "geodist", "geohash",
+    "geopos", "getbit", "getrange", "getset", "hdel", "hexists", "hget", "hincrby", "hincrbyfloat", "hkeys", "hlen",
+    "hmget", "hset", "hsetnx", "hstrlen", "hvals", "lindex", "linsert", "llen", "lpop", "lpushx", "lrem", "lset",
+    "ltrim", "pfadd", "pfcount", "pfmerge", "ping", "rpop", "rpoplpush", "rpush", "rpushx", "scard", "sdiff",
+    "setbit", "setrange", "sinter", "sismember", "smove", "spop", "srandmember", "srem", "strlen", "sunion", "type",
+    "zcard", "zcount", "zincrby", "zlexcount", "zrangebylex", "zrangebyscore", "zrank", "zrem", "zremrangebylex",
+    "zremrangebyrank", "zremrangebyscore", "zrevrange", "zrevrangebylex", "zrevrangebyscore", "zrevrank", "zscore"};
+
 }  // namespace
 
 namespace fastonosql {
@@ -1277,6 +1296,24 @@ const ConstantCommandsArray g_commands = {
                   INFINITE_COMMAND_ARGS,
                   CommandInfo::Native,
                   &CommandsApi::PunSubscribe),
+    CommandHolder(DB_EXPORT_COMMAND,
+                  "<path> [MATCH <pattern>] [COUNT <n>] [COMPRESS] [CHECKSUM] [RESUME]",
+                  "Stream keys with values and ttl into engine independent dump file",
+                  UNDEFINED_SINCE,
+                  "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                  1,
+                  7,
+                  CommandInfo::Extended,
+                  &CommandsApi::Export),
+    CommandHolder(DB_IMPORT_COMMAND,
+                  "<path> [FROM <block>]",
+                  "Load keys from dump file made by EXPORT with batched writes",
+                  UNDEFINED_SINCE,
+                  "IMPORT ~/keys.dump",
+                  1,
+                  2,
+                  CommandInfo::Extended,
+                  &CommandsApi::Import),
     CommandHolder(DB_QUIT_COMMAND,
                   "-",
                   "Close the connection",
@@ -2326,6 +2363,37 @@ const ConstantCommandsArray g_commands = {
                   0,
                   CommandInfo::Extended,
                   &CommandsApi::MemoryMallocStats),
+    CommandHolder("BENCHMARK",
+                  "[CLIENTS <n>] [REQUESTS <n>] [PIPELINE <n>] [KEYSPACE <n>] [DATASIZE <n>] [READRATIO <percent>] "
+                  "[PREFIX <prefix>]",
+                  "Run GET/SET load against the server from parallel connections and report throughput and latency",
+                  UNDEFINED_SINCE,
+                  "BENCHMARK CLIENTS 50 REQUESTS 100000 PIPELINE 16 KEYSPACE 100000 DATASIZE 64 READRATIO 80",
+                  0,
+                  14,
+                  CommandInfo::Extended,
+                  &CommandsApi::Benchmark),
+    CommandHolder("COPYKEYS",
+                  "<host> <port> [AUTH <password>] [DB <n>] [SSL] [MATCH <pattern>] [COUNT <n>] [WORKERS <n>] "
+                  "[OPS <n>] [TIMEOUT <msec>] [REPLACE] [MIGRATE]",
+                  "Copy keys of current database to other server with pipelined PTTL/DUMP and RESTORE or server side "
+                  "MIGRATE COPY from parallel connections and report progress and throughput",
+                  UNDEFINED_SINCE,
+                  "COPYKEYS 10.0.0.2 6379 DB 1 MATCH user:* COUNT 500 WORKERS 8 OPS 50000 REPLACE",
+                  2,
+                  17,
+                  CommandInfo::Extended,
+                  &CommandsApi::CopyKeys),
+    CommandHolder("MEMKEYS",
+                  "[MATCH <pattern>] [COUNT <n>] [SAMPLES <n>] [TOP <n>] [OPS <n>] [DEPTH <n>] [SEPARATOR <str>] "
+                  "[BY MEMORY|LENGTH]",
+                  "Scan keys with MEMORY USAGE and report biggest keys and memory per namespace prefix and type",
+                  UNDEFINED_SINCE,
+                  "MEMKEYS MATCH user:* COUNT 1000 SAMPLES 5 TOP 50 OPS 10000 DEPTH 2 SEPARATOR : BY MEMORY",
+                  0,
+                  16,
+                  CommandInfo::Extended,
+                  &CommandsApi::MemKeys),
     CommandHolder("SWAPDB",
                   "<db1> <db2> [arg]",
                   "Swap db",
@@ -2986,7 +3054,6 @@ const ConstantCommandsArray& CDBConnection<redis::NativeConnection, redis::RConf
 }  // namespace internal
 
 namespace redis {
-namespace {
 
 common::Error ValueFromReplay(redisReply* r, common::Value** out) {
   if (!out || !r) {
@@ -3036,6 +3103,11 @@ common::Error ValueFromReplay(redisReply* r, common::Value** out) {
   return common::Error();
 }
 
+namespace {
+
+// silent subscribers check interrupt at least this often
+const int kListenPollIntervalMsec = 100;
+
 common::Error PrintRedisContextError(redisContext* context) {
   if (!context) {
     DNOTREACHED();
@@ -3137,6 +3209,85 @@ common::Error ExecRedisCommand(redisContext* c, const commands_args_t& argv, red
   return err;
 }
 
+// measures time and traffic of request/reply round trip
+class NetworkMeter {
+ public:
+  NetworkMeter(redisContext* context, CommandsStats* stats)
+      : context_(context),
+        stats_(stats),
+        start_ts_(CommandsStats::Now()),
+        read_(context->total_read),
+        written_(context->total_written) {}
+
+  ~NetworkMeter() {
+    stats_->RecordNetwork(CommandsStats::Now() - start_ts_, context_->total_written - written_,
+                          context_->total_read - read_);
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(NetworkMeter);
+
+  redisContext* const context_;
+  CommandsStats* const stats_;
+  const CommandsStats::usec_t start_ts_;
+  const unsigned long long read_;
+  const unsigned long long written_;
+};
+
+// one pipeline, replies are owned by caller, nothing is returned on error
+common::Error ExecRedisPipeline(redisContext* context,
+                                const std::vector<commands_args_t>& cmds,
+                                std::vector<redisReply*>* replies) {
+  std::vector<const char*> argvc;
+  std::vector<size_t> argvlen;
+  for (size_t i = 0; i < cmds.size(); ++i) {
+    const commands_args_t& argv = cmds[i];
+    argvc.clear();
+    argvlen.clear();
+    for (size_t j = 0; j < argv.size(); ++j) {
+      argvc.push_back(argv[j].data());
+      argvlen.push_back(argv[j].size());
+    }
+    if (redisAppendCommandArgv(context, static_cast<int>(argvc.size()), argvc.data(), argvlen.data()) == REDIS_ERR) {
+      return PrintRedisContextError(context);
+    }
+  }
+
+  std::vector<redisReply*> lreplies;
+  for (size_t i = 0; i < cmds.size(); ++i) {
+    void* reply = NULL;
+    if (redisGetReply(context, &reply) == REDIS_ERR) {
+      for (size_t j = 0; j < lreplies.size(); ++j) {
+        freeReplyObject(lreplies[j]);
+      }
+      return PrintRedisContextError(context);
+    }
+    lreplies.push_back(static_cast<redisReply*>(reply));
+  }
+
+  *replies = lreplies;
+  return common::Error();
+}
+
+// length command for reply of TYPE, empty if type has no length
+command_buffer_t GetLengthCommand(const std::string& type) {
+  if (type == "string") {
+    return "STRLEN";
+  } else if (type == "list") {
+    return "LLEN";
+  } else if (type == "set") {
+    return "SCARD";
+  } else if (type == "zset") {
+    return "ZCARD";
+  } else if (type == "hash") {
+    return "HLEN";
+  } else if (type == "stream") {
+    return "XLEN";
+  }
+
+  return command_buffer_t();
+}
+
 common::Error AuthContext(redisContext* context, const std::string& auth_str) {
   if (auth_str.empty()) {
     return common::Error();
@@ -3151,13 +3302,7 @@ common::Error AuthContext(redisContext* context, const std::string& auth_str) {
   return common::Error();
 }
 
-}  // namespace
-
-RConfig::RConfig(const Config& config, const SSHInfo& sinfo) : Config(config), ssh_info(sinfo) {}
-
-RConfig::RConfig() : Config(), ssh_info() {}
-
-common::Error CreateConnection(const RConfig& config, NativeConnection** context) {
+common::Error CreateContext(const RConfig& config, const struct timeval* timeout, NativeConnection** context) {
   if (!context) {
     return common::make_error_inval();
   }
@@ -3184,8 +3329,17 @@ common::Error CreateConnection(const RConfig& config, NativeConnection** context
     const char* public_key = sinfo.public_key.empty() ? NULL : sinfo.public_key.c_str();
     const char* private_key = sinfo.private_key.empty() ? NULL : sinfo.private_key.c_str();
     const char* passphrase = sinfo.passphrase.empty() ? NULL : sinfo.passphrase.c_str();
-    lcontext = redisConnect(host, port, ssh_address, ssh_port, username, password, public_key, private_key, passphrase,
-                            is_ssl, curM);
+    const bool is_ssh = ssh_address && curM != SSH_UNKNOWN;
+    if (timeout && !is_ssl && !is_ssh) {
+      lcontext = redisConnectWithTimeout(host, port, *timeout);
+      if (lcontext && !lcontext->err) {
+        // replies are bounded too, hung node should not stall the caller
+        redisSetTimeout(lcontext, *timeout);
+      }
+    } else {
+      lcontext = redisConnect(host, port, ssh_address, ssh_port, username, password, public_key, private_key,
+                              passphrase, is_ssl, curM);
+    }
   }
 
   if (!lcontext) {
@@ -3212,6 +3366,35 @@ common::Error CreateConnection(const RConfig& config, NativeConnection** context
   return common::Error();
 }
 
+// plain tcp discovery of unreachable node fails after this instead of OS connect timeout
+const struct timeval kDiscoveryTimeout = {3, 0};
+
+common::Error CreateDiscoveryContext(const RConfig& config, NativeConnection** context) {
+  common::Error err = CreateContext(config, &kDiscoveryTimeout, context);
+  if (err) {
+    return err;
+  }
+
+  err = AuthContext(*context, config.auth);
+  if (err) {
+    redisFree(*context);
+    *context = NULL;
+    return err;
+  }
+
+  return common::Error();
+}
+
+}  // namespace
+
+RConfig::RConfig(const Config& config, const SSHInfo& sinfo) : Config(config), ssh_info(sinfo) {}
+
+RConfig::RConfig() : Config(), ssh_info() {}
+
+common::Error CreateConnection(const RConfig& config, NativeConnection** context) {
+  return CreateContext(config, NULL, context);
+}
+
 common::Error TestConnection(const RConfig& rconfig) {
   redisContext* context = NULL;
   common::Error err = CreateConnection(rconfig, &context);
@@ -3235,17 +3418,11 @@ common::Error DiscoveryClusterConnection(const RConfig& rconfig, std::vector<Ser
   }
 
   redisContext* context = NULL;
-  common::Error err = CreateConnection(rconfig, &context);
+  common::Error err = CreateDiscoveryContext(rconfig, &context);
   if (err) {
     return err;
   }
 
-  err = AuthContext(context, rconfig.auth);
-  if (err) {
-    redisFree(context);
-    return err;
-  }
-
   /* Send the GET CLUSTER command. */
   redisReply* reply = reinterpret_cast<redisReply*>(redisCommand(context, GET_SERVER_TYPE));
   if (!reply) {
@@ -3267,20 +3444,63 @@ common::Error DiscoveryClusterConnection(const RConfig& rconfig, std::vector<Ser
   return err;
 }
 
+common::Error DiscoveryClusterConnection(const std::vector<RConfig>& nodes, discovery_cluster_observer_t observer) {
+  if (nodes.empty() || !observer) {
+    return common::make_error_inval();
+  }
+
+  std::mutex mutex;  // guards observer calls and failures
+  size_t failed = 0;
+  common::Error first_failure;
+  auto discovery = [&](const RConfig& node) {
+    std::vector<ServerDiscoveryClusterInfoSPtr> infos;
+    common::Error err = DiscoveryClusterConnection(node, &infos);
+    std::unique_lock<std::mutex> lock(mutex);
+    if (err) {
+      if (!first_failure) {
+        first_failure = err;
+      }
+      failed++;
+      return;
+    }
+    observer(infos);
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < nodes.size(); ++i) {
+    workers.push_back(std::thread(discovery, std::cref(nodes[i])));
+  }
+  discovery(nodes[0]);
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+
+  if (failed == nodes.size()) {
+    return first_failure;
+  }
+
+  return common::Error();
+}
+
 common::Error DiscoverySentinelConnection(const RConfig& rconfig, std::vector<ServerDiscoverySentinelInfoSPtr>* infos) {
   if (!infos) {
     return common::make_error_inval();
   }
 
-  redisContext* context = NULL;
-  common::Error err = CreateConnection(rconfig, &context);
-  if (err) {
-    return err;
+  auto collect = [infos](const std::vector<ServerDiscoverySentinelInfoSPtr>& linfos) {
+    infos->insert(infos->end(), linfos.begin(), linfos.end());
+  };
+  return DiscoverySentinelConnection(rconfig, collect);
+}
+
+common::Error DiscoverySentinelConnection(const RConfig& rconfig, discovery_sentinel_observer_t observer) {
+  if (!observer) {
+    return common::make_error_inval();
   }
 
-  err = AuthContext(context, rconfig.auth);
+  redisContext* context = NULL;
+  common::Error err = CreateDiscoveryContext(rconfig, &context);
   if (err) {
-    redisFree(context);
     return err;
   }
 
@@ -3291,6 +3511,7 @@ common::Error DiscoverySentinelConnection(const RConfig& rconfig, std::vector<Se
     return common::make_error("I/O error");
   }
 
+  std::vector<ServerDiscoverySentinelInfoSPtr> masters;
   for (size_t i = 0; i < masters_reply->elements; ++i) {
     redisReply* master_info = masters_reply->element[i];
     ServerCommonInfo sinf;
@@ -3299,45 +3520,75 @@ common::Error DiscoverySentinelConnection(const RConfig& rconfig, std::vector<Se
       continue;
     }
 
-    const char* master_name = sinf.name.c_str();
     ServerDiscoverySentinelInfoSPtr sent(new DiscoverySentinelInfo(sinf));
-    infos->push_back(sent);
-    /* Send the GET SLAVES command. */
-    redisReply* reply =
-        reinterpret_cast<redisReply*>(redisCommand(context, GET_SENTINEL_SLAVES_PATTERN_1ARGS_S, master_name));
-    if (!reply) {
-      freeReplyObject(masters_reply);
+    masters.push_back(sent);
+  }
+  freeReplyObject(masters_reply);
+
+  if (masters.empty()) {
+    redisFree(context);
+    return common::Error();
+  }
+
+  // masters are shown while slaves requests are in flight, all of them in one round trip
+  observer(masters);
+  for (size_t i = 0; i < masters.size(); ++i) {
+    const std::string master_name = masters[i]->GetName();
+    if (redisAppendCommand(context, GET_SENTINEL_SLAVES_PATTERN_1ARGS_S, master_name.c_str()) != REDIS_OK) {
+      redisFree(context);
+      return common::make_error("I/O error");
+    }
+  }
+
+  for (size_t i = 0; i < masters.size(); ++i) {
+    void* lreply = NULL;
+    if (redisGetReply(context, &lreply) != REDIS_OK || !lreply) {
       redisFree(context);
       return common::make_error("I/O error");
     }
 
+    redisReply* reply = reinterpret_cast<redisReply*>(lreply);
     if (reply->type == REDIS_REPLY_ARRAY) {
+      std::vector<ServerDiscoverySentinelInfoSPtr> slaves;
       for (size_t j = 0; j < reply->elements; ++j) {
         redisReply* server_info = reply->element[j];
         ServerCommonInfo slsinf;
-        lerr = MakeServerCommonInfo(server_info, &slsinf);
+        common::Error lerr = MakeServerCommonInfo(server_info, &slsinf);
         if (lerr) {
           continue;
         }
         ServerDiscoverySentinelInfoSPtr lsent(new DiscoverySentinelInfo(slsinf));
-        infos->push_back(lsent);
+        slaves.push_back(lsent);
+      }
+      if (!slaves.empty()) {
+        observer(slaves);
       }
     } else if (reply->type == REDIS_REPLY_ERROR) {
+      // remaining replies are discarded together with context
+      err = common::make_error(std::string(reply->str, reply->len));
       freeReplyObject(reply);
-      freeReplyObject(masters_reply);
       redisFree(context);
-      return common::make_error(std::string(reply->str, reply->len));
+      return err;
     } else {
       DNOTREACHED();
     }
     freeReplyObject(reply);
   }
 
-  freeReplyObject(masters_reply);
   redisFree(context);
   return common::Error();
 }
 
+bool IsSilentPipelineCommand(const command_buffer_t& command_name) {
+  for (size_t i = 0; i < SIZEOFMASS(kSilentPipelineCommands); ++i) {
+    if (strcasecmp(command_name.c_str(), kSilentPipelineCommands[i]) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 DBConnection::DBConnection(CDBConnectionClient* client)
     : base_class(client, new CommandTranslator(base_class::GetCommands())), is_auth_(false), cur_db_(-1) {}
 
@@ -3691,7 +3942,7 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   command_buffer_t get_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   common::Error err = tran->LoadKeyCommand(key, common::Value::TYPE_STRING, &get_cmd);
@@ -3706,11 +3957,13 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
   }
 
   if (reply->type == REDIS_REPLY_NIL) {
-    // key_t key_str = key.GetKey();
-    return GenerateError(DB_GET_KEY_COMMAND, "key not found.");
+    freeReplyObject(reply);
+    *found = false;
+    return common::Error();
   }
 
   CHECK(reply->type == REDIS_REPLY_STRING) << "Unexpected replay type: " << reply->type;
+  *found = true;
   common::Value* val = common::Value::CreateStringValue(reply->str);
   *loaded_key = NDbKValue(key, NValue(val));
   freeReplyObject(reply);
@@ -3781,6 +4034,216 @@ common::Error DBConnection::GetTTLImpl(const NKey& key, ttl_t* ttl) {
   return common::Error();
 }
 
+common::Error DBConnection::LoadKeysImpl(const NKeys& keys, std::vector<NDbKValue>* loaded_keys) {
+  if (keys.empty()) {
+    return common::Error();
+  }
+
+  // TYPE and TTL for whole page, then values of known types
+  std::vector<commands_args_t> cmds;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const command_buffer_t key_str = keys[i].GetKey().GetKeyData();
+    cmds.push_back({"TYPE", key_str});
+    cmds.push_back({"TTL", key_str});
+  }
+
+  std::vector<redisReply*> replies;
+  common::Error err;
+  {
+    NetworkMeter meter(connection_.handle_, &commands_stats_);
+    err = ExecRedisPipeline(connection_.handle_, cmds, &replies);
+  }
+  if (err) {
+    return err;
+  }
+  commands_stats_.RecordPipeline(cmds.size());
+
+  std::vector<std::string> types(keys.size());
+  std::vector<ttl_t> ttls(keys.size(), NO_TTL);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    redisReply* type_reply = replies[i * 2];
+    redisReply* ttl_reply = replies[i * 2 + 1];
+    if (type_reply->type == REDIS_REPLY_STATUS) {
+      types[i] = std::string(type_reply->str, type_reply->len);
+    }
+    if (ttl_reply->type == REDIS_REPLY_INTEGER && ttl_reply->integer > 0) {
+      ttls[i] = ttl_reply->integer;
+    }
+  }
+  for (size_t i = 0; i < replies.size(); ++i) {
+    freeReplyObject(replies[i]);
+  }
+
+  cmds.clear();
+  std::vector<size_t> indexes;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const command_buffer_t key_str = keys[i].GetKey().GetKeyData();
+    if (types[i] == "string") {
+      cmds.push_back({"GET", key_str});
+    } else if (types[i] == "list") {
+      cmds.push_back({"LRANGE", key_str, "0", "-1"});
+    } else if (types[i] == "set") {
+      cmds.push_back({"SMEMBERS", key_str});
+    } else if (types[i] == "zset") {
+      cmds.push_back({"ZRANGE", key_str, "0", "-1", "WITHSCORES"});
+    } else if (types[i] == "hash") {
+      cmds.push_back({"HGETALL", key_str});
+    } else {
+      continue;  // expired, streams and module types
+    }
+    indexes.push_back(i);
+  }
+
+  if (cmds.empty()) {
+    return common::Error();
+  }
+
+  {
+    NetworkMeter meter(connection_.handle_, &commands_stats_);
+    err = ExecRedisPipeline(connection_.handle_, cmds, &replies);
+  }
+  if (err) {
+    return err;
+  }
+  commands_stats_.RecordPipeline(cmds.size());
+
+  for (size_t i = 0; i < replies.size(); ++i) {
+    redisReply* reply = replies[i];
+    const std::string& type = types[indexes[i]];
+    common::Value* value = nullptr;
+    if (reply->type == REDIS_REPLY_STRING && type == "string") {
+      value = common::Value::CreateStringValue(std::string(reply->str, reply->len));
+    } else if (reply->type == REDIS_REPLY_ARRAY && reply->elements != 0) {
+      // key could be deleted or changed between pipelines, such replies are skipped
+      std::vector<std::string> elements;
+      for (size_t j = 0; j < reply->elements; ++j) {
+        redisReply* element = reply->element[j];
+        elements.push_back(element->str ? std::string(element->str, element->len) : std::string());
+      }
+
+      if (type == "list") {
+        common::ArrayValue* arr = common::Value::CreateArrayValue();
+        for (size_t j = 0; j < elements.size(); ++j) {
+          arr->AppendString(elements[j]);
+        }
+        value = arr;
+      } else if (type == "set") {
+        common::SetValue* set = common::Value::CreateSetValue();
+        for (size_t j = 0; j < elements.size(); ++j) {
+          set->Insert(common::Value::CreateStringValue(elements[j]));
+        }
+        value = set;
+      } else if (type == "zset") {
+        common::ZSetValue* zset = common::Value::CreateZSetValue();
+        for (size_t j = 0; j + 1 < elements.size(); j += 2) {
+          zset->Insert(common::Value::CreateStringValue(elements[j + 1]),
+                       common::Value::CreateStringValue(elements[j]));
+        }
+        value = zset;
+      } else if (type == "hash") {
+        common::HashValue* hash = common::Value::CreateHashValue();
+        for (size_t j = 0; j + 1 < elements.size(); j += 2) {
+          hash->Insert(common::Value::CreateStringValue(elements[j]),
+                       common::Value::CreateStringValue(elements[j + 1]));
+        }
+        value = hash;
+      }
+    }
+    freeReplyObject(reply);
+
+    if (value) {
+      NKey key = keys[indexes[i]];
+      key.SetTTL(ttls[indexes[i]]);
+      loaded_keys->push_back(NDbKValue(key, NValue(value)));
+    }
+  }
+
+  return common::Error();
+}
+
+common::Error DBConnection::StoreKeysImpl(const std::vector<NDbKValue>& keys) {
+  // one pipeline per block, collections are replaced as a whole
+  std::vector<commands_args_t> cmds;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const NKey key = keys[i].GetKey();
+    const command_buffer_t key_str = key.GetKey().GetKeyData();
+    const ttl_t ttl = key.GetTTL();
+    NValue value = keys[i].GetValue();
+    common::Value* val = value.get();
+    const common::Value::Type type = val ? val->GetType() : common::Value::TYPE_NULL;
+    commands_args_t cmd;
+    if (type == common::Value::TYPE_ARRAY) {
+      cmd = {"RPUSH", key_str};
+      common::ArrayValue* arr = static_cast<common::ArrayValue*>(val);
+      for (auto it = arr->begin(); it != arr->end(); ++it) {
+        cmd.push_back(ConvertValue(*it, std::string(), false));
+      }
+    } else if (type == common::Value::TYPE_SET) {
+      cmd = {"SADD", key_str};
+      common::SetValue* set = static_cast<common::SetValue*>(val);
+      for (auto it = set->begin(); it != set->end(); ++it) {
+        cmd.push_back(ConvertValue(*it, std::string(), false));
+      }
+    } else if (type == common::Value::TYPE_ZSET) {
+      cmd = {"ZADD", key_str};
+      common::ZSetValue* zset = static_cast<common::ZSetValue*>(val);
+      for (auto it = zset->begin(); it != zset->end(); ++it) {
+        auto v = *it;
+        cmd.push_back(ConvertValue(v.first, std::string(), false));
+        cmd.push_back(ConvertValue(v.second, std::string(), false));
+      }
+    } else if (type == common::Value::TYPE_HASH) {
+      cmd = {"HMSET", key_str};
+      common::HashValue* hash = static_cast<common::HashValue*>(val);
+      for (auto it = hash->begin(); it != hash->end(); ++it) {
+        auto v = *it;
+        cmd.push_back(ConvertValue(v.first, std::string(), false));
+        cmd.push_back(ConvertValue(v.second, std::string(), false));
+      }
+    } else {
+      cmd = {"SET", key_str, val ? ConvertValue(val, std::string(), false) : std::string()};
+      if (ttl > 0) {
+        cmd.push_back("EX");
+        cmd.push_back(common::ConvertToString(ttl));
+      }
+      cmds.push_back(cmd);
+      continue;
+    }
+
+    if (cmd.size() == 2) {
+      continue;  // empty collections do not exist in redis
+    }
+    cmds.push_back({"DEL", key_str});
+    cmds.push_back(cmd);
+    if (ttl > 0) {
+      cmds.push_back({"EXPIRE", key_str, common::ConvertToString(ttl)});
+    }
+  }
+
+  if (cmds.empty()) {
+    return common::Error();
+  }
+
+  std::vector<redisReply*> replies;
+  common::Error err;
+  {
+    NetworkMeter meter(connection_.handle_, &commands_stats_);
+    err = ExecRedisPipeline(connection_.handle_, cmds, &replies);
+  }
+  if (err) {
+    return err;
+  }
+  commands_stats_.RecordPipeline(cmds.size());
+
+  for (size_t i = 0; i < replies.size(); ++i) {
+    if (!err && replies[i]->type == REDIS_REPLY_ERROR) {
+      err = common::make_error(std::string(replies[i]->str, replies[i]->len));
+    }
+    freeReplyObject(replies[i]);
+  }
+  return err;
+}
+
 common::Error DBConnection::ModuleLoadImpl(const ModuleInfo& module) {
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   command_buffer_t module_load_cmd;
@@ -3836,7 +4299,9 @@ common::Error DBConnection::CliFormatReplyRaw(FastoObject* out, redisReply* r) {
   }
 
   common::Value* out_val = nullptr;
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
   common::Error err = ValueFromReplay(r, &out_val);
+  commands_stats_.RecordReplyParse(CommandsStats::Now() - start_ts);
   if (err) {
     if (err->GetDescription() == "NOAUTH") {  //"NOAUTH Authentication
                                               // required."
@@ -3862,7 +4327,12 @@ common::Error DBConnection::CliReadReply(FastoObject* out) {
   }
 
   void* _reply = NULL;
-  if (redisGetReply(connection_.handle_, &_reply) != REDIS_OK) {
+  int res = REDIS_OK;
+  {
+    NetworkMeter meter(connection_.handle_, &commands_stats_);
+    res = redisGetReply(connection_.handle_, &_reply);
+  }
+  if (res != REDIS_OK) {
     /* Filter cases where we should reconnect */
     if (connection_.handle_->err == REDIS_ERR_IO && errno == ECONNRESET) {
       return common::make_error("Needed reconnect.");
@@ -3921,6 +4391,7 @@ common::Error DBConnection::ExecuteAsPipeline(const std::vector<FastoObjectComma
     }
   }
 
+  commands_stats_.RecordPipeline(valid_cmds.size());
   for (size_t i = 0; i < valid_cmds.size(); ++i) {
     FastoObjectCommandIPtr cmd = cmds[i];
     common::Error err = CliReadReply(cmd.get());
@@ -3933,6 +4404,160 @@ common::Error DBConnection::ExecuteAsPipeline(const std::vector<FastoObjectComma
   return common::Error();
 }
 
+common::Error DBConnection::ExecuteAsPipeline(const std::vector<commands_args_t>& cmds,
+                                              std::vector<CommandsStats::usec_t>* latencies,
+                                              size_t* failed) {
+  if (cmds.empty() || !latencies || !failed) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  NetworkMeter meter(connection_.handle_, &commands_stats_);
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  std::vector<const char*> argvc;
+  std::vector<size_t> argvlen;
+  for (size_t i = 0; i < cmds.size(); ++i) {
+    const commands_args_t& argv = cmds[i];
+    argvc.clear();
+    argvlen.clear();
+    for (size_t j = 0; j < argv.size(); ++j) {
+      argvc.push_back(argv[j].data());
+      argvlen.push_back(argv[j].size());
+    }
+    if (redisAppendCommandArgv(connection_.handle_, static_cast<int>(argvc.size()), argvc.data(), argvlen.data()) ==
+        REDIS_ERR) {
+      return PrintRedisContextError(connection_.handle_);
+    }
+  }
+
+  commands_stats_.RecordPipeline(cmds.size());
+  latencies->clear();
+  *failed = 0;
+  for (size_t i = 0; i < cmds.size(); ++i) {
+    void* reply = NULL;
+    if (redisGetReply(connection_.handle_, &reply) == REDIS_ERR) {
+      return PrintRedisContextError(connection_.handle_);
+    }
+
+    latencies->push_back(CommandsStats::Now() - start_ts);
+    redisReply* rreply = static_cast<redisReply*>(reply);
+    if (rreply->type == REDIS_REPLY_ERROR) {
+      (*failed)++;
+    }
+    freeReplyObject(rreply);
+  }
+
+  return common::Error();
+}
+
+common::Error DBConnection::ExecuteAsPipeline(const std::vector<commands_args_t>& cmds,
+                                              std::vector<redisReply*>* replies) {
+  if (cmds.empty() || !replies) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  {
+    NetworkMeter meter(connection_.handle_, &commands_stats_);
+    err = ExecRedisPipeline(connection_.handle_, cmds, replies);
+  }
+  if (err) {
+    return err;
+  }
+
+  commands_stats_.RecordPipeline(cmds.size());
+  return common::Error();
+}
+
+common::Error DBConnection::ExecuteAsPipeline(const std::vector<command_buffer_t>& commands,
+                                              size_t* failed,
+                                              common::Error* first_failure) {
+  if (!failed || !first_failure) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  size_t lfailed = 0;
+  std::vector<commands_args_t> pipeline;
+  for (size_t i = 0; i <= commands.size(); ++i) {
+    const bool last = i == commands.size();
+    commands_args_t argv;
+    if (!last) {
+      int argc = 0;
+      sds* sargv = sdssplitargslong(commands[i].data(), &argc);
+      if (!sargv) {
+        lfailed++;
+        if (!*first_failure) {
+          *first_failure = common::make_error(common::MemSPrintf("Invalid command: %s", commands[i]));
+        }
+        continue;
+      }
+
+      for (int j = 0; j < argc; ++j) {
+        argv.push_back(command_buffer_t(sargv[j], sdslen(sargv[j])));
+      }
+      sdsfreesplitres(sargv, argc);
+      if (argv.empty()) {
+        continue;
+      }
+
+      if (IsSilentPipelineCommand(argv[0])) {
+        pipeline.push_back(argv);
+        continue;
+      }
+    }
+
+    // keep order: pending pipeline goes before a command which can't be pipelined
+    if (!pipeline.empty()) {
+      std::vector<redisReply*> replies;
+      err = ExecuteAsPipeline(pipeline, &replies);
+      if (err) {
+        return err;
+      }
+
+      for (size_t j = 0; j < replies.size(); ++j) {
+        if (replies[j]->type == REDIS_REPLY_ERROR) {
+          lfailed++;
+          if (!*first_failure) {
+            *first_failure = common::make_error(std::string(replies[j]->str, replies[j]->len));
+          }
+        }
+        freeReplyObject(replies[j]);
+      }
+      pipeline.clear();
+    }
+
+    if (!last) {
+      FastoObjectIPtr root = FastoObject::CreateRoot(commands[i]);
+      common::Error cmd_err = Execute(argv, root.get());
+      if (cmd_err) {
+        lfailed++;
+        if (!*first_failure) {
+          *first_failure = cmd_err;
+        }
+      }
+    }
+  }
+
+  *failed = lfailed;
+  return common::Error();
+}
+
 common::Error DBConnection::CommonExec(const commands_args_t& argv, FastoObject* out) {
   if (!out || argv.empty()) {
     DNOTREACHED();
@@ -3945,7 +4570,10 @@ common::Error DBConnection::CommonExec(const commands_args_t& argv, FastoObject*
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, argv, &reply);
+  {
+    NetworkMeter meter(connection_.handle_, &commands_stats_);
+    err = ExecRedisCommand(connection_.handle_, argv, &reply);
+  }
   if (err) {
     return err;
   }
@@ -4039,6 +4667,285 @@ common::Error DBConnection::Subscribe(const commands_args_t& argv, FastoObject*
   return common::make_error(common::COMMON_EINTR);
 }
 
+common::Error DBConnection::PSubscribeSilent(const std::string& pattern, ps_message_observer_t observer) {
+  if (pattern.empty() || !observer) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  redisReply* reply = NULL;
+  err = ExecRedisCommand(connection_.handle_, commands_args_t{"PSUBSCRIBE", pattern}, &reply);
+  if (err) {
+    return err;
+  }
+  freeReplyObject(reply);
+
+  while (!IsInterrupted()) {  // listen loop
+    void* lreply = NULL;
+    if (redisGetReplyFromReader(connection_.handle_, &lreply) != REDIS_OK) {
+      return PrintRedisContextError(connection_.handle_);
+    }
+
+    if (!lreply) {  // read is bounded, so interrupt is seen without a message
+      int ready = redisWaitReadable(connection_.handle_, kListenPollIntervalMsec);
+      if (ready == REDIS_ERR) {
+        return PrintRedisContextError(connection_.handle_);
+      }
+      if (ready == 0) {
+        continue;
+      }
+      if (redisGetReply(connection_.handle_, &lreply) != REDIS_OK) {
+        return PrintRedisContextError(connection_.handle_);
+      }
+    }
+
+    // pmessage, pattern, channel, message
+    reply = static_cast<redisReply*>(lreply);
+    if (reply->type == REDIS_REPLY_ARRAY && reply->elements == 4 && reply->element[2]->type == REDIS_REPLY_STRING &&
+        reply->element[3]->type == REDIS_REPLY_STRING) {
+      observer(std::string(reply->element[2]->str, reply->element[2]->len),
+               std::string(reply->element[3]->str, reply->element[3]->len));
+    }
+    freeReplyObject(reply);
+  }
+
+  return common::make_error(common::COMMON_EINTR);
+}
+
+common::Error DBConnection::EnableNotifications(const std::string& flags, std::string* previous, bool* changed) {
+  if (!previous || !changed) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  redisReply* reply = NULL;
+  err = ExecRedisCommand(connection_.handle_, commands_args_t{"CONFIG", "GET", "notify-keyspace-events"}, &reply);
+  if (err) {
+    return err;
+  }
+
+  std::string current;
+  if (reply->type == REDIS_REPLY_ARRAY && reply->elements == 2 && reply->element[1]->type == REDIS_REPLY_STRING) {
+    current.assign(reply->element[1]->str, reply->element[1]->len);
+  }
+  freeReplyObject(reply);
+
+  std::string merged = current;
+  for (char flag : flags) {
+    if (merged.find(flag) == std::string::npos) {
+      merged += flag;
+    }
+  }
+  *previous = current;
+  *changed = false;
+  if (merged == current) {
+    return common::Error();
+  }
+
+  err = SetNotifications(merged);
+  if (err) {
+    return err;
+  }
+
+  *changed = true;
+  return common::Error();
+}
+
+common::Error DBConnection::SetNotifications(const std::string& flags) {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  redisReply* reply = NULL;
+  err = ExecRedisCommand(connection_.handle_, commands_args_t{"CONFIG", "SET", "notify-keyspace-events", flags},
+                         &reply);
+  if (err) {
+    return err;
+  }
+
+  freeReplyObject(reply);
+  return common::Error();
+}
+
+common::Error DBConnection::Benchmark(const BenchmarkConfig& bconfig, BenchmarkResult* result) {
+  if (!result) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  return RunBenchmark(*GetConfig(), bconfig, [this]() { return IsInterrupted(); }, result);
+}
+
+common::Error DBConnection::CopyKeys(const RConfig& destination,
+                                     const CopyKeysConfig& cconfig,
+                                     copy_keys_report_observer_t observer,
+                                     CopyKeysReport* report) {
+  if (!report) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  return RunCopyKeys(*GetConfig(), destination, cconfig, [this]() { return IsInterrupted(); }, observer, report);
+}
+
+common::Error DBConnection::AnalyzeMemory(const MemoryAnalyzerConfig& aconfig,
+                                          memory_report_observer_t observer,
+                                          MemoryReport* report) {
+  if (!report) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  static const CommandsStats::usec_t progress_interval = 1000000;
+  static const CommandsStats::usec_t max_throttle_sleep = 100000;  // interrupt latency
+  const command_buffer_t samples = common::ConvertToString(aconfig.samples);
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  CommandsStats::usec_t progress_ts = start_ts;
+  MemoryAnalyzer analyzer(aconfig);
+  uint64_t ops = 0;
+  uint64_t cursor = 0;
+  bool completed = false;
+  std::vector<commands_args_t> cmds;
+  std::vector<redisReply*> replies;
+  while (!IsInterrupted()) {
+    std::vector<std::string> keys;
+    uint64_t cursor_out = 0;
+    err = Scan(cursor, aconfig.pattern, aconfig.count, &keys, &cursor_out);
+    if (err) {
+      return err;
+    }
+    ops++;
+
+    // TYPE and MEMORY USAGE for whole page
+    std::vector<MemoryKeyInfo> infos;
+    if (!keys.empty()) {
+      cmds.clear();
+      for (size_t i = 0; i < keys.size(); ++i) {
+        cmds.push_back({"TYPE", keys[i]});
+        cmds.push_back({"MEMORY", "USAGE", keys[i], "SAMPLES", samples});
+      }
+
+      {
+        NetworkMeter meter(connection_.handle_, &commands_stats_);
+        err = ExecRedisPipeline(connection_.handle_, cmds, &replies);
+      }
+      if (err) {
+        return err;
+      }
+      commands_stats_.RecordPipeline(cmds.size());
+      ops += cmds.size();
+
+      for (size_t i = 0; i < keys.size() && !err; ++i) {
+        redisReply* type_reply = replies[i * 2];
+        redisReply* usage_reply = replies[i * 2 + 1];
+        if (type_reply->type == REDIS_REPLY_ERROR) {
+          err = common::make_error(type_reply->str);
+        } else if (usage_reply->type == REDIS_REPLY_ERROR) {
+          err = common::make_error(usage_reply->str);
+        } else if (type_reply->type == REDIS_REPLY_STATUS && usage_reply->type == REDIS_REPLY_INTEGER) {
+          // expired or deleted keys reply none and nil
+          infos.push_back(MemoryKeyInfo(keys[i], type_reply->str, usage_reply->integer, 0));
+        }
+      }
+      for (size_t i = 0; i < replies.size(); ++i) {
+        freeReplyObject(replies[i]);
+      }
+      if (err) {
+        return err;
+      }
+    }
+
+    // collection lengths for keys with known types
+    cmds.clear();
+    std::vector<size_t> indexes;
+    for (size_t i = 0; i < infos.size(); ++i) {
+      const command_buffer_t length_command = GetLengthCommand(infos[i].type);
+      if (!length_command.empty()) {
+        cmds.push_back({length_command, infos[i].key});
+        indexes.push_back(i);
+      }
+    }
+
+    if (!cmds.empty()) {
+      {
+        NetworkMeter meter(connection_.handle_, &commands_stats_);
+        err = ExecRedisPipeline(connection_.handle_, cmds, &replies);
+      }
+      if (err) {
+        return err;
+      }
+      commands_stats_.RecordPipeline(cmds.size());
+      ops += cmds.size();
+
+      for (size_t i = 0; i < replies.size(); ++i) {
+        if (replies[i]->type == REDIS_REPLY_INTEGER) {
+          infos[indexes[i]].length = replies[i]->integer;
+        }
+        freeReplyObject(replies[i]);
+      }
+    }
+
+    for (size_t i = 0; i < infos.size(); ++i) {
+      analyzer.Add(infos[i]);
+    }
+
+    cursor = cursor_out;
+    if (cursor == 0) {
+      completed = true;
+      break;
+    }
+
+    if (observer && CommandsStats::Now() - progress_ts >= progress_interval) {
+      progress_ts = CommandsStats::Now();
+      MemoryReport progress = analyzer.GetReport();
+      progress.msec = (progress_ts - start_ts) / 1000;
+      observer(progress);
+    }
+
+    // keep average rate under OPS, sleep is split to react on interrupt
+    if (aconfig.ops) {
+      const CommandsStats::usec_t planned_ts = start_ts + ops * 1000000 / aconfig.ops;
+      CommandsStats::usec_t now = CommandsStats::Now();
+      while (now < planned_ts && !IsInterrupted()) {
+        std::this_thread::sleep_for(std::chrono::microseconds(std::min(planned_ts - now, max_throttle_sleep)));
+        now = CommandsStats::Now();
+      }
+    }
+  }
+
+  MemoryReport lreport = analyzer.GetReport();
+  lreport.msec = (CommandsStats::Now() - start_ts) / 1000;
+  lreport.completed = completed;
+  *report = lreport;
+  return common::Error();
+}
+
 common::Error DBConnection::SetEx(const NDbKValue& key, ttl_t ttl) {
   common::Error err = TestIsAuthenticated();
   if (err) {
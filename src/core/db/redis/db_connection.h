@@ -20,10 +20,13 @@
 
 #include "core/internal/cdb_connection.h"  // for CDBConnection
 
+#include "core/db/redis/benchmark.h"
 #include "core/db/redis/config.h"
+#include "core/db/redis/copy_keys.h"
 #include "core/db/redis/server_info.h"  // for ServerInfo
 
 #include "core/global.h"
+#include "core/memory_analyzer.h"
 #include "core/ssh_info.h"
 
 #define GET_SERVER_TYPE "CLUSTER NODES"
@@ -45,12 +48,24 @@ struct RConfig : public Config {
   SSHInfo ssh_info;
 };
 
+common::Error ValueFromReplay(redisReply* r, common::Value** out) WARN_UNUSED_RESULT;
+
 common::Error CreateConnection(const RConfig& config, NativeConnection** context);
 common::Error TestConnection(const RConfig& rconfig);
 
 common::Error DiscoveryClusterConnection(const RConfig& rconfig, std::vector<ServerDiscoveryClusterInfoSPtr>* infos);
 common::Error DiscoverySentinelConnection(const RConfig& rconfig, std::vector<ServerDiscoverySentinelInfoSPtr>* infos);
 
+// nodes are asked concurrently, observer is called from worker threads one at a time, fails only if all nodes failed
+common::Error DiscoveryClusterConnection(const std::vector<RConfig>& nodes, discovery_cluster_observer_t observer);
+// observer gets masters first and then slaves of each master as its reply arrives
+common::Error DiscoverySentinelConnection(const RConfig& rconfig, discovery_sentinel_observer_t observer);
+
+// commands which script window may pipeline, others go through Execute to keep client state
+bool IsSilentPipelineCommand(const command_buffer_t& command_name);
+
+typedef std::function<void(const std::string& channel, const std::string& message)> ps_message_observer_t;
+
 class DBConnection : public core::internal::CDBConnection<NativeConnection, RConfig, REDIS> {
  public:
   typedef core::internal::CDBConnection<NativeConnection, RConfig, REDIS> base_class;
@@ -67,11 +82,39 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, RCon
 
   common::Error ExecuteAsPipeline(const std::vector<FastoObjectCommandIPtr>& cmds,
                                   void (*log_command_cb)(FastoObjectCommandIPtr)) WARN_UNUSED_RESULT;
+  // replies are dropped, latencies from pipeline send till each reply, error replies are counted in failed
+  common::Error ExecuteAsPipeline(const std::vector<commands_args_t>& cmds,
+                                  std::vector<CommandsStats::usec_t>* latencies,
+                                  size_t* failed) WARN_UNUSED_RESULT;
+  // raw replies in order of commands, binary safe, caller frees them with freeReplyObject
+  common::Error ExecuteAsPipeline(const std::vector<commands_args_t>& cmds,
+                                  std::vector<redisReply*>* replies) WARN_UNUSED_RESULT;
+  // script window: runs of IsSilentPipelineCommand commands are sent as one pipeline, others one by one,
+  // replies are dropped, failures counted and the first one kept if first_failure is not set yet
+  common::Error ExecuteAsPipeline(const std::vector<command_buffer_t>& commands,
+                                  size_t* failed,
+                                  common::Error* first_failure) WARN_UNUSED_RESULT;
 
   common::Error CommonExec(const commands_args_t& argv, FastoObject* out) WARN_UNUSED_RESULT;
   common::Error Auth(const std::string& password) WARN_UNUSED_RESULT;
   common::Error Monitor(const commands_args_t& argv, FastoObject* out) WARN_UNUSED_RESULT;    // interrupt
   common::Error Subscribe(const commands_args_t& argv, FastoObject* out) WARN_UNUSED_RESULT;  // interrupt
+  // messages are passed to observer instead of output, blocks until interrupted
+  common::Error PSubscribeSilent(const std::string& pattern, ps_message_observer_t observer) WARN_UNUSED_RESULT;
+  // notify-keyspace-events flags are added to already configured ones,
+  // previous flags should be restored with SetNotifications if changed
+  common::Error EnableNotifications(const std::string& flags, std::string* previous, bool* changed) WARN_UNUSED_RESULT;
+  common::Error SetNotifications(const std::string& flags) WARN_UNUSED_RESULT;
+  common::Error Benchmark(const BenchmarkConfig& bconfig, BenchmarkResult* result) WARN_UNUSED_RESULT;  // interrupt
+  // keys of current database are copied to destination, observer gets partial report about once a second
+  common::Error CopyKeys(const RConfig& destination,
+                         const CopyKeysConfig& cconfig,
+                         copy_keys_report_observer_t observer,
+                         CopyKeysReport* report) WARN_UNUSED_RESULT;
+  // observer gets partial report about once a second, interrupt stops scan with partial report
+  common::Error AnalyzeMemory(const MemoryAnalyzerConfig& aconfig,
+                              memory_report_observer_t observer,
+                              MemoryReport* report) WARN_UNUSED_RESULT;
 
   common::Error SetEx(const NDbKValue& key, ttl_t ttl);
   common::Error SetNX(const NDbKValue& key, long long* result);
@@ -131,7 +174,8 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, RCon
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
   virtual common::Error GetImpl(const NKey& key,
-                                NDbKValue* loaded_key) override;  // GET works differently than in redis protocol
+                                NDbKValue* loaded_key,
+                                bool* found) override;  // GET works differently than in redis protocol
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error SetTTLImpl(const NKey& key,
                                    ttl_t ttl) override;  // EXPIRE works differently than in redis protocol
@@ -139,6 +183,8 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, RCon
   virtual common::Error ModuleLoadImpl(const ModuleInfo& module) override;
   virtual common::Error ModuleUnLoadImpl(const ModuleInfo& module) override;
   virtual common::Error QuitImpl() override;
+  virtual common::Error LoadKeysImpl(const NKeys& keys, std::vector<NDbKValue>* loaded_keys) override;
+  virtual common::Error StoreKeysImpl(const std::vector<NDbKValue>& keys) override;
 
   common::Error SendSync(unsigned long long* payload) WARN_UNUSED_RESULT;
 
@@ -18,6 +18,8 @@
 
 #include "core/db/redis/internal/commands_api.h"
 
+#include <common/sprintf.h>
+
 #include "core/db/redis/db_connection.h"
 #include "core/db/redis/internal/modules.h"
 
@@ -1489,6 +1491,82 @@ common::Error CommandsApi::MemoryMallocStats(internal::CommandHandler* handler,
   return red->CommonExec(ExpandCommand({"MEMORY", "MALLOC-STATS"}, argv), out);
 }
 
+common::Error CommandsApi::Benchmark(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  BenchmarkConfig bconfig;
+  common::Error err = ParseBenchmarkArgs(argv, &bconfig);
+  if (err) {
+    return err;
+  }
+
+  DBConnection* red = static_cast<DBConnection*>(handler);
+  BenchmarkResult result;
+  err = red->Benchmark(bconfig, &result);
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue(common::ConvertToString(result));
+  FastoObject* child = new FastoObject(out, val, red->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::CopyKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  RConfig destination;
+  CopyKeysConfig cconfig;
+  common::Error err = ParseCopyKeysArgs(argv, &destination, &cconfig);
+  if (err) {
+    return err;
+  }
+
+  DBConnection* red = static_cast<DBConnection*>(handler);
+  auto progress = [red, out](const CopyKeysReport& report) {
+    const std::string line = common::MemSPrintf(
+        "%llu of %llu scanned keys copied, %llu bytes, %.2f seconds", static_cast<unsigned long long>(report.keys),
+        static_cast<unsigned long long>(report.scanned), static_cast<unsigned long long>(report.bytes),
+        static_cast<double>(report.msec) / 1000);
+    FastoObject* child = new FastoObject(out, common::Value::CreateStringValue(line), red->GetDelimiter());
+    out->AddChildren(child);
+  };
+  CopyKeysReport report;
+  err = red->CopyKeys(destination, cconfig, progress, &report);
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue(common::ConvertToString(report));
+  FastoObject* child = new FastoObject(out, val, red->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::MemKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  MemoryAnalyzerConfig aconfig;
+  common::Error err = ParseMemoryAnalyzerArgs(argv, &aconfig);
+  if (err) {
+    return err;
+  }
+
+  DBConnection* red = static_cast<DBConnection*>(handler);
+  auto progress = [red, out](const MemoryReport& report) {
+    const std::string line =
+        common::MemSPrintf("%llu keys, %llu bytes, %.2f seconds", static_cast<unsigned long long>(report.keys),
+                           static_cast<unsigned long long>(report.bytes), static_cast<double>(report.msec) / 1000);
+    FastoObject* child = new FastoObject(out, common::Value::CreateStringValue(line), red->GetDelimiter());
+    out->AddChildren(child);
+  };
+  MemoryReport report;
+  err = red->AnalyzeMemory(aconfig, progress, &report);
+  if (err) {
+    return err;
+  }
+
+  common::StringValue* val = common::Value::CreateStringValue(common::ConvertToString(report));
+  FastoObject* child = new FastoObject(out, val, red->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
 common::Error CommandsApi::SwapDB(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
   UNUSED(argv);
   DBConnection* red = static_cast<DBConnection*>(handler);
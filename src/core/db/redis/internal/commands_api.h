@@ -254,6 +254,9 @@ struct CommandsApi : public internal::ApiTraits<DBConnection> {
   static common::Error MemoryStats(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error MemoryPurge(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error MemoryMallocStats(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error Benchmark(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error CopyKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error MemKeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error SwapDB(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error Unlink(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error Touch(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
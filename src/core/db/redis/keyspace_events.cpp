@@ -0,0 +1,358 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/redis/keyspace_events.h"
+
+#include <common/macros.h>  // for SIZEOFMASS
+#include <common/sprintf.h>
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+namespace {
+
+const char kKeyeventPrefix[] = "__keyevent@";
+
+struct EventMapping {
+  const char* event;
+  KeyspaceEvent::Type type;
+  common::Value::Type value_type;
+};
+
+const EventMapping kEvents[] = {
+    {"set", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_STRING},
+    {"setrange", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_STRING},
+    {"append", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_STRING},
+    {"incrby", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_STRING},
+    {"incrbyfloat", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_STRING},
+    {"lpush", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"rpush", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"lpop", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"rpop", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"linsert", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"lset", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"lrem", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"ltrim", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"sortstore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ARRAY},
+    {"sadd", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_SET},
+    {"srem", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_SET},
+    {"spop", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_SET},
+    {"sinterstore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_SET},
+    {"sunionstore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_SET},
+    {"sdiffstore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_SET},
+    {"hset", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_HASH},
+    {"hincrby", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_HASH},
+    {"hincrbyfloat", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_HASH},
+    {"hdel", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_HASH},
+    {"zadd", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zincr", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zrem", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zremrangebyscore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zremrangebyrank", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zremrangebylex", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zinterstore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"zunionstore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_ZSET},
+    {"restore", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_NULL},
+    {"move_to", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_NULL},
+    {"xadd", KeyspaceEvent::KEY_CHANGED, common::Value::TYPE_NULL},
+    {"del", KeyspaceEvent::KEY_REMOVED, common::Value::TYPE_NULL},
+    {"expired", KeyspaceEvent::KEY_REMOVED, common::Value::TYPE_NULL},
+    {"evicted", KeyspaceEvent::KEY_REMOVED, common::Value::TYPE_NULL},
+    {"move_from", KeyspaceEvent::KEY_REMOVED, common::Value::TYPE_NULL},
+    {"expire", KeyspaceEvent::KEY_EXPIRE_CHANGED, common::Value::TYPE_NULL},
+    {"persist", KeyspaceEvent::KEY_PERSISTED, common::Value::TYPE_NULL},
+    {"rename_from", KeyspaceEvent::KEY_RENAMED_FROM, common::Value::TYPE_NULL},
+    {"rename_to", KeyspaceEvent::KEY_RENAMED_TO, common::Value::TYPE_NULL}};
+
+bool IsChangeSuperseded(KeyspaceEvent::Type type) {
+  return type == KeyspaceEvent::KEY_CHANGED;
+}
+
+bool IsRemoveSuperseded(KeyspaceEvent::Type type) {
+  return type == KeyspaceEvent::KEY_CHANGED || type == KeyspaceEvent::KEY_EXPIRE_CHANGED ||
+         type == KeyspaceEvent::KEY_PERSISTED;
+}
+
+bool IsTTLSuperseded(KeyspaceEvent::Type type) {
+  return type == KeyspaceEvent::KEY_EXPIRE_CHANGED || type == KeyspaceEvent::KEY_PERSISTED;
+}
+
+}  // namespace
+
+KeyspaceEvent::KeyspaceEvent() : type(KEY_CHANGED), key(), new_key(), value_type(common::Value::TYPE_NULL) {}
+
+KeyspaceEvent::KeyspaceEvent(Type type, const std::string& key, common::Value::Type value_type)
+    : type(type), key(key), new_key(), value_type(value_type) {}
+
+bool ParseKeyspaceEvent(const std::string& channel, const std::string& key, KeyspaceEvent* event) {
+  if (!event || channel.compare(0, sizeof(kKeyeventPrefix) - 1, kKeyeventPrefix) != 0) {
+    return false;
+  }
+
+  const std::string::size_type pos = channel.find("__:", sizeof(kKeyeventPrefix) - 1);
+  if (pos == std::string::npos) {
+    return false;
+  }
+
+  const std::string name = channel.substr(pos + 3);
+  for (size_t i = 0; i < SIZEOFMASS(kEvents); ++i) {
+    if (name == kEvents[i].event) {
+      *event = KeyspaceEvent(kEvents[i].type, key, kEvents[i].value_type);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::string MakeKeyspaceEventsPattern(int db_num) {
+  return common::MemSPrintf("%s%d__:*", kKeyeventPrefix, db_num);
+}
+
+KeyspaceEventsBatch::KeyspaceEventsBatch(size_t limit)
+    : limit_(limit),
+      mutex_(),
+      events_(),
+      dropped_(),
+      key_events_(),
+      rename_from_(),
+      count_(0),
+      overflowed_(false),
+      error_() {}
+
+void KeyspaceEventsBatch::Add(const KeyspaceEvent& event) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (overflowed_) {
+    return;
+  }
+
+  KeyspaceEvent added = event;
+  switch (event.type) {
+    case KeyspaceEvent::KEY_RENAMED_FROM:
+      rename_from_ = event.key;
+      return;
+    case KeyspaceEvent::KEY_RENAMED_TO:
+      if (rename_from_.empty()) {
+        added = KeyspaceEvent(KeyspaceEvent::KEY_CHANGED, event.key);
+        break;
+      }
+      added = KeyspaceEvent(KeyspaceEvent::KEY_RENAMED, rename_from_);
+      added.new_key = event.key;
+      rename_from_.clear();
+      // earlier events should be applied before rename, they are not coalesced with later ones
+      key_events_.erase(added.key);
+      key_events_.erase(added.new_key);
+      break;
+    case KeyspaceEvent::KEY_CHANGED: {
+      auto it = key_events_.find(event.key);
+      if (it != key_events_.end() && added.value_type == common::Value::TYPE_NULL) {
+        for (size_t index : it->second) {
+          if (!dropped_[index] && events_[index].type == KeyspaceEvent::KEY_CHANGED) {
+            added.value_type = events_[index].value_type;
+          }
+        }
+      }
+      DropPrevious(event.key, &IsChangeSuperseded);
+      break;
+    }
+    case KeyspaceEvent::KEY_REMOVED:
+      DropPrevious(event.key, &IsRemoveSuperseded);
+      break;
+    case KeyspaceEvent::KEY_EXPIRE_CHANGED:
+    case KeyspaceEvent::KEY_PERSISTED:
+      DropPrevious(event.key, &IsTTLSuperseded);
+      break;
+    case KeyspaceEvent::KEY_RENAMED:
+      break;
+  }
+
+  if (count_ == limit_) {
+    overflowed_ = true;
+    events_.clear();
+    dropped_.clear();
+    key_events_.clear();
+    count_ = 0;
+    return;
+  }
+
+  if (added.type != KeyspaceEvent::KEY_RENAMED) {
+    key_events_[added.key].push_back(events_.size());
+  }
+  events_.push_back(added);
+  dropped_.push_back(false);
+  count_++;
+}
+
+void KeyspaceEventsBatch::SetError(common::Error err) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  error_ = err;
+}
+
+common::Error KeyspaceEventsBatch::Take(std::vector<KeyspaceEvent>* events, bool* overflowed) {
+  if (!events || !overflowed) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  events->clear();
+  for (size_t i = 0; i < events_.size(); ++i) {
+    if (!dropped_[i]) {
+      events->push_back(events_[i]);
+    }
+  }
+  *overflowed = overflowed_;
+
+  events_.clear();
+  dropped_.clear();
+  key_events_.clear();
+  count_ = 0;
+  overflowed_ = false;
+  common::Error err = error_;
+  error_ = common::Error();
+  return err;
+}
+
+void KeyspaceEventsBatch::DropPrevious(const std::string& key, bool (*superseded)(KeyspaceEvent::Type)) {
+  auto it = key_events_.find(key);
+  if (it == key_events_.end()) {
+    return;
+  }
+
+  std::vector<size_t>& indexes = it->second;
+  for (auto index = indexes.begin(); index != indexes.end();) {
+    if (superseded(events_[*index].type)) {
+      dropped_[*index] = true;
+      count_--;
+      index = indexes.erase(index);
+    } else {
+      ++index;
+    }
+  }
+}
+
+struct KeyspaceListener::Session {
+  explicit Session(const RConfig& config) : config(config), connection(nullptr), batch() {}
+
+  const RConfig config;
+  DBConnection connection;
+  KeyspaceEventsBatch batch;
+};
+
+KeyspaceListener::KeyspaceListener() : session_(), thread_() {}
+
+KeyspaceListener::~KeyspaceListener() {
+  Stop();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void KeyspaceListener::Start(const RConfig& config) {
+  Stop();
+  session_ = std::make_shared<Session>(config);
+  std::thread previous = std::move(thread_);
+  thread_ = std::thread(&KeyspaceListener::Listen, session_, std::move(previous));
+}
+
+void KeyspaceListener::Stop() {
+  if (!session_) {
+    return;
+  }
+
+  session_->connection.SetInterrupted(true);
+  session_.reset();
+}
+
+bool KeyspaceListener::IsStarted() const {
+  return session_ != nullptr;
+}
+
+common::Error KeyspaceListener::Take(std::vector<KeyspaceEvent>* events, bool* overflowed) {
+  if (!events || !overflowed) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (!session_) {
+    events->clear();
+    *overflowed = false;
+    return common::Error();
+  }
+
+  return session_->batch.Take(events, overflowed);
+}
+
+void KeyspaceListener::Listen(std::shared_ptr<Session> session, std::thread previous) {
+  if (previous.joinable()) {
+    previous.join();
+  }
+
+  DBConnection& connection = session->connection;
+  if (connection.IsInterrupted()) {
+    return;
+  }
+
+  common::Error err = connection.Connect(session->config);
+  if (err) {
+    session->batch.SetError(err);
+    return;
+  }
+
+  // servers where CONFIG is renamed or denied may have notifications configured already,
+  // E: keyevent channels, A: events of all data types
+  std::string previous_flags;
+  bool changed = false;
+  err = connection.EnableNotifications("EA", &previous_flags, &changed);
+  UNUSED(err);
+
+  KeyspaceEventsBatch* batch = &session->batch;
+  auto observer = [batch](const std::string& channel, const std::string& key) {
+    KeyspaceEvent event;
+    if (ParseKeyspaceEvent(channel, key, &event)) {
+      batch->Add(event);
+    }
+  };
+  err = connection.PSubscribeSilent(MakeKeyspaceEventsPattern(session->config.db_num), observer);
+  if (err && !connection.IsInterrupted()) {
+    batch->SetError(err);
+  }
+
+  err = connection.Disconnect();
+  UNUSED(err);
+  if (!changed) {
+    return;
+  }
+
+  // subscribed connection can't run CONFIG SET
+  DBConnection restorer(nullptr);
+  err = restorer.Connect(session->config);
+  if (err) {
+    return;
+  }
+
+  err = restorer.SetNotifications(previous_flags);
+  UNUSED(err);
+  err = restorer.Disconnect();
+  UNUSED(err);
+}
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,113 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <common/error.h>
+#include <common/value.h>
+
+#include "core/db/redis/db_connection.h"
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+// notification from __keyevent@<db>__:<event> channel
+struct KeyspaceEvent {
+  enum Type {
+    KEY_CHANGED,          // written, value_type is TYPE_NULL if event does not tell it
+    KEY_REMOVED,          // deleted, expired, evicted or moved to other database
+    KEY_EXPIRE_CHANGED,   // new ttl should be loaded
+    KEY_PERSISTED,        // ttl removed
+    KEY_RENAMED,          // key renamed to new_key, made from rename_from/rename_to pair
+    KEY_RENAMED_FROM,
+    KEY_RENAMED_TO
+  };
+
+  KeyspaceEvent();
+  KeyspaceEvent(Type type, const std::string& key, common::Value::Type value_type = common::Value::TYPE_NULL);
+
+  Type type;
+  std::string key;
+  std::string new_key;
+  common::Value::Type value_type;
+};
+
+// false for channels and events explorer does not care about
+bool ParseKeyspaceEvent(const std::string& channel, const std::string& key, KeyspaceEvent* event);
+std::string MakeKeyspaceEventsPattern(int db_num);
+
+// thread safe queue of events between two takes, bursts on one key are coalesced to the last state
+class KeyspaceEventsBatch {
+ public:
+  enum { default_limit = 10000 };
+  explicit KeyspaceEventsBatch(size_t limit = default_limit);
+
+  void Add(const KeyspaceEvent& event);
+  void SetError(common::Error err);
+
+  // overflowed means events were dropped after limit and database content should be reloaded
+  common::Error Take(std::vector<KeyspaceEvent>* events, bool* overflowed);
+
+ private:
+  void DropPrevious(const std::string& key, bool (*superseded)(KeyspaceEvent::Type));
+
+  const size_t limit_;
+  std::mutex mutex_;
+  std::vector<KeyspaceEvent> events_;
+  std::vector<bool> dropped_;
+  std::unordered_map<std::string, std::vector<size_t>> key_events_;  // indexes of live events since last rename
+  std::string rename_from_;
+  size_t count_;
+  bool overflowed_;
+  common::Error error_;
+};
+
+// own connection subscribed to keyevent notifications of one database,
+// enables them on server if needed and restores previous flags when listening ends
+class KeyspaceListener {
+ public:
+  KeyspaceListener();
+  ~KeyspaceListener();  // waits for listening thread, it sees stop within poll interval
+
+  void Start(const RConfig& config);  // async, connection errors are returned by Take
+  void Stop();                        // does not block, thread finishes on its own
+  bool IsStarted() const;
+
+  // events of current listening only, events of stopped one are dropped
+  common::Error Take(std::vector<KeyspaceEvent>* events, bool* overflowed);
+
+ private:
+  struct Session;
+  // previous listening is joined first, so server flags are restored in order
+  static void Listen(std::shared_ptr<Session> session, std::thread previous);
+
+  std::shared_ptr<Session> session_;
+  std::thread thread_;
+};
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
@@ -22,6 +22,7 @@ extern "C" {
 #include "sds.h"
 }
 
+#include <common/convert2string.h>
 #include <common/file_system/types.h>  // for prepare_path
 #include <common/sprintf.h>            // for MemSPrintf
 
@@ -32,6 +33,9 @@ namespace core {
 namespace rocksdb {
 
 const std::vector<const char*> g_comparator_types = {"BYTEWISE", "REVERSE_BYTEWISE"};
+const std::vector<const char*> g_tuning_profiles = {"DEFAULT", "BROWSE_READONLY", "BULK_LOAD", "POINT_LOOKUP"};
+const std::vector<const char*> g_open_modes = {"READ_WRITE", "READ_ONLY", "SECONDARY"};
+const std::vector<const char*> g_compression_types = {"NONE", "SNAPPY", "ZLIB", "LZ4", "ZSTD"};
 
 namespace {
 
@@ -44,6 +48,8 @@ Config ParseOptions(int argc, char** argv) {
       cfg.delimiter = argv[++i];
     } else if (!strcmp(argv[i], "-f") && !lastarg) {
       cfg.db_path = argv[++i];
+    } else if (!strcmp(argv[i], "-n") && !lastarg) {
+      cfg.db_name = argv[++i];
     } else if (!strcmp(argv[i], "-c")) {
       cfg.create_if_missing = true;
     } else if (!strcmp(argv[i], "-comp") && !lastarg) {
@@ -51,6 +57,45 @@ Config ParseOptions(int argc, char** argv) {
       if (common::ConvertFromString(argv[++i], &lcomparator)) {
         cfg.comparator = lcomparator;
       }
+    } else if (!strcmp(argv[i], "-p") && !lastarg) {
+      TuningProfile lprofile;
+      if (common::ConvertFromString(argv[++i], &lprofile)) {
+        cfg.ApplyProfile(lprofile);
+      }
+    } else if (!strcmp(argv[i], "-m") && !lastarg) {
+      OpenMode lmode;
+      if (common::ConvertFromString(argv[++i], &lmode)) {
+        cfg.open_mode = lmode;
+      }
+    } else if (!strcmp(argv[i], "-sp") && !lastarg) {
+      cfg.secondary_path = argv[++i];
+    } else if (!strcmp(argv[i], "-cache") && !lastarg) {
+      unsigned int block_cache_mb;
+      if (common::ConvertFromString(argv[++i], &block_cache_mb)) {
+        cfg.block_cache_mb = block_cache_mb;
+      }
+    } else if (!strcmp(argv[i], "-wb") && !lastarg) {
+      unsigned int write_buffer_mb;
+      if (common::ConvertFromString(argv[++i], &write_buffer_mb)) {
+        cfg.write_buffer_mb = write_buffer_mb;
+      }
+    } else if (!strcmp(argv[i], "-mof") && !lastarg) {
+      int max_open_files;
+      if (common::ConvertFromString(argv[++i], &max_open_files)) {
+        cfg.max_open_files = max_open_files;
+      }
+    } else if (!strcmp(argv[i], "-bloom") && !lastarg) {
+      unsigned int bloom_bits_per_key;
+      if (common::ConvertFromString(argv[++i], &bloom_bits_per_key)) {
+        cfg.bloom_bits_per_key = bloom_bits_per_key;
+      }
+    } else if (!strcmp(argv[i], "-ofh")) {
+      cfg.optimize_filters_for_hits = true;
+    } else if (!strcmp(argv[i], "-z") && !lastarg) {
+      CompressionType lcompression;
+      if (common::ConvertFromString(argv[++i], &lcompression)) {
+        cfg.compression = lcompression;
+      }
     } else {
       if (argv[i][0] == '-') {
         const std::string buff = common::MemSPrintf(
@@ -70,10 +115,49 @@ Config ParseOptions(int argc, char** argv) {
 
 }  // namespace
 
+const std::string Config::default_db_name = "default";
+
 Config::Config()
     : LocalConfig(common::file_system::prepare_path("~/test.rocksdb")),
+      db_name(default_db_name),
       create_if_missing(true),
-      comparator(COMP_BYTEWISE) {}
+      comparator(COMP_BYTEWISE),
+      profile(PROFILE_DEFAULT),
+      open_mode(OPEN_READ_WRITE),
+      secondary_path(),
+      block_cache_mb(default_block_cache_mb),
+      write_buffer_mb(default_write_buffer_mb),
+      max_open_files(default_max_open_files),
+      bloom_bits_per_key(default_bloom_bits_per_key),
+      optimize_filters_for_hits(false),
+      compression(COMPRESSION_SNAPPY) {}
+
+void Config::ApplyProfile(TuningProfile prof) {
+  profile = prof;
+  open_mode = OPEN_READ_WRITE;
+  block_cache_mb = default_block_cache_mb;
+  write_buffer_mb = default_write_buffer_mb;
+  max_open_files = default_max_open_files;
+  bloom_bits_per_key = default_bloom_bits_per_key;
+  optimize_filters_for_hits = false;
+  compression = COMPRESSION_SNAPPY;
+
+  if (prof == PROFILE_BROWSE_READONLY) {
+    // no write lock on the database, so it can be browsed while the owner process runs
+    open_mode = OPEN_READ_ONLY;
+    block_cache_mb = 64;
+    max_open_files = 256;
+    bloom_bits_per_key = 10;
+  } else if (prof == PROFILE_BULK_LOAD) {
+    write_buffer_mb = 256;
+    compression = COMPRESSION_LZ4;
+  } else if (prof == PROFILE_POINT_LOOKUP) {
+    // most of gets hit existing keys, filters on the last level only waste memory
+    block_cache_mb = 256;
+    bloom_bits_per_key = 10;
+    optimize_filters_for_hits = true;
+  }
+}
 
 }  // namespace rocksdb
 }  // namespace core
@@ -84,12 +168,39 @@ namespace common {
 std::string ConvertToString(const fastonosql::core::rocksdb::Config& conf) {
   fastonosql::core::config_args_t argv = conf.Args();
 
+  if (!conf.db_name.empty()) {
+    argv.push_back("-n");
+    argv.push_back(conf.db_name);
+  }
+
   if (conf.create_if_missing) {
     argv.push_back("-c");
   }
 
   argv.push_back("-comp");
   argv.push_back(common::ConvertToString(conf.comparator));
+
+  argv.push_back("-p");
+  argv.push_back(common::ConvertToString(conf.profile));
+  argv.push_back("-m");
+  argv.push_back(common::ConvertToString(conf.open_mode));
+  if (!conf.secondary_path.empty()) {
+    argv.push_back("-sp");
+    argv.push_back(conf.secondary_path);
+  }
+  argv.push_back("-cache");
+  argv.push_back(common::ConvertToString(conf.block_cache_mb));
+  argv.push_back("-wb");
+  argv.push_back(common::ConvertToString(conf.write_buffer_mb));
+  argv.push_back("-mof");
+  argv.push_back(common::ConvertToString(conf.max_open_files));
+  argv.push_back("-bloom");
+  argv.push_back(common::ConvertToString(conf.bloom_bits_per_key));
+  if (conf.optimize_filters_for_hits) {
+    argv.push_back("-ofh");
+  }
+  argv.push_back("-z");
+  argv.push_back(common::ConvertToString(conf.compression));
   return fastonosql::core::ConvertToStringConfigArgs(argv);
 }
 
@@ -129,4 +240,64 @@ bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::Compa
   return false;
 }
 
+std::string ConvertToString(fastonosql::core::rocksdb::TuningProfile prof) {
+  return fastonosql::core::rocksdb::g_tuning_profiles[prof];
+}
+
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::TuningProfile* out) {
+  if (!out || from.empty()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < fastonosql::core::rocksdb::g_tuning_profiles.size(); ++i) {
+    if (from == fastonosql::core::rocksdb::g_tuning_profiles[i]) {
+      *out = static_cast<fastonosql::core::rocksdb::TuningProfile>(i);
+      return true;
+    }
+  }
+
+  NOTREACHED();
+  return false;
+}
+
+std::string ConvertToString(fastonosql::core::rocksdb::OpenMode mode) {
+  return fastonosql::core::rocksdb::g_open_modes[mode];
+}
+
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::OpenMode* out) {
+  if (!out || from.empty()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < fastonosql::core::rocksdb::g_open_modes.size(); ++i) {
+    if (from == fastonosql::core::rocksdb::g_open_modes[i]) {
+      *out = static_cast<fastonosql::core::rocksdb::OpenMode>(i);
+      return true;
+    }
+  }
+
+  NOTREACHED();
+  return false;
+}
+
+std::string ConvertToString(fastonosql::core::rocksdb::CompressionType comp) {
+  return fastonosql::core::rocksdb::g_compression_types[comp];
+}
+
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::CompressionType* out) {
+  if (!out || from.empty()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < fastonosql::core::rocksdb::g_compression_types.size(); ++i) {
+    if (from == fastonosql::core::rocksdb::g_compression_types[i]) {
+      *out = static_cast<fastonosql::core::rocksdb::CompressionType>(i);
+      return true;
+    }
+  }
+
+  NOTREACHED();
+  return false;
+}
+
 }  // namespace common
@@ -27,11 +27,41 @@ namespace rocksdb {
 enum ComparatorType { COMP_BYTEWISE, COMP_REVERSE_BYTEWISE };
 extern const std::vector<const char*> g_comparator_types;
 
+enum TuningProfile { PROFILE_DEFAULT = 0, PROFILE_BROWSE_READONLY, PROFILE_BULK_LOAD, PROFILE_POINT_LOOKUP };
+extern const std::vector<const char*> g_tuning_profiles;
+
+enum OpenMode { OPEN_READ_WRITE = 0, OPEN_READ_ONLY, OPEN_SECONDARY };
+extern const std::vector<const char*> g_open_modes;
+
+enum CompressionType { COMPRESSION_NONE = 0, COMPRESSION_SNAPPY, COMPRESSION_ZLIB, COMPRESSION_LZ4, COMPRESSION_ZSTD };
+extern const std::vector<const char*> g_compression_types;
+
 struct Config : public LocalConfig {
+  static const std::string default_db_name;  // rocksdb::kDefaultColumnFamilyName
+  enum {
+    default_block_cache_mb = 8,
+    default_write_buffer_mb = 64,
+    default_max_open_files = -1,
+    default_bloom_bits_per_key = 0
+  };
   Config();
 
+  // overwrites tuning fields with profile values
+  void ApplyProfile(TuningProfile prof);
+
+  std::string db_name;  // column family
   bool create_if_missing;
   ComparatorType comparator;
+
+  TuningProfile profile;
+  OpenMode open_mode;
+  std::string secondary_path;   // OPEN_SECONDARY only, folder for secondary instance logs
+  unsigned int block_cache_mb;  // shared between connections with equal size
+  unsigned int write_buffer_mb;
+  int max_open_files;               // -1 - keep all files opened
+  unsigned int bloom_bits_per_key;  // 0 - without filter
+  bool optimize_filters_for_hits;
+  CompressionType compression;
 };
 
 }  // namespace rocksdb
@@ -44,4 +74,13 @@ bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::Confi
 
 std::string ConvertToString(fastonosql::core::rocksdb::ComparatorType comp);
 bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::ComparatorType* out);
+
+std::string ConvertToString(fastonosql::core::rocksdb::TuningProfile prof);
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::TuningProfile* out);
+
+std::string ConvertToString(fastonosql::core::rocksdb::OpenMode mode);
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::OpenMode* out);
+
+std::string ConvertToString(fastonosql::core::rocksdb::CompressionType comp);
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::CompressionType* out);
 }  // namespace common
@@ -18,14 +18,30 @@
 
 #include "core/db/rocksdb/db_connection.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 #include <common/convert2string.h>
 #include <common/file_system/string_path_utils.h>
 
+#include <rocksdb/cache.h>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
+#include <rocksdb/version.h>
+#include <rocksdb/write_batch.h>
+
+#if ROCKSDB_MAJOR > 6 || (ROCKSDB_MAJOR == 6 && ROCKSDB_MINOR >= 4)
+#define HAVE_ROCKSDB_SECONDARY_INSTANCE
+#endif
+
+#define ROCKSDB_WRITE_BATCH_SIZE 1000
 
 #include "core/db/rocksdb/command_translator.h"
 #include "core/db/rocksdb/database_info.h"
 #include "core/db/rocksdb/internal/commands_api.h"
+#include "core/key_pattern.h"
 
 #define ROCKSDB_HEADER_STATS                               \
   "\n** Compaction Stats [default] **\n"                   \
@@ -63,6 +79,43 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         1,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Info),
+                                          CommandHolder("CONFIG GET",
+                                                        "<parameter>",
+                                                        "Get the value of a configuration parameter",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::ConfigGet),
+                                          CommandHolder(DB_CREATEDB_COMMAND,
+                                                        "<name>",
+                                                        "Create column family",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::CreateDatabase),
+                                          CommandHolder(DB_REMOVEDB_COMMAND,
+                                                        "<name>",
+                                                        "Drop column family",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        1,
+                                                        0,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::RemoveDatabase),
+                                          CommandHolder(ROCKSDB_CFSTATS_COMMAND,
+                                                        "[name]",
+                                                        "Estimated keys count and sst files size "
+                                                        "of the column family",
+                                                        UNDEFINED_SINCE,
+                                                        UNDEFINED_EXAMPLE_STR,
+                                                        0,
+                                                        1,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::ColumnFamilyStats),
                                           CommandHolder(DB_SCAN_COMMAND,
                                                         "<cursor> [MATCH pattern] [COUNT count]",
                                                         "Incrementally iterate the keys space",
@@ -165,6 +218,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         INFINITE_COMMAND_ARGS,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Delete),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -174,6 +247,53 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         0,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Quit)};
+}  // namespace
+
+// every column family must be opened together with the database
+struct rocksdb {
+  ::rocksdb::DB* db;
+  std::vector< ::rocksdb::ColumnFamilyHandle*> families;
+  ::rocksdb::ColumnFamilyHandle* family;  // selected, one of families
+};
+
+namespace {
+
+void rocksdb_close(rocksdb** context) {
+  if (!context) {
+    return;
+  }
+
+  rocksdb* lcontext = *context;
+  if (!lcontext) {
+    return;
+  }
+
+  for (::rocksdb::ColumnFamilyHandle* fam : lcontext->families) {
+    ::rocksdb::Status st = lcontext->db->DestroyColumnFamilyHandle(fam);
+    UNUSED(st);
+  }
+  delete lcontext->db;
+  delete lcontext;
+  *context = nullptr;
+}
+
+::rocksdb::ColumnFamilyHandle* rocksdb_find_family(rocksdb* context, const std::string& name) {
+  for (::rocksdb::ColumnFamilyHandle* fam : context->families) {
+    if (fam->GetName() == name) {
+      return fam;
+    }
+  }
+
+  return nullptr;
+}
+
+// listing keys should not evict hot blocks of values from block cache
+::rocksdb::ReadOptions MakeKeysOnlyReadOptions() {
+  ::rocksdb::ReadOptions ro;
+  ro.fill_cache = false;
+  ro.readahead_size = 2 * 1024 * 1024;  // sequential walk over sst files
+  return ro;
+}
 }
 }  // namespace rocksdb
 
@@ -205,7 +325,8 @@ common::Error ConnectionAllocatorTraits<rocksdb::NativeConnection, rocksdb::Conf
 template <>
 common::Error ConnectionAllocatorTraits<rocksdb::NativeConnection, rocksdb::Config>::Disconnect(
     rocksdb::NativeConnection** handle) {
-  destroy(handle);
+  rocksdb::rocksdb_close(handle);
+  *handle = nullptr;
   return common::Error();
 }
 
@@ -226,6 +347,65 @@ const ConstantCommandsArray& CDBConnection<rocksdb::NativeConnection, rocksdb::C
 
 }  // namespace internal
 namespace rocksdb {
+namespace {
+
+std::shared_ptr<::rocksdb::Cache> GetSharedBlockCache(unsigned int size_mb) {
+  static std::mutex caches_lock;
+  static std::map<unsigned int, std::shared_ptr<::rocksdb::Cache>> caches;
+  std::lock_guard<std::mutex> lock(caches_lock);
+  std::shared_ptr<::rocksdb::Cache>& cache = caches[size_mb];
+  if (!cache) {
+    cache = ::rocksdb::NewLRUCache(static_cast<size_t>(size_mb) * 1024 * 1024);
+  }
+  return cache;
+}
+
+::rocksdb::CompressionType ConvertCompression(CompressionType comp) {
+  if (comp == COMPRESSION_SNAPPY) {
+    return ::rocksdb::kSnappyCompression;
+  } else if (comp == COMPRESSION_ZLIB) {
+    return ::rocksdb::kZlibCompression;
+  } else if (comp == COMPRESSION_LZ4) {
+    return ::rocksdb::kLZ4Compression;
+  } else if (comp == COMPRESSION_ZSTD) {
+    return ::rocksdb::kZSTD;
+  }
+
+  return ::rocksdb::kNoCompression;
+}
+
+::rocksdb::Options MakeOptions(const Config& config) {
+  ::rocksdb::Options rs;
+  if (config.profile == PROFILE_BULK_LOAD) {
+    // before the rest, it overwrites buffers and disables auto compactions
+    rs.PrepareForBulkLoad();
+  }
+  rs.create_if_missing = config.create_if_missing;
+  if (config.comparator == COMP_BYTEWISE) {
+    rs.comparator = ::rocksdb::BytewiseComparator();
+  } else if (config.comparator == COMP_REVERSE_BYTEWISE) {
+    rs.comparator = ::rocksdb::ReverseBytewiseComparator();
+  }
+
+  ::rocksdb::BlockBasedTableOptions table_options;
+  if (config.block_cache_mb) {
+    table_options.block_cache = GetSharedBlockCache(config.block_cache_mb);
+  }
+  if (config.bloom_bits_per_key) {
+    table_options.filter_policy.reset(::rocksdb::NewBloomFilterPolicy(config.bloom_bits_per_key));
+  }
+  rs.table_factory.reset(::rocksdb::NewBlockBasedTableFactory(table_options));
+
+  if (config.write_buffer_mb) {
+    rs.write_buffer_size = static_cast<size_t>(config.write_buffer_mb) * 1024 * 1024;
+  }
+  rs.max_open_files = config.max_open_files;
+  rs.optimize_filters_for_hits = config.optimize_filters_for_hits;
+  rs.compression = ConvertCompression(config.compression);
+  return rs;
+}
+
+}  // namespace
 
 common::Error CreateConnection(const Config& config, NativeConnection** context) {
   if (!context) {
@@ -233,41 +413,75 @@ common::Error CreateConnection(const Config& config, NativeConnection** context)
   }
 
   DCHECK(*context == nullptr);
-  ::rocksdb::DB* lcontext = nullptr;
   std::string folder = config.db_path;  // start point must be folder
   common::tribool is_dir = common::file_system::is_directory(folder);
   if (is_dir != common::SUCCESS && !config.create_if_missing) {
     return common::make_error(common::MemSPrintf("Invalid input path(%s)", folder));
   }
 
-  ::rocksdb::Options rs;
-  rs.create_if_missing = config.create_if_missing;
-  if (config.comparator == COMP_BYTEWISE) {
-    rs.comparator = ::rocksdb::BytewiseComparator();
-  } else if (config.comparator == COMP_REVERSE_BYTEWISE) {
-    rs.comparator = ::rocksdb::ReverseBytewiseComparator();
+  ::rocksdb::Options rs = MakeOptions(config);
+  if (config.open_mode == OPEN_SECONDARY) {
+    rs.max_open_files = -1;  // required by secondary instance
+  }
+
+  std::vector<std::string> names;
+  ::rocksdb::Status st = ::rocksdb::DB::ListColumnFamilies(rs, folder, &names);
+  if (!st.ok() || names.empty()) {  // new database
+    names = {::rocksdb::kDefaultColumnFamilyName};
+  }
+
+  std::vector< ::rocksdb::ColumnFamilyDescriptor> descriptors;
+  for (const std::string& name : names) {
+    descriptors.push_back(::rocksdb::ColumnFamilyDescriptor(name, rs));
+  }
+
+  ::rocksdb::DB* ldb = nullptr;
+  std::vector< ::rocksdb::ColumnFamilyHandle*> families;
+  if (config.open_mode == OPEN_READ_ONLY) {
+    st = ::rocksdb::DB::OpenForReadOnly(rs, folder, descriptors, &families, &ldb);
+  } else if (config.open_mode == OPEN_SECONDARY) {
+#ifdef HAVE_ROCKSDB_SECONDARY_INSTANCE
+    if (config.secondary_path.empty()) {
+      return common::make_error("Secondary path is required for secondary instance");
+    }
+    st = ::rocksdb::DB::OpenAsSecondary(rs, folder, config.secondary_path, descriptors, &families, &ldb);
+#else
+    return common::make_error("Secondary instance is not supported by this RocksDB version");
+#endif
+  } else {
+    st = ::rocksdb::DB::Open(rs, folder, descriptors, &families, &ldb);
   }
-  auto st = ::rocksdb::DB::Open(rs, folder, &lcontext);
   if (!st.ok()) {
     std::string buff = common::MemSPrintf("Fail open database: %s!", st.ToString());
     return common::make_error(buff);
   }
 
+  rocksdb* lcontext = new rocksdb;
+  lcontext->db = ldb;
+  lcontext->families = families;
+  lcontext->family = rocksdb_find_family(lcontext, config.db_name.empty() ? Config::default_db_name : config.db_name);
+  if (!lcontext->family) {
+    rocksdb_close(&lcontext);
+    return common::make_error(common::MemSPrintf("Column family %s not found!", config.db_name));
+  }
+
   *context = lcontext;
   return common::Error();
 }
 
 common::Error TestConnection(const Config& config) {
-  ::rocksdb::DB* ldb = nullptr;
+  rocksdb* ldb = nullptr;
   common::Error err = CreateConnection(config, &ldb);
   if (err) {
     return err;
   }
 
-  delete ldb;
+  rocksdb_close(&ldb);
   return common::Error();
 }
 
+ColumnFamilyStats::ColumnFamilyStats() : estimate_num_keys(0), sst_files_size(0) {}
+
 DBConnection::DBConnection(CDBConnectionClient* client)
     : base_class(client, new CommandTranslator(base_class::GetCommands())) {}
 
@@ -284,7 +498,7 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   }
 
   std::string rets;
-  bool isok = connection_.handle_->GetProperty("rocksdb.stats", &rets);
+  bool isok = connection_.handle_->db->GetProperty("rocksdb.stats", &rets);
   if (!isok) {
     return common::make_error("info function failed");
   }
@@ -344,21 +558,71 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
 
 std::string DBConnection::GetCurrentDBName() const {
   if (IsConnected()) {
-    ::rocksdb::ColumnFamilyHandle* fam = connection_.handle_->DefaultColumnFamily();
-    if (fam) {
-      return fam->GetName();
-    }
+    return connection_.handle_->family->GetName();
   }
 
   DNOTREACHED();
   return base_class::GetCurrentDBName();
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::ConfigGetDatabases(std::vector<std::string>* dbs) {
+  if (!dbs) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  std::vector<std::string> ldbs;
+  for (::rocksdb::ColumnFamilyHandle* fam : connection_.handle_->families) {
+    ldbs.push_back(fam->GetName());
+  }
+
+  *dbs = ldbs;
+  return common::Error();
+}
+
+common::Error DBConnection::GetColumnFamilyStats(const std::string& name, ColumnFamilyStats* stats) {
+  if (!stats) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  ::rocksdb::ColumnFamilyHandle* family = rocksdb_find_family(connection_.handle_, name);
+  if (!family) {
+    return GenerateError(ROCKSDB_CFSTATS_COMMAND, common::MemSPrintf("Column family %s not found", name));
+  }
+
+  // both are estimations from table properties, no keys are read
+  ColumnFamilyStats lstats;
+  ::rocksdb::DB* db = connection_.handle_->db;
+  if (!db->GetIntProperty(family, "rocksdb.estimate-num-keys", &lstats.estimate_num_keys) ||
+      !db->GetIntProperty(family, "rocksdb.total-sst-files-size", &lstats.sst_files_size)) {
+    return GenerateError(ROCKSDB_CFSTATS_COMMAND, "Column family properties are not available");
+  }
+
+  *stats = lstats;
+  return common::Error();
+}
+
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   ::rocksdb::ReadOptions ro;
   const string_key_t key_str = key.GetKeyData();
   const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
-  return CheckResultCommand(DB_GET_KEY_COMMAND, connection_.handle_->Get(ro, key_slice, ret_val));
+  const ::rocksdb::Status st = connection_.handle_->db->Get(ro, connection_.handle_->family, key_slice, ret_val);
+  if (st.IsNotFound()) {
+    return KeyNotFound(found);
+  }
+
+  return CheckResultCommand(DB_GET_KEY_COMMAND, st);
 }
 
 common::Error DBConnection::Mget(const std::vector<std::string>& keys, std::vector<std::string>* ret) {
@@ -376,7 +640,8 @@ common::Error DBConnection::Mget(const std::vector<std::string>& keys, std::vect
     rslice.push_back(key);
   }
   ::rocksdb::ReadOptions ro;
-  auto sts = connection_.handle_->MultiGet(ro, rslice, ret);
+  const std::vector< ::rocksdb::ColumnFamilyHandle*> families(rslice.size(), connection_.handle_->family);
+  auto sts = connection_.handle_->db->MultiGet(ro, families, rslice, ret);
   for (size_t i = 0; i < sts.size(); ++i) {
     common::Error err = CheckResultCommand("MGET", sts[i]);
     if (err) {
@@ -398,14 +663,15 @@ common::Error DBConnection::Merge(const std::string& key, const std::string& val
   }
 
   ::rocksdb::WriteOptions wo;
-  return CheckResultCommand("MERGE", connection_.handle_->Merge(wo, key, value));
+  return CheckResultCommand("MERGE", connection_.handle_->db->Merge(wo, connection_.handle_->family, key, value));
 }
 
 common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   ::rocksdb::WriteOptions wo;
   const string_key_t key_str = key.GetKeyData();
   const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
-  return CheckResultCommand(DB_SET_KEY_COMMAND, connection_.handle_->Put(wo, key_slice, value));
+  return CheckResultCommand(DB_SET_KEY_COMMAND,
+                            connection_.handle_->db->Put(wo, connection_.handle_->family, key_slice, value));
 }
 
 common::Error DBConnection::DelInner(key_t key) {
@@ -418,7 +684,8 @@ common::Error DBConnection::DelInner(key_t key) {
   ::rocksdb::WriteOptions wo;
   const string_key_t key_str = key.GetKeyData();
   const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
-  return CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->Delete(wo, key_slice));
+  return CheckResultCommand(DB_DELETE_KEY_COMMAND,
+                            connection_.handle_->db->Delete(wo, connection_.handle_->family, key_slice));
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -426,17 +693,34 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t count_keys,
                                      std::vector<std::string>* keys_out,
                                      uint64_t* cursor_out) {
-  ::rocksdb::ReadOptions ro;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);  // keys(key_start, key_end, limit, ret);
+  const KeyPattern matcher(pattern);
+  const bool match_all = matcher.IsMatchAll();  // no per key matching for "*"
+  auto conf = GetConfig();
+  const bool prefix_seek = conf->comparator == COMP_BYTEWISE;  // prefix range needs bytewise order
+  ::rocksdb::ReadOptions ro = MakeKeysOnlyReadOptions();
+  const ::rocksdb::Slice upper_bound(matcher.GetUpperBound());
+  if (prefix_seek && !upper_bound.empty()) {
+    ro.iterate_upper_bound = &upper_bound;  // sst blocks past the prefix are not read at all
+  }
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, connection_.handle_->family);
   uint64_t offset_pos = cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
+  if (prefix_seek) {
+    it->Seek(matcher.GetPrefix());
+  } else {
+    it->SeekToFirst();
+  }
+  for (; it->Valid(); it->Next()) {
+    const ::rocksdb::Slice key = it->key();
+    if (prefix_seek && !matcher.IsPrefixOf(key.data(), key.size())) {
+      break;
+    }
+
     if (lkeys_out.size() < count_keys) {
-      if (common::MatchPattern(key, pattern)) {
+      if (match_all || matcher.Match(key.data(), key.size())) {
         if (offset_pos == 0) {
-          lkeys_out.push_back(key);
+          lkeys_out.push_back(key.ToString());
         } else {
           offset_pos--;
         }
@@ -464,8 +748,8 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
                                      const std::string& key_end,
                                      uint64_t limit,
                                      std::vector<std::string>* ret) {
-  ::rocksdb::ReadOptions ro;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);  // keys(key_start, key_end, limit, ret);
+  ::rocksdb::ReadOptions ro = MakeKeysOnlyReadOptions();
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, connection_.handle_->family);
   for (it->Seek(key_start); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     if (ret->size() < limit) {
@@ -484,8 +768,8 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  ::rocksdb::ReadOptions ro;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);
+  ::rocksdb::ReadOptions ro = MakeKeysOnlyReadOptions();
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, connection_.handle_->family);
   size_t sz = 0;
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     sz++;
@@ -504,29 +788,83 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
 }
 
 common::Error DBConnection::FlushDBImpl() {
-  ::rocksdb::ReadOptions ro;
+  ::rocksdb::ReadOptions ro = MakeKeysOnlyReadOptions();
   ::rocksdb::WriteOptions wo;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);
+  ::rocksdb::ColumnFamilyHandle* family = connection_.handle_->family;
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, family);
+  ::rocksdb::WriteBatch batch;
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
-    common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->Delete(wo, key));
-    if (err) {
-      delete it;
-      return err;
+    batch.Delete(family, it->key());
+    if (batch.Count() == ROCKSDB_WRITE_BATCH_SIZE) {
+      common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->db->Write(wo, &batch));
+      if (err) {
+        delete it;
+        return err;
+      }
+      batch.Clear();
     }
   }
 
   auto st = it->status();
   delete it;
 
-  return CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  return CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->db->Write(wo, &batch));
+}
+
+common::Error DBConnection::CreateDBImpl(const std::string& name, IDataBaseInfo** info) {
+  if (rocksdb_find_family(connection_.handle_, name)) {
+    return GenerateError(DB_CREATEDB_COMMAND, common::MemSPrintf("Column family %s already exists", name));
+  }
+
+  ::rocksdb::ColumnFamilyHandle* family = nullptr;
+  const ::rocksdb::ColumnFamilyOptions options(connection_.handle_->db->GetOptions());
+  common::Error err = CheckResultCommand(DB_CREATEDB_COMMAND,
+                                         connection_.handle_->db->CreateColumnFamily(options, name, &family));
+  if (err) {
+    return err;
+  }
+
+  connection_.handle_->families.push_back(family);
+  *info = new DataBaseInfo(name, false, 0);
+  return common::Error();
+}
+
+common::Error DBConnection::RemoveDBImpl(const std::string& name, IDataBaseInfo** info) {
+  if (name == ::rocksdb::kDefaultColumnFamilyName || name == GetCurrentDBName()) {
+    return GenerateError(DB_REMOVEDB_COMMAND, "Default or selected column family can't be dropped");
+  }
+
+  ::rocksdb::ColumnFamilyHandle* family = rocksdb_find_family(connection_.handle_, name);
+  if (!family) {
+    return GenerateError(DB_REMOVEDB_COMMAND, common::MemSPrintf("Column family %s not found", name));
+  }
+
+  common::Error err = CheckResultCommand(DB_REMOVEDB_COMMAND, connection_.handle_->db->DropColumnFamily(family));
+  if (err) {
+    return err;
+  }
+
+  std::vector< ::rocksdb::ColumnFamilyHandle*>& families = connection_.handle_->families;
+  families.erase(std::remove(families.begin(), families.end(), family), families.end());
+  ::rocksdb::Status st = connection_.handle_->db->DestroyColumnFamilyHandle(family);
+  UNUSED(st);
+  *info = new DataBaseInfo(name, false, 0);
+  return common::Error();
 }
 
 common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo** info) {
-  if (name != GetCurrentDBName()) {
+  ::rocksdb::ColumnFamilyHandle* family = rocksdb_find_family(connection_.handle_, name);
+  if (!family) {
     return ICommandTranslator::InvalidInputArguments(DB_SELECTDB_COMMAND);
   }
 
+  connection_.handle_->family = family;
+  connection_.config_->db_name = name;
   size_t kcount = 0;
   common::Error err = DBkcount(&kcount);
   DCHECK(!err);
@@ -547,11 +885,31 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::StoreKeysImpl(const std::vector<NDbKValue>& keys) {
+  ::rocksdb::WriteOptions wo;
+  ::rocksdb::WriteBatch batch;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const string_key_t key_str = keys[i].GetKey().GetKey().GetKeyData();
+    const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
+    batch.Put(connection_.handle_->family, key_slice, keys[i].GetValueString());
+    if (batch.Count() == ROCKSDB_WRITE_BATCH_SIZE) {
+      common::Error err = CheckResultCommand(DB_IMPORT_COMMAND, connection_.handle_->db->Write(wo, &batch));
+      if (err) {
+        return err;
+      }
+      batch.Clear();
+    }
+  }
+
+  return CheckResultCommand(DB_IMPORT_COMMAND, connection_.handle_->db->Write(wo, &batch));
+}
+
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
@@ -561,17 +919,30 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
+  ::rocksdb::WriteBatch batch;
+  NKeys ldeleted_keys;
   for (size_t i = 0; i < keys.size(); ++i) {
     NKey key = keys[i];
     key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
+    std::string exist_key;
+    common::Error err = GetInner(key_str, &exist_key);
     if (err) {
       continue;
     }
 
-    deleted_keys->push_back(key);
+    const string_key_t raw_key = key_str.GetKeyData();
+    const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(raw_key.data()), raw_key.size());
+    batch.Delete(connection_.handle_->family, key_slice);
+    ldeleted_keys.push_back(key);
+  }
+
+  ::rocksdb::WriteOptions wo;
+  common::Error err = CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->db->Write(wo, &batch));
+  if (err) {
+    return err;
   }
 
+  deleted_keys->insert(deleted_keys->end(), ldeleted_keys.begin(), ldeleted_keys.end());
   return common::Error();
 }
 
@@ -24,7 +24,6 @@
 #include "core/db/rocksdb/server_info.h"
 
 namespace rocksdb {
-class DB;
 class Status;
 }  // namespace rocksdb
 
@@ -32,7 +31,15 @@ namespace fastonosql {
 namespace core {
 namespace rocksdb {
 
-typedef ::rocksdb::DB NativeConnection;
+struct rocksdb;
+typedef rocksdb NativeConnection;
+
+struct ColumnFamilyStats {
+  ColumnFamilyStats();
+
+  uint64_t estimate_num_keys;
+  uint64_t sst_files_size;
+};
 
 common::Error CreateConnection(const Config& config, NativeConnection** context);
 common::Error TestConnection(const Config& config);
@@ -45,6 +52,8 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual std::string GetCurrentDBName() const override;
 
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
+  common::Error ConfigGetDatabases(std::vector<std::string>* dbs) WARN_UNUSED_RESULT;
+  common::Error GetColumnFamilyStats(const std::string& name, ColumnFamilyStats* stats) WARN_UNUSED_RESULT;
   common::Error Mget(const std::vector<std::string>& keys, std::vector<std::string>* ret);
   common::Error Merge(const std::string& key, const std::string& value) WARN_UNUSED_RESULT;
 
@@ -52,7 +61,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   common::Error CheckResultCommand(const std::string& cmd, const ::rocksdb::Status& err) WARN_UNUSED_RESULT;
 
   common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
   common::Error DelInner(key_t key) WARN_UNUSED_RESULT;
 
   virtual common::Error ScanImpl(uint64_t cursor_in,
@@ -66,12 +75,15 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
                                  std::vector<std::string>* ret) override;
   virtual common::Error DBkcountImpl(size_t* size) override;
   virtual common::Error FlushDBImpl() override;
+  virtual common::Error CreateDBImpl(const std::string& name, IDataBaseInfo** info) override;
+  virtual common::Error RemoveDBImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
+  virtual common::Error StoreKeysImpl(const std::vector<NDbKValue>& keys) override;
 };
 
 }  // namespace rocksdb
@@ -38,6 +38,45 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
+common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+  DBConnection* rocks = static_cast<DBConnection*>(handler);
+  if (argv[0] != "databases") {
+    return common::make_error_inval();
+  }
+
+  std::vector<std::string> dbs;
+  common::Error err = rocks->ConfigGetDatabases(&dbs);
+  if (err) {
+    return err;
+  }
+
+  common::ArrayValue* arr = new common::ArrayValue;
+  arr->AppendStrings(dbs);
+  FastoObject* child = new FastoObject(out, arr, rocks->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::ColumnFamilyStats(internal::CommandHandler* handler,
+                                             commands_args_t argv,
+                                             FastoObject* out) {
+  DBConnection* rocks = static_cast<DBConnection*>(handler);
+  core::rocksdb::ColumnFamilyStats stats;
+  common::Error err = rocks->GetColumnFamilyStats(argv.size() == 1 ? argv[0] : rocks->GetCurrentDBName(), &stats);
+  if (err) {
+    return err;
+  }
+
+  common::ArrayValue* arr = common::Value::CreateArrayValue();
+  arr->Append(common::Value::CreateStringValue("estimate_num_keys"));
+  arr->Append(common::Value::CreateULongLongIntegerValue(stats.estimate_num_keys));
+  arr->Append(common::Value::CreateStringValue("sst_files_size"));
+  arr->Append(common::Value::CreateULongLongIntegerValue(stats.sst_files_size));
+  FastoObject* child = new FastoObject(out, arr, rocks->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
 common::Error CommandsApi::Mget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
   DBConnection* rocks = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
@@ -20,6 +20,8 @@
 
 #include "core/internal/commands_api.h"  // for ApiTraits
 
+#define ROCKSDB_CFSTATS_COMMAND "CFSTATS"
+
 namespace fastonosql {
 namespace core {
 namespace rocksdb {
@@ -27,6 +29,8 @@ namespace rocksdb {
 class DBConnection;
 struct CommandsApi : public internal::ApiTraits<DBConnection> {
   static common::Error Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error ColumnFamilyStats(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error Mget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error Merge(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
 };
@@ -158,6 +158,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         0,
                                                         CommandInfo::Native,
                                                         &CommandsApi::GetTTL),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Extended,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Extended,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -832,9 +852,14 @@ common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   return CheckResultCommand(DB_SET_KEY_COMMAND, connection_.handle_->set(key_slice, value));
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   const std::string key_slice = ConvertToSSDBSlice(key);
-  return CheckResultCommand(DB_GET_KEY_COMMAND, connection_.handle_->get(key_slice, ret_val));
+  const ::ssdb::Status st = connection_.handle_->get(key_slice, ret_val);
+  if (st.not_found()) {
+    return KeyNotFound(found);
+  }
+
+  return CheckResultCommand(DB_GET_KEY_COMMAND, st);
 }
 
 common::Error DBConnection::DelInner(key_t key) {
@@ -1583,11 +1608,12 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
@@ -18,16 +18,20 @@
 
 #include "core/db/unqlite/db_connection.h"
 
+#include <string.h>
+
 extern "C" {
 #include <unqlite.h>
 }
 
+#include <common/convert2string.h>
 #include <common/file_system/file_system.h>
 #include <common/file_system/string_path_utils.h>
 
 #include "core/db/unqlite/command_translator.h"
 #include "core/db/unqlite/database_info.h"
 #include "core/db/unqlite/internal/commands_api.h"
+#include "core/key_pattern.h"
 
 namespace {
 
@@ -92,6 +96,27 @@ int unqlite_data_callback(const void* pData, unsigned int nDatalen, void* str) {
   return UNQLITE_OK;
 }
 
+// big keys come in several chunks; the buffer is cleared, not freed, between entries,
+// so walking the database doesn't allocate per key
+int unqlite_key_chunks_callback(const void* pData, unsigned int nDatalen, void* buff) {
+  std::string* out = static_cast<std::string*>(buff);
+  out->append(reinterpret_cast<const char*>(pData), nDatalen);
+  return UNQLITE_OK;
+}
+
+// reserved record with keys count, hidden from SCAN/KEYS/FLUSHDB
+const char kKeysCountKey[] = "\0fastonosql:keys_count";
+const size_t kKeysCountKeySize = sizeof(kKeysCountKey) - 1;
+
+bool unqlite_is_keys_count_key(const std::string& key) {
+  return key.size() == kKeysCountKeySize && memcmp(key.data(), kKeysCountKey, kKeysCountKeySize) == 0;
+}
+
+int unqlite_cursor_key(unqlite_kv_cursor* cursor, std::string* buff) {
+  buff->clear();
+  return unqlite_kv_cursor_key_callback(cursor, unqlite_key_chunks_callback, buff);
+}
+
 }  // namespace
 
 namespace fastonosql {
@@ -199,6 +224,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         INFINITE_COMMAND_ARGS,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Delete),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -324,22 +369,111 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
 }
 
 common::Error DBConnection::SetInner(key_t key, const std::string& value) {
+  size_t count = 0;  // walked before mutation if database has no counter yet
+  common::Error err = GetKeysCount(&count);
+  if (err) {
+    return err;
+  }
+
   const string_key_t key_slice = key.GetKeyData();
-  return CheckResultCommand(DB_SET_KEY_COMMAND, unqlite_kv_store(connection_.handle_, key_slice.data(),
-                                                                 key_slice.size(), value.c_str(), value.length()));
+  unqlite_int64 exist_size = 0;  // NULL buffer, only checks existence
+  const bool exists =
+      unqlite_kv_fetch(connection_.handle_, key_slice.data(), key_slice.size(), NULL, &exist_size) == UNQLITE_OK;
+  err = CheckResultCommand(DB_SET_KEY_COMMAND, unqlite_kv_store(connection_.handle_, key_slice.data(), key_slice.size(),
+                                                                 value.c_str(), value.length()));
+  if (err || exists) {
+    return err;
+  }
+
+  return SetKeysCount(count + 1);
 }
 
 common::Error DBConnection::DelInner(key_t key) {
+  size_t count = 0;  // walked before mutation if database has no counter yet
+  common::Error err = GetKeysCount(&count);
+  if (err) {
+    return err;
+  }
+
   const string_key_t key_slice = key.GetKeyData();
-  return CheckResultCommand(DB_DELETE_KEY_COMMAND,
-                            unqlite_kv_delete(connection_.handle_, key_slice.data(), key_slice.size()));
+  err = CheckResultCommand(DB_DELETE_KEY_COMMAND,
+                           unqlite_kv_delete(connection_.handle_, key_slice.data(), key_slice.size()));
+  if (err) {
+    return err;
+  }
+
+  return SetKeysCount(count ? count - 1 : 0);
+}
+
+common::Error DBConnection::CountKeys(size_t* count) {
+  unqlite_kv_cursor* pCur; /* Cursor handle */
+  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, unqlite_kv_cursor_init(connection_.handle_, &pCur));
+  if (err) {
+    return err;
+  }
+
+  size_t sz = 0;
+  std::string key;
+  for (unqlite_kv_cursor_first_entry(pCur); unqlite_kv_cursor_valid_entry(pCur);
+       unqlite_kv_cursor_next_entry(pCur)) {
+    int key_size = 0;
+    if (unqlite_kv_cursor_key(pCur, NULL, &key_size) == UNQLITE_OK &&
+        static_cast<size_t>(key_size) == kKeysCountKeySize && unqlite_cursor_key(pCur, &key) == UNQLITE_OK &&
+        unqlite_is_keys_count_key(key)) {
+      continue;
+    }
+    sz++;
+  }
+  unqlite_kv_cursor_release(connection_.handle_, pCur);
+
+  *count = sz;
+  return common::Error();
+}
+
+common::Error DBConnection::GetKeysCount(size_t* count) {
+  std::string count_str;
+  int rc = unqlite_kv_fetch_callback(connection_.handle_, kKeysCountKey, kKeysCountKeySize, unqlite_data_callback,
+                                     &count_str);
+  uint64_t lcount = 0;
+  if (rc == UNQLITE_OK && common::ConvertFromString(count_str, &lcount)) {
+    *count = lcount;
+    return common::Error();
+  }
+
+  // database written without us, walk it once and keep the result if it can be stored
+  size_t walked = 0;
+  common::Error err = CountKeys(&walked);
+  if (err) {
+    return err;
+  }
+
+  auto conf = GetConfig();
+  if (!conf->ReadOnlyDB()) {
+    err = SetKeysCount(walked);
+    if (err) {
+      return err;
+    }
+  }
+
+  *count = walked;
+  return common::Error();
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::SetKeysCount(size_t count) {
+  const std::string count_str = common::ConvertToString(static_cast<uint64_t>(count));
+  return CheckResultCommand(DB_SET_KEY_COMMAND, unqlite_kv_store(connection_.handle_, kKeysCountKey, kKeysCountKeySize,
+                                                                 count_str.c_str(), count_str.size()));
+}
+
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   const string_key_t key_slice = key.GetKeyData();
-  return CheckResultCommand(DB_GET_KEY_COMMAND,
-                            unqlite_kv_fetch_callback(connection_.handle_, key_slice.data(), key_slice.size(),
-                                                      unqlite_data_callback, ret_val));
+  const int rc = unqlite_kv_fetch_callback(connection_.handle_, key_slice.data(), key_slice.size(),
+                                           unqlite_data_callback, ret_val);
+  if (rc == UNQLITE_NOTFOUND) {
+    return KeyNotFound(found);
+  }
+
+  return CheckResultCommand(DB_GET_KEY_COMMAND, rc);
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -355,15 +489,16 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
   /* Point to the first record */
   unqlite_kv_cursor_first_entry(pCur);
 
-  /* Iterate over the entries */
+  /* Iterate over the entries, hash order so there is no prefix range */
+  const KeyPattern matcher(pattern);
   uint64_t offset_pos = cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
+  std::string skey;
   while (unqlite_kv_cursor_valid_entry(pCur)) {
     if (lkeys_out.size() < count_keys) {
-      std::string skey;
-      unqlite_kv_cursor_key_callback(pCur, unqlite_data_callback, &skey);
-      if (common::MatchPattern(skey, pattern)) {
+      unqlite_cursor_key(pCur, &skey);
+      if (!unqlite_is_keys_count_key(skey) && matcher.Match(skey)) {
         if (offset_pos == 0) {
           lkeys_out.push_back(skey);
         } else {
@@ -395,14 +530,14 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
   if (err) {
     return err;
   }
-  /* Point to the first record */
+  /* Point to the first record, records are in hash order so the whole range is walked */
   unqlite_kv_cursor_first_entry(pCur);
 
   /* Iterate over the entries */
+  std::string key;
   while (unqlite_kv_cursor_valid_entry(pCur) && limit > ret->size()) {
-    std::string key;
-    unqlite_kv_cursor_key_callback(pCur, unqlite_data_callback, &key);
-    if (key_start < key && key_end > key) {
+    unqlite_cursor_key(pCur, &key);
+    if (key_start < key && key_end > key && !unqlite_is_keys_count_key(key)) {
       ret->push_back(key);
     }
 
@@ -416,27 +551,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  /* Allocate a new cursor instance */
-  unqlite_kv_cursor* pCur; /* Cursor handle */
-  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, unqlite_kv_cursor_init(connection_.handle_, &pCur));
-  if (err) {
-    return err;
-  }
-  /* Point to the first record */
-  unqlite_kv_cursor_first_entry(pCur);
-
-  size_t sz = 0;
-  /* Iterate over the entries */
-  while (unqlite_kv_cursor_valid_entry(pCur)) {
-    sz++;
-    /* Point to the next entry */
-    unqlite_kv_cursor_next_entry(pCur);
-  }
-  /* Finally, Release our cursor */
-  unqlite_kv_cursor_release(connection_.handle_, pCur);
-
-  *size = sz;
-  return common::Error();
+  return GetKeysCount(size);
 }
 
 common::Error DBConnection::FlushDBImpl() {
@@ -448,13 +563,13 @@ common::Error DBConnection::FlushDBImpl() {
   /* Point to the first record */
   unqlite_kv_cursor_first_entry(pCur);
 
-  /* Iterate over the entries */
+  /* Collect keys first, records are not deleted under an open cursor */
+  std::vector<std::string> keys;
+  std::string key;
   while (unqlite_kv_cursor_valid_entry(pCur)) {
-    std::string key;
-    unqlite_kv_cursor_key_callback(pCur, unqlite_data_callback, &key);
-    common::Error err = DelInner(key_t(key));
-    if (err) {
-      return err;
+    unqlite_cursor_key(pCur, &key);
+    if (!unqlite_is_keys_count_key(key)) {
+      keys.push_back(key);
     }
     /* Point to the next entry */
     unqlite_kv_cursor_next_entry(pCur);
@@ -462,7 +577,16 @@ common::Error DBConnection::FlushDBImpl() {
 
   /* Finally, Release our cursor */
   unqlite_kv_cursor_release(connection_.handle_, pCur);
-  return common::Error();
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND,
+                                           unqlite_kv_delete(connection_.handle_, keys[i].data(), keys[i].size()));
+    if (err) {
+      return err;
+    }
+  }
+
+  return SetKeysCount(0);
 }
 
 common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo** info) {
@@ -490,11 +614,12 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
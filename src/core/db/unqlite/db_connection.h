@@ -47,7 +47,12 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
 
   common::Error DelInner(key_t key) WARN_UNUSED_RESULT;
   common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
+
+  // keys count is kept in a reserved record, walk is done only if the record is missing
+  common::Error CountKeys(size_t* count) WARN_UNUSED_RESULT;
+  common::Error GetKeysCount(size_t* count) WARN_UNUSED_RESULT;
+  common::Error SetKeysCount(size_t count) WARN_UNUSED_RESULT;
 
   virtual common::Error ScanImpl(uint64_t cursor_in,
                                  const std::string& pattern,
@@ -63,7 +68,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
 };
@@ -25,11 +25,14 @@ namespace core {
 namespace upscaledb {
 
 struct Config : public LocalConfig {
-  enum { default_db_num = 1 };
+  enum { default_db_num = 1, default_write_batch_size = 1000 };
   Config();
 
   bool create_if_missing;
   uint16_t dbnum;
+  bool enable_transactions;       // UPS_ENABLE_TRANSACTIONS on the environment
+  bool enable_duplicates;         // UPS_ENABLE_DUPLICATE_KEYS for created databases
+  unsigned int write_batch_size;  // keys per transaction for bulk writes (multi key DEL, FLUSHDB)
 };
 
 }  // namespace upscaledb
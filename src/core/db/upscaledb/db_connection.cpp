@@ -18,6 +18,8 @@
 
 #include "core/db/upscaledb/db_connection.h"
 
+#include <algorithm>
+
 #include <ups/upscaledb.h>
 
 #include <common/convert2string.h>
@@ -26,6 +28,7 @@
 #include "core/db/upscaledb/command_translator.h"
 #include "core/db/upscaledb/database_info.h"
 #include "core/db/upscaledb/internal/commands_api.h"
+#include "core/key_pattern.h"
 
 namespace fastonosql {
 namespace core {
@@ -53,6 +56,7 @@ struct upscaledb {
   ups_env_t* env;
   ups_db_t* db;
   uint16_t cur_db;
+  bool transactions;
 };
 
 namespace {
@@ -158,6 +162,26 @@ const ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAND,
                                                         INFINITE_COMMAND_ARGS,
                                                         CommandInfo::Native,
                                                         &CommandsApi::Delete),
+                                          CommandHolder(DB_EXPORT_COMMAND,
+                                                        "<path> [MATCH <pattern>] [COUNT <n>] "
+                                                        "[COMPRESS] [CHECKSUM] [RESUME]",
+                                                        "Stream keys with values and ttl "
+                                                        "into engine independent dump file",
+                                                        UNDEFINED_SINCE,
+                                                        "EXPORT ~/keys.dump MATCH user:* COUNT 1000 COMPRESS CHECKSUM",
+                                                        1,
+                                                        7,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Export),
+                                          CommandHolder(DB_IMPORT_COMMAND,
+                                                        "<path> [FROM <block>]",
+                                                        "Load keys from dump file made by EXPORT with batched writes",
+                                                        UNDEFINED_SINCE,
+                                                        "IMPORT ~/keys.dump",
+                                                        1,
+                                                        2,
+                                                        CommandInfo::Native,
+                                                        &CommandsApi::Import),
                                           CommandHolder(DB_QUIT_COMMAND,
                                                         "-",
                                                         "Close the connection",
@@ -190,7 +214,12 @@ int upscaledb_select(upscaledb* context, uint16_t num) {
   return UPS_SUCCESS;
 }
 
-ups_status_t upscaledb_open(upscaledb** context, const char* dbpath, uint16_t db, bool create_if_missing) {
+ups_status_t upscaledb_open(upscaledb** context,
+                            const char* dbpath,
+                            uint16_t db,
+                            bool create_if_missing,
+                            uint32_t env_flags,
+                            uint32_t db_flags) {
   upscaledb* lcontext = reinterpret_cast<upscaledb*>(calloc(1, sizeof(upscaledb)));
   bool need_to_create = false;
   if (create_if_missing) {
@@ -200,14 +229,14 @@ ups_status_t upscaledb_open(upscaledb** context, const char* dbpath, uint16_t db
     }
   }
 
-  ups_status_t st =
-      need_to_create ? ups_env_create(&lcontext->env, dbpath, 0, 0664, 0) : ups_env_open(&lcontext->env, dbpath, 0, 0);
+  ups_status_t st = need_to_create ? ups_env_create(&lcontext->env, dbpath, env_flags, 0664, 0)
+                                   : ups_env_open(&lcontext->env, dbpath, env_flags, 0);
   if (st != UPS_SUCCESS) {
     free(lcontext);
     return st;
   }
 
-  st = need_to_create ? ups_env_create_db(lcontext->env, &lcontext->db, db, 0, NULL)
+  st = need_to_create ? ups_env_create_db(lcontext->env, &lcontext->db, db, db_flags, NULL)
                       : ups_env_open_db(lcontext->env, &lcontext->db, db, 0, NULL);
   if (st != UPS_SUCCESS) {
     free(lcontext);
@@ -215,6 +244,7 @@ ups_status_t upscaledb_open(upscaledb** context, const char* dbpath, uint16_t db
   }
 
   lcontext->cur_db = db;
+  lcontext->transactions = (env_flags & UPS_ENABLE_TRANSACTIONS) != 0;
   *context = lcontext;
   return UPS_SUCCESS;
 }
@@ -236,6 +266,33 @@ void upscaledb_close(upscaledb** context) {
   free(lcontext);
   *context = NULL;
 }
+
+// without transactions txn stays NULL and every operation commits on its own
+ups_status_t upscaledb_txn_begin(upscaledb* context, ups_txn_t** txn) {
+  *txn = NULL;
+  if (!context->transactions) {
+    return UPS_SUCCESS;
+  }
+
+  return ups_txn_begin(txn, context->env, NULL, NULL, 0);
+}
+
+ups_status_t upscaledb_txn_commit(ups_txn_t* txn) {
+  if (!txn) {
+    return UPS_SUCCESS;
+  }
+
+  return ups_txn_commit(txn, 0);
+}
+
+void upscaledb_txn_abort(ups_txn_t* txn) {
+  if (!txn) {
+    return;
+  }
+
+  ups_status_t st = ups_txn_abort(txn, 0);
+  DCHECK(st == UPS_SUCCESS);
+}
 }  // namespace
 }  // namespace upscaledb
 namespace internal {
@@ -297,7 +354,9 @@ common::Error CreateConnection(const Config& config, NativeConnection** context)
   }
 
   const char* dbname = db_path.empty() ? NULL : db_path.c_str();
-  int st = upscaledb_open(&lcontext, dbname, config.dbnum, config.create_if_missing);
+  const uint32_t env_flags = config.enable_transactions ? UPS_ENABLE_TRANSACTIONS : 0;
+  const uint32_t db_flags = config.enable_duplicates ? UPS_ENABLE_DUPLICATE_KEYS : 0;
+  int st = upscaledb_open(&lcontext, dbname, config.dbnum, config.create_if_missing, env_flags, db_flags);
   if (st != UPS_SUCCESS) {
     std::string buff = common::MemSPrintf("Fail open database: %s", ups_strerror(st));
     return common::make_error(buff);
@@ -369,7 +428,7 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   return common::Error();
 }
 
-common::Error DBConnection::SetInner(key_t key, const std::string& value) {
+common::Error DBConnection::SetInner(key_t key, const std::string& value, ups_txn_t* txn) {
   const string_key_t key_str = key.GetKeyData();
   ups_key_t key_slice = ConvertToUpscaleDBSlice(key_str);
 
@@ -378,18 +437,22 @@ common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   rec.data = const_cast<char*>(value.c_str());
   rec.size = value.size();
   return CheckResultCommand(DB_SET_KEY_COMMAND,
-                            ups_db_insert(connection_.handle_->db, 0, &key_slice, &rec, UPS_OVERWRITE));
+                            ups_db_insert(connection_.handle_->db, txn, &key_slice, &rec, UPS_OVERWRITE));
 }
 
-common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
+common::Error DBConnection::GetInner(key_t key, std::string* ret_val, bool* found) {
   const string_key_t key_str = key.GetKeyData();
   ups_key_t key_slice = ConvertToUpscaleDBSlice(key_str);
 
   ups_record_t rec;
   memset(&rec, 0, sizeof(rec));
 
-  common::Error err =
-      CheckResultCommand(DB_GET_KEY_COMMAND, ups_db_find(connection_.handle_->db, NULL, &key_slice, &rec, 0));
+  const ups_status_t st = ups_db_find(connection_.handle_->db, NULL, &key_slice, &rec, 0);
+  if (st == UPS_KEY_NOT_FOUND) {
+    return KeyNotFound(found);
+  }
+
+  common::Error err = CheckResultCommand(DB_GET_KEY_COMMAND, st);
   if (err) {
     return err;
   }
@@ -398,10 +461,11 @@ common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
   return common::Error();
 }
 
-common::Error DBConnection::DelInner(key_t key) {
+common::Error DBConnection::DelInner(key_t key, ups_txn_t* txn) {
   const string_key_t key_str = key.GetKeyData();
   ups_key_t key_slice = ConvertToUpscaleDBSlice(key_str);
-  return CheckResultCommand(DB_DELETE_KEY_COMMAND, ups_db_erase(connection_.handle_->db, 0, &key_slice, 0));
+  return CheckResultCommand(DB_DELETE_KEY_COMMAND,
+                            ups_db_erase(connection_.handle_->db, txn, &key_slice, UPS_ERASE_ALL_DUPLICATES));
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -411,10 +475,8 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t* cursor_out) {
   ups_cursor_t* cursor; /* upscaledb cursor object */
   ups_key_t key;
-  ups_record_t rec;
 
   memset(&key, 0, sizeof(key));
-  memset(&rec, 0, sizeof(rec));
 
   /* create a new cursor */
   common::Error err = CheckResultCommand(DB_SCAN_COMMAND, ups_cursor_create(&cursor, connection_.handle_->db, 0, 0));
@@ -422,22 +484,57 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
     return err;
   }
 
+  const KeyPattern matcher(pattern);
+  const bool match_all = matcher.IsMatchAll();  // no per key matching for "*"
+  const std::string& prefix = matcher.GetPrefix();
+  bool positioned = prefix.empty();
   ups_status_t st = UPS_SUCCESS;
   uint64_t offset_pos = cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
   while (st == UPS_SUCCESS) {
     if (lkeys_out.size() < count_keys) {
-      /* fetch the next item, and repeat till we've reached the end
-       * of the database */
-      st = ups_cursor_move(cursor, &key, &rec, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
+      if (!positioned) {
+        /* first key not less than prefix */
+        key.data = const_cast<char*>(prefix.data());
+        key.size = static_cast<uint16_t>(prefix.size());
+        st = ups_cursor_find(cursor, &key, NULL, UPS_FIND_GEQ_MATCH);
+        positioned = true;
+      } else {
+        /* fetch the next key without its record, and repeat till we've reached the end
+         * of the database */
+        st = ups_cursor_move(cursor, &key, NULL, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
+      }
       if (st == UPS_SUCCESS) {
-        std::string skey(reinterpret_cast<const char*>(key.data), key.size);
-        if (common::MatchPattern(skey, pattern)) {
-          if (offset_pos == 0) {
-            lkeys_out.push_back(skey);
-          } else {
-            offset_pos--;
+        const char* key_data = reinterpret_cast<const char*>(key.data);
+        if (!matcher.IsPrefixOf(key_data, key.size)) {
+          break;
+        }
+
+        if (match_all || matcher.Match(key_data, key.size)) {
+          // every duplicate is a record of its own, listed under the same key
+          uint32_t dups_count = 1;
+          st = ups_cursor_get_duplicate_count(cursor, &dups_count, 0);
+          if (st != UPS_SUCCESS) {
+            ups_cursor_close(cursor);
+            std::string buff = common::MemSPrintf("SCAN function error: %s", ups_strerror(st));
+            return common::make_error(buff);
+          }
+
+          uint64_t records = dups_count;
+          if (offset_pos >= records) {  // whole group is on previous pages
+            offset_pos -= records;
+            continue;
+          }
+
+          records -= offset_pos;
+          offset_pos = 0;
+          for (; records > 0 && lkeys_out.size() < count_keys; --records) {
+            lkeys_out.push_back(std::string(key_data, key.size));
+          }
+          if (records > 0) {  // page ends inside of the group
+            lcursor_out = cursor_in + count_keys;
+            break;
           }
         }
       } else if (st != UPS_KEY_NOT_FOUND) {
@@ -463,10 +560,8 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
                                      std::vector<std::string>* ret) {
   ups_cursor_t* cursor; /* upscaledb cursor object */
   ups_key_t key;
-  ups_record_t rec;
 
   memset(&key, 0, sizeof(key));
-  memset(&rec, 0, sizeof(rec));
 
   /* create a new cursor */
   common::Error err = CheckResultCommand(DB_KEYS_COMMAND, ups_cursor_create(&cursor, connection_.handle_->db, 0, 0));
@@ -476,7 +571,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 
   ups_status_t st;
   do {
-    st = ups_cursor_move(cursor, &key, &rec, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
+    st = ups_cursor_move(cursor, &key, NULL, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
     if (st == UPS_SUCCESS) {
       std::string skey(reinterpret_cast<const char*>(key.data), key.size);
       if (key_start < skey && key_end > skey) {
@@ -496,7 +591,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 common::Error DBConnection::DBkcountImpl(size_t* size) {
   uint64_t sz = 0;
   common::Error err =
-      CheckResultCommand(DB_DBKCOUNT_COMMAND, ups_db_count(connection_.handle_->db, NULL, UPS_SKIP_DUPLICATES, &sz));
+      CheckResultCommand(DB_DBKCOUNT_COMMAND, ups_db_count(connection_.handle_->db, NULL, 0, &sz));  // with duplicates
   if (err) {
     return err;
   }
@@ -506,35 +601,62 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
 }
 
 common::Error DBConnection::FlushDBImpl() {
-  ups_cursor_t* cursor; /* upscaledb cursor object */
-  ups_key_t key;
-  ups_record_t rec;
+  auto conf = GetConfig();
+  const size_t batch_size = conf->write_batch_size ? conf->write_batch_size : 1;
+  std::vector<string_key_t> batch;
+  while (true) {
+    ups_cursor_t* cursor; /* upscaledb cursor object */
+    ups_key_t key;
 
-  memset(&key, 0, sizeof(key));
-  memset(&rec, 0, sizeof(rec));
+    memset(&key, 0, sizeof(key));
 
-  /* create a new cursor */
-  common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, ups_cursor_create(&cursor, connection_.handle_->db, 0, 0));
-  if (err) {
-    return err;
-  }
+    /* create a new cursor */
+    common::Error err =
+        CheckResultCommand(DB_FLUSHDB_COMMAND, ups_cursor_create(&cursor, connection_.handle_->db, 0, 0));
+    if (err) {
+      return err;
+    }
 
-  ups_status_t st;
-  do {
-    /* fetch the next item, and repeat till we've reached the end
-     * of the database */
-    st = ups_cursor_move(cursor, &key, &rec, UPS_CURSOR_NEXT);
-    if (st == UPS_SUCCESS) {
-      ups_db_erase(connection_.handle_->db, 0, &key, 0);
-    } else if (st && st != UPS_KEY_NOT_FOUND) {
-      ups_cursor_close(cursor);
+    // erased keys are gone, so every batch is read from the start
+    batch.clear();
+    ups_status_t st = ups_cursor_move(cursor, &key, NULL, UPS_CURSOR_FIRST);
+    while (st == UPS_SUCCESS) {
+      batch.push_back(string_key_t(reinterpret_cast<const command_buffer_char_t*>(key.data), key.size));
+      if (batch.size() == batch_size) {
+        break;
+      }
+      st = ups_cursor_move(cursor, &key, NULL, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
+    }
+    ups_cursor_close(cursor);
+    if (st != UPS_SUCCESS && st != UPS_KEY_NOT_FOUND) {
       std::string buff = common::MemSPrintf("FLUSHDB function error: %s", ups_strerror(st));
       return common::make_error(buff);
     }
-  } while (st == UPS_SUCCESS);
 
-  ups_cursor_close(cursor);
-  return common::Error();
+    if (batch.empty()) {
+      return common::Error();
+    }
+
+    ups_txn_t* txn = NULL;
+    err = CheckResultCommand(DB_FLUSHDB_COMMAND, upscaledb_txn_begin(connection_.handle_, &txn));
+    if (err) {
+      return err;
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+      ups_key_t bkey = ConvertToUpscaleDBSlice(batch[i]);
+      st = ups_db_erase(connection_.handle_->db, txn, &bkey, UPS_ERASE_ALL_DUPLICATES);
+      if (st != UPS_SUCCESS && st != UPS_KEY_NOT_FOUND) {
+        upscaledb_txn_abort(txn);
+        return CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+      }
+    }
+
+    err = CheckResultCommand(DB_FLUSHDB_COMMAND, upscaledb_txn_commit(txn));
+    if (err) {
+      return err;
+    }
+  }
 }
 
 common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo** info) {
@@ -560,7 +682,7 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
   std::string value_str = key.GetValueString();
-  common::Error err = SetInner(key_str, value_str);
+  common::Error err = SetInner(key_str, value_str, NULL);
   if (err) {
     return err;
   }
@@ -569,11 +691,40 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   return common::Error();
 }
 
-common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
+common::Error DBConnection::StoreKeysImpl(const std::vector<NDbKValue>& keys) {
+  auto conf = GetConfig();
+  const size_t batch_size = conf->write_batch_size ? conf->write_batch_size : 1;
+  for (size_t i = 0; i < keys.size(); i += batch_size) {
+    ups_txn_t* txn = NULL;
+    common::Error err = CheckResultCommand(DB_IMPORT_COMMAND, upscaledb_txn_begin(connection_.handle_, &txn));
+    if (err) {
+      return err;
+    }
+
+    const size_t batch_end = std::min(keys.size(), i + batch_size);
+    for (size_t j = i; j < batch_end; ++j) {
+      err = SetInner(keys[j].GetKey().GetKey(), keys[j].GetValueString(), txn);
+      if (err) {
+        upscaledb_txn_abort(txn);
+        return err;
+      }
+    }
+
+    err = CheckResultCommand(DB_IMPORT_COMMAND, upscaledb_txn_commit(txn));
+    if (err) {
+      return err;
+    }
+  }
+
+  return common::Error();
+}
+
+common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) {
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
-  if (err) {
+  *found = true;
+  common::Error err = GetInner(key_str, &value_str, found);
+  if (err || !*found) {
     return err;
   }
 
@@ -583,15 +734,34 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
-  for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
+  auto conf = GetConfig();
+  const size_t batch_size = conf->write_batch_size ? conf->write_batch_size : 1;
+  for (size_t i = 0; i < keys.size(); i += batch_size) {
+    ups_txn_t* txn = NULL;
+    common::Error err = CheckResultCommand(DB_DELETE_KEY_COMMAND, upscaledb_txn_begin(connection_.handle_, &txn));
+    if (err) {
+      return err;
+    }
+
+    NKeys batch_deleted;
+    const size_t batch_end = std::min(keys.size(), i + batch_size);
+    for (size_t j = i; j < batch_end; ++j) {
+      NKey key = keys[j];
+      key_t key_str = key.GetKey();
+      err = DelInner(key_str, txn);
+      if (err) {
+        continue;
+      }
+
+      batch_deleted.push_back(key);
+    }
+
+    err = CheckResultCommand(DB_DELETE_KEY_COMMAND, upscaledb_txn_commit(txn));
     if (err) {
-      continue;
+      return err;
     }
 
-    deleted_keys->push_back(key);
+    deleted_keys->insert(deleted_keys->end(), batch_deleted.begin(), batch_deleted.end());
   }
 
   return common::Error();
@@ -605,12 +775,12 @@ common::Error DBConnection::RenameImpl(const NKey& key, string_key_t new_key) {
     return err;
   }
 
-  err = DelInner(key_str);
+  err = DelInner(key_str, NULL);
   if (err) {
     return err;
   }
 
-  err = SetInner(key_t(new_key), value_str);
+  err = SetInner(key_t(new_key), value_str, NULL);
   if (err) {
     return err;
   }
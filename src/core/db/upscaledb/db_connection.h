@@ -25,6 +25,8 @@
 #include "core/db/upscaledb/config.h"
 #include "core/db/upscaledb/server_info.h"  // for ServerInfo
 
+struct ups_txn_t;
+
 namespace fastonosql {
 namespace core {
 namespace upscaledb {
@@ -49,9 +51,9 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
  private:
   common::Error CheckResultCommand(const std::string& cmd, ups_status_t err) WARN_UNUSED_RESULT;
 
-  common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
-  common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
-  common::Error DelInner(key_t key) WARN_UNUSED_RESULT;
+  common::Error SetInner(key_t key, const std::string& value, ups_txn_t* txn) WARN_UNUSED_RESULT;
+  common::Error GetInner(key_t key, std::string* ret_val, bool* found = nullptr) WARN_UNUSED_RESULT;
+  common::Error DelInner(key_t key, ups_txn_t* txn) WARN_UNUSED_RESULT;
 
   virtual common::Error ScanImpl(uint64_t cursor_in,
                                  const std::string& pattern,
@@ -66,10 +68,11 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error FlushDBImpl() override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
+  virtual common::Error StoreKeysImpl(const std::vector<NDbKValue>& keys) override;
 };
 
 }  // namespace upscaledb
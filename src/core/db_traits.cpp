@@ -72,6 +72,11 @@ std::vector<common::Value::Type> GetSupportedValueTypes(connectionTypes type) {
   if (type == FORESTDB) {
     return DBTraits<FORESTDB>::GetSupportedValueTypes();
   }
+#endif
+#ifdef BUILD_WITH_RDB
+  if (type == RDB) {
+    return DBTraits<RDB>::GetSupportedValueTypes();
+  }
 #endif
   NOTREACHED();
   return std::vector<common::Value::Type>();
@@ -122,6 +127,11 @@ std::vector<info_field_t> GetInfoFieldsFromType(connectionTypes type) {
   if (type == FORESTDB) {
     return DBTraits<FORESTDB>::GetInfoFields();
   }
+#endif
+#ifdef BUILD_WITH_RDB
+  if (type == RDB) {
+    return DBTraits<RDB>::GetInfoFields();
+  }
 #endif
   NOTREACHED();
   return std::vector<info_field_t>();
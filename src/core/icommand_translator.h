@@ -45,6 +45,9 @@
 #define DB_KEYS_COMMAND "KEYS"          // exist for all
 #define DB_SCAN_COMMAND "SCAN"          // exist for all
 
+#define DB_EXPORT_COMMAND "EXPORT"
+#define DB_IMPORT_COMMAND "IMPORT"
+
 namespace fastonosql {
 namespace core {
 
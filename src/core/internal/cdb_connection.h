@@ -19,6 +19,7 @@
 #pragma once
 
 #include <common/sprintf.h>
+#include <common/time.h>
 
 #include "core/constant_commands_array.h"
 #include "core/internal/cdb_connection_client.h"
@@ -26,6 +27,7 @@
 #include "core/internal/db_connection.h"    // for DBConnection
 
 #include "core/database/idatabase_info.h"
+#include "core/logical_dump.h"
 
 namespace fastonosql {
 namespace core {
@@ -83,11 +85,33 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
   common::Error ModuleUnLoad(const ModuleInfo& module) WARN_UNUSED_RESULT;                 // nvi
   common::Error Quit() WARN_UNUSED_RESULT;                                                 // nvi
 
+  // bulk api of EXPORT and IMPORT, client is not notified per key
+  common::Error LoadKeys(const NKeys& keys, std::vector<NDbKValue>* loaded_keys) WARN_UNUSED_RESULT;  // nvi
+  common::Error StoreKeys(const std::vector<NDbKValue>& keys) WARN_UNUSED_RESULT;                     // nvi
+  common::Error ExportDump(const DumpConfig& dconfig,
+                           dump_report_observer_t observer,
+                           DumpReport* report) WARN_UNUSED_RESULT;
+  common::Error ImportDump(const DumpConfig& dconfig,
+                           dump_report_observer_t observer,
+                           DumpReport* report) WARN_UNUSED_RESULT;
+
  protected:
   common::Error GenerateError(const std::string& cmd, const std::string& descr) WARN_UNUSED_RESULT {
     const std::string buff = common::MemSPrintf("%s function error: %s", cmd, descr);
     return common::make_error(buff);
   }
+  common::Error GenerateKeyNotFoundError() WARN_UNUSED_RESULT {
+    return GenerateError(DB_GET_KEY_COMMAND, "key not found.");
+  }
+  // missing key on GetImpl path: clears found if caller asked for it, otherwise it is an error
+  common::Error KeyNotFound(bool* found) WARN_UNUSED_RESULT {
+    if (found) {
+      *found = false;
+      return common::Error();
+    }
+
+    return GenerateKeyNotFoundError();
+  }
   CDBConnectionClient* client_;
 
  private:
@@ -109,13 +133,18 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
 
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) = 0;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) = 0;
-  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) = 0;
+  virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key, bool* found) = 0;  // missing key is not error
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) = 0;
   virtual common::Error SetTTLImpl(const NKey& key, ttl_t ttl);      // optional
   virtual common::Error GetTTLImpl(const NKey& key, ttl_t* ttl);     // optional
   virtual common::Error ModuleLoadImpl(const ModuleInfo& module);    // optional
   virtual common::Error ModuleUnLoadImpl(const ModuleInfo& module);  // optional
   virtual common::Error QuitImpl() = 0;
+
+  // optional, missing keys are skipped, default loads key by key with GET and TTL
+  virtual common::Error LoadKeysImpl(const NKeys& keys, std::vector<NDbKValue>* loaded_keys);
+  // optional, default stores key by key with SET and EXPIRE
+  virtual common::Error StoreKeysImpl(const std::vector<NDbKValue>& keys);
 };
 
 template <typename NConnection, typename Config, connectionTypes ContType>
@@ -405,11 +434,16 @@ common::Error CDBConnection<NConnection, Config, ContType>::Get(const NKey& key,
     return err;
   }
 
-  err = GetImpl(key, loaded_key);
+  bool found = false;
+  err = GetImpl(key, loaded_key, &found);
   if (err) {
     return err;
   }
 
+  if (!found) {
+    return GenerateKeyNotFoundError();
+  }
+
   if (client_) {
     client_->OnLoadedKey(*loaded_key);
   }
@@ -536,6 +570,226 @@ common::Error CDBConnection<NConnection, Config, ContType>::Quit() {
   return common::Error();
 }
 
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::LoadKeys(const NKeys& keys,
+                                                                     std::vector<NDbKValue>* loaded_keys) {
+  if (!loaded_keys) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = CDBConnection<NConnection, Config, ContType>::TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  return LoadKeysImpl(keys, loaded_keys);
+}
+
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::StoreKeys(const std::vector<NDbKValue>& keys) {
+  common::Error err = CDBConnection<NConnection, Config, ContType>::TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  return StoreKeysImpl(keys);
+}
+
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::ExportDump(const DumpConfig& dconfig,
+                                                                       dump_report_observer_t observer,
+                                                                       DumpReport* report) {
+  if (!report) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = CDBConnection<NConnection, Config, ContType>::TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  // connection thread scans and loads pages, writer thread encodes, compresses and writes them
+  static const CommandsStats::usec_t progress_interval = 1000000;
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  CommandsStats::usec_t progress_ts = start_ts;
+  DumpWriter writer;
+  DumpReport lreport;
+  uint64_t cursor = 0;
+  err = writer.Open(dconfig, &lreport, &cursor);
+  if (err) {
+    return err;
+  }
+
+  bool completed = lreport.blocks && cursor == 0;  // resumed dump which missed only end block
+  while (!completed && !CDBConnection<NConnection, Config, ContType>::IsInterrupted()) {
+    std::vector<std::string> keys;
+    uint64_t cursor_out = 0;
+    err = Scan(cursor, dconfig.pattern, dconfig.count, &keys, &cursor_out);
+    if (err) {
+      break;
+    }
+
+    NKeys nkeys;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      nkeys.push_back(NKey(key_t(keys[i])));
+    }
+
+    DumpBlock block;
+    block.cursor = cursor_out;
+    if (!nkeys.empty()) {
+      err = LoadKeys(nkeys, &block.records);
+      if (err) {
+        break;
+      }
+      block.load_ms = common::time::current_mstime();
+      lreport.skipped += nkeys.size() - block.records.size();
+    }
+
+    const size_t records = block.records.size();
+    if (records) {
+      if (!writer.Write(&block)) {
+        break;  // write error is returned by Close
+      }
+      lreport.blocks++;
+      lreport.keys += records;
+    }
+
+    cursor = cursor_out;
+    completed = cursor == 0;
+    if (observer && CommandsStats::Now() - progress_ts >= progress_interval) {
+      progress_ts = CommandsStats::Now();
+      lreport.bytes = writer.GetWrittenBytes();
+      lreport.msec = (progress_ts - start_ts) / 1000;
+      observer(lreport);
+    }
+  }
+
+  common::Error close_err = writer.Close(completed && !err);
+  if (!err) {
+    err = close_err;
+  }
+
+  lreport.bytes = writer.GetWrittenBytes();
+  lreport.msec = (CommandsStats::Now() - start_ts) / 1000;
+  lreport.completed = completed && !err;
+  *report = lreport;
+  return err;
+}
+
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::ImportDump(const DumpConfig& dconfig,
+                                                                       dump_report_observer_t observer,
+                                                                       DumpReport* report) {
+  if (!report) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = CDBConnection<NConnection, Config, ContType>::TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  // reader thread reads, verifies and decodes blocks, connection thread stores them in native batches
+  static const CommandsStats::usec_t progress_interval = 1000000;
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  CommandsStats::usec_t progress_ts = start_ts;
+  DumpReader reader;
+  err = reader.Open(dconfig);
+  if (err) {
+    return err;
+  }
+
+  DumpReport lreport;
+  lreport.blocks = dconfig.from_block;
+  DumpBlock block;
+  while (!CDBConnection<NConnection, Config, ContType>::IsInterrupted() && reader.Read(&block)) {
+    err = StoreKeys(block.records);
+    if (err) {
+      break;
+    }
+
+    lreport.blocks++;
+    lreport.keys += block.records.size();
+    lreport.skipped += block.expired;
+    if (observer && CommandsStats::Now() - progress_ts >= progress_interval) {
+      progress_ts = CommandsStats::Now();
+      lreport.bytes = reader.GetReadBytes();
+      lreport.msec = (progress_ts - start_ts) / 1000;
+      observer(lreport);
+    }
+  }
+
+  common::Error close_err = reader.Close();
+  if (!err) {
+    err = close_err;
+  }
+
+  lreport.bytes = reader.GetReadBytes();
+  lreport.msec = (CommandsStats::Now() - start_ts) / 1000;
+  lreport.completed = !err && reader.IsCompleted();
+  *report = lreport;
+  return err;
+}
+
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::LoadKeysImpl(const NKeys& keys,
+                                                                         std::vector<NDbKValue>* loaded_keys) {
+  for (size_t i = 0; i < keys.size(); ++i) {
+    NDbKValue loaded_key;
+    bool found = false;
+    common::Error err = GetImpl(keys[i], &loaded_key, &found);
+    if (err) {
+      return err;
+    }
+
+    if (!found) {
+      continue;  // deleted or expired after SCAN
+    }
+
+    if (IsSupportTTLKeys(ContType)) {
+      ttl_t ttl = NO_TTL;
+      err = GetTTLImpl(keys[i], &ttl);
+      if (!err) {
+        if (ttl == EXPIRED_TTL) {
+          continue;
+        }
+
+        NKey key = loaded_key.GetKey();
+        key.SetTTL(ttl);
+        loaded_key.SetKey(key);
+      }
+    }
+
+    loaded_keys->push_back(loaded_key);
+  }
+
+  return common::Error();
+}
+
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::StoreKeysImpl(const std::vector<NDbKValue>& keys) {
+  for (size_t i = 0; i < keys.size(); ++i) {
+    NDbKValue added_key;
+    common::Error err = SetImpl(keys[i], &added_key);
+    if (err) {
+      return err;
+    }
+
+    const NKey key = keys[i].GetKey();
+    if (key.GetTTL() > 0 && IsSupportTTLKeys(ContType)) {
+      err = SetTTLImpl(key, key.GetTTL());
+      if (err) {
+        return err;
+      }
+    }
+  }
+
+  return common::Error();
+}
+
 template <typename NConnection, typename Config, connectionTypes ContType>
 common::Error CDBConnection<NConnection, Config, ContType>::SetTTLImpl(const NKey& key, ttl_t ttl) {
   UNUSED(key);
@@ -28,7 +28,7 @@ namespace fastonosql {
 namespace core {
 namespace internal {
 
-CommandHandler::CommandHandler(ICommandTranslator* translator) : translator_(translator) {}
+CommandHandler::CommandHandler(ICommandTranslator* translator) : commands_stats_(), translator_(translator) {}
 
 common::Error CommandHandler::Execute(const command_buffer_t& command, FastoObject* out) {
   command_buffer_t stabled_command = StableCommand(command);
@@ -64,7 +64,11 @@ common::Error CommandHandler::Execute(commands_args_t argv, FastoObject* out) {
   for (size_t i = off; i < argv.size(); ++i) {
     stabled.push_back(argv[i]);
   }
-  return cmd->func_(this, stabled, out);
+
+  const CommandsStats::usec_t start_ts = CommandsStats::Now();
+  err = cmd->func_(this, stabled, out);
+  commands_stats_.RecordCommand(cmd->name, CommandsStats::Now() - start_ts, err ? true : false);
+  return err;
 }
 
 }  // namespace internal
@@ -20,6 +20,7 @@
 
 #include <memory>
 
+#include "core/commands_stats.h"
 #include "core/icommand_translator.h"
 
 namespace fastonosql {
@@ -35,12 +36,17 @@ class CommandHandler {
 
   translator_t GetTranslator() const { return translator_; }
 
+  CommandsStatsSnapShoot GetCommandsStats() const { return commands_stats_.MakeSnapShoot(); }
+  void ResetCommandsStats() { commands_stats_.Reset(); }
+
  protected:
   template <typename T>
   std::shared_ptr<T> GetSpecificTranslator() const {
     return std::static_pointer_cast<T>(translator_);
   }
 
+  CommandsStats commands_stats_;
+
  private:
   translator_t translator_;
 };
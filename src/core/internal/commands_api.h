@@ -50,6 +50,9 @@ struct ApiTraits {
   static common::Error ModuleLoad(CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error ModuleUnLoad(CommandHandler* handler, commands_args_t argv, FastoObject* out);
   static common::Error Quit(CommandHandler* handler, commands_args_t argv, FastoObject* out);
+
+  static common::Error Export(CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error Import(CommandHandler* handler, commands_args_t argv, FastoObject* out);
 };
 
 template <class CDBConnection>
@@ -401,6 +404,67 @@ common::Error ApiTraits<CDBConnection>::Quit(internal::CommandHandler* handler,
   return common::Error();
 }
 
+template <class CDBConnection>
+common::Error ApiTraits<CDBConnection>::Export(internal::CommandHandler* handler,
+                                               commands_args_t argv,
+                                               FastoObject* out) {
+  DumpConfig dconfig;
+  common::Error err = ParseDumpExportArgs(argv, &dconfig);
+  if (err) {
+    return err;
+  }
+
+  CDBConnection* cdb = static_cast<CDBConnection*>(handler);
+  auto progress = [cdb, out](const DumpReport& report) {
+    common::StringValue* val = common::Value::CreateStringValue(common::ConvertToString(report));
+    FastoObject* child = new FastoObject(out, val, cdb->GetDelimiter());
+    out->AddChildren(child);
+  };
+  DumpReport report;
+  err = cdb->ExportDump(dconfig, progress, &report);
+  if (err) {
+    if (!report.blocks) {
+      return err;
+    }
+    return common::make_error(common::MemSPrintf("%s, %llu blocks written, run again with RESUME to continue",
+                                                 err->GetDescription(),
+                                                 static_cast<unsigned long long>(report.blocks)));
+  }
+
+  progress(report);
+  return common::Error();
+}
+
+template <class CDBConnection>
+common::Error ApiTraits<CDBConnection>::Import(internal::CommandHandler* handler,
+                                               commands_args_t argv,
+                                               FastoObject* out) {
+  DumpConfig dconfig;
+  common::Error err = ParseDumpImportArgs(argv, &dconfig);
+  if (err) {
+    return err;
+  }
+
+  CDBConnection* cdb = static_cast<CDBConnection*>(handler);
+  auto progress = [cdb, out](const DumpReport& report) {
+    common::StringValue* val = common::Value::CreateStringValue(common::ConvertToString(report));
+    FastoObject* child = new FastoObject(out, val, cdb->GetDelimiter());
+    out->AddChildren(child);
+  };
+  DumpReport report;
+  err = cdb->ImportDump(dconfig, progress, &report);
+  if (err) {
+    if (report.blocks == dconfig.from_block) {
+      return err;
+    }
+    return common::make_error(common::MemSPrintf("%s, run again with FROM %llu to continue", err->GetDescription(),
+                                                 static_cast<unsigned long long>(report.blocks)));
+  }
+
+  progress(report);
+  return common::Error();
+}
+
 }  // namespace internal
 }  // namespace core
 }  // namespace fastonosql
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "core/connection_types.h"  // for connectionTypes
 
 #include "core/internal/connection.h"  // for Connection, ConnectionAllocatorTr...
@@ -84,7 +86,7 @@ class DBConnection {
   config_t GetConfig() const { return connection_.config_; }
 
   dbconnection_t connection_;
-  bool interrupted_;
+  std::atomic<bool> interrupted_;  // set from gui thread, checked by connection thread
 };
 
 }  // namespace internal
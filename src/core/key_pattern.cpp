@@ -0,0 +1,182 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/key_pattern.h"
+
+#include <string.h>
+
+#include <algorithm>  // for swap
+
+namespace fastonosql {
+namespace core {
+namespace {
+const size_t kNoPos = static_cast<size_t>(-1);
+
+std::string MakeUpperBound(const std::string& prefix) {
+  std::string bound = prefix;
+  while (!bound.empty()) {
+    unsigned char last = static_cast<unsigned char>(bound[bound.size() - 1]);
+    if (last != 0xff) {
+      bound[bound.size() - 1] = static_cast<char>(last + 1);
+      return bound;
+    }
+    bound.erase(bound.size() - 1);
+  }
+  return bound;
+}
+}  // namespace
+
+KeyPattern::Token::Token(Type type) : type(type), literal(), chars() {}
+
+bool KeyPattern::Token::MatchAt(const char* key, size_t size, size_t pos) const {
+  if (type == LITERAL) {
+    return size - pos >= literal.size() && memcmp(key + pos, literal.data(), literal.size()) == 0;
+  } else if (type == ANY_CHAR) {
+    return pos < size;
+  } else if (type == CHAR_CLASS) {
+    return pos < size && chars[static_cast<unsigned char>(key[pos])];
+  }
+
+  return false;
+}
+
+size_t KeyPattern::Token::GetLength() const {
+  return type == LITERAL ? literal.size() : 1;
+}
+
+KeyPattern::KeyPattern(const std::string& pattern) : prefix_(), upper_bound_(), tokens_() {
+  const size_t len = pattern.size();
+  for (size_t i = 0; i < len; ++i) {
+    const char c = pattern[i];
+    if (c == '*') {
+      if (tokens_.empty() || tokens_.back().type != Token::ANY_SEQUENCE) {
+        tokens_.push_back(Token(Token::ANY_SEQUENCE));
+      }
+    } else if (c == '?') {
+      tokens_.push_back(Token(Token::ANY_CHAR));
+    } else if (c == '[') {
+      Token cls(Token::CHAR_CLASS);
+      cls.chars.assign(256, false);
+      bool negate = false;
+      i++;
+      if (i < len && pattern[i] == '^') {
+        negate = true;
+        i++;
+      }
+      // same as redis stringmatchlen: unterminated class runs to the end of pattern
+      for (; i < len && pattern[i] != ']'; ++i) {
+        if (pattern[i] == '\\' && i + 1 < len) {
+          i++;
+          cls.chars[static_cast<unsigned char>(pattern[i])] = true;
+        } else if (i + 2 < len && pattern[i + 1] == '-') {
+          unsigned char start = pattern[i];
+          unsigned char end = pattern[i + 2];
+          if (start > end) {
+            std::swap(start, end);
+          }
+          for (unsigned ch = start; ch <= end; ++ch) {
+            cls.chars[ch] = true;
+          }
+          i += 2;
+        } else {
+          cls.chars[static_cast<unsigned char>(pattern[i])] = true;
+        }
+      }
+      if (negate) {
+        cls.chars.flip();
+      }
+      tokens_.push_back(cls);
+    } else {
+      char lit = c;
+      if (c == '\\' && i + 1 < len) {
+        lit = pattern[++i];
+      }
+      if (tokens_.empty() || tokens_.back().type != Token::LITERAL) {
+        tokens_.push_back(Token(Token::LITERAL));
+      }
+      tokens_.back().literal += lit;
+    }
+  }
+
+  if (!tokens_.empty() && tokens_.front().type == Token::LITERAL) {
+    prefix_ = tokens_.front().literal;
+    tokens_.erase(tokens_.begin());
+  }
+  upper_bound_ = MakeUpperBound(prefix_);
+}
+
+const std::string& KeyPattern::GetPrefix() const {
+  return prefix_;
+}
+
+const std::string& KeyPattern::GetUpperBound() const {
+  return upper_bound_;
+}
+
+bool KeyPattern::IsMatchAll() const {
+  return prefix_.empty() && tokens_.size() == 1 && tokens_.front().type == Token::ANY_SEQUENCE;
+}
+
+bool KeyPattern::IsPrefixOf(const char* key, size_t size) const {
+  return size >= prefix_.size() && memcmp(key, prefix_.data(), prefix_.size()) == 0;
+}
+
+bool KeyPattern::Match(const char* key, size_t size) const {
+  if (!IsPrefixOf(key, size)) {
+    return false;
+  }
+
+  // greedy with backtracking to the last star only, linear for patterns without stars
+  size_t pos = prefix_.size();
+  size_t ti = 0;
+  size_t star_ti = kNoPos;
+  size_t star_pos = 0;
+  while (pos < size || ti < tokens_.size()) {
+    if (ti < tokens_.size()) {
+      const Token& tok = tokens_[ti];
+      if (tok.type == Token::ANY_SEQUENCE) {
+        star_ti = ti++;
+        star_pos = pos;
+        continue;
+      }
+
+      if (tok.MatchAt(key, size, pos)) {
+        pos += tok.GetLength();
+        ti++;
+        continue;
+      }
+    }
+
+    if (star_ti != kNoPos && star_pos < size) {
+      pos = ++star_pos;
+      ti = star_ti + 1;
+      continue;
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
+bool KeyPattern::Match(const std::string& key) const {
+  return Match(key.data(), key.size());
+}
+
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,64 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+namespace fastonosql {
+namespace core {
+
+// glob pattern (redis KEYS syntax: *, ?, [a-z], [^abc], \x) compiled once per SCAN.
+// Keys matching the pattern always start with GetPrefix(), so ordered engines seek to the
+// prefix and stop at GetUpperBound() instead of matching the whole keyspace.
+class KeyPattern {
+ public:
+  explicit KeyPattern(const std::string& pattern);
+
+  const std::string& GetPrefix() const;
+  // first key greater than all keys with prefix, empty if there is no such key
+  const std::string& GetUpperBound() const;
+
+  bool IsMatchAll() const;
+  bool IsPrefixOf(const char* key, size_t size) const;
+  bool Match(const char* key, size_t size) const;
+  bool Match(const std::string& key) const;
+
+ private:
+  struct Token {
+    enum Type { LITERAL, ANY_CHAR, ANY_SEQUENCE, CHAR_CLASS };
+    explicit Token(Type type);
+
+    bool MatchAt(const char* key, size_t size, size_t pos) const;
+    size_t GetLength() const;
+
+    Type type;
+    std::string literal;
+    std::vector<bool> chars;  // CHAR_CLASS, 256 entries, negation already applied
+  };
+
+  std::string prefix_;
+  std::string upper_bound_;
+  std::vector<Token> tokens_;  // rest of pattern after prefix
+};
+
+}  // namespace core
+}  // namespace fastonosql
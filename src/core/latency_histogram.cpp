@@ -0,0 +1,149 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/latency_histogram.h"
+
+#include <math.h>
+
+namespace fastonosql {
+namespace core {
+namespace {
+const unsigned kSubBucketBits = 5;
+const uint64_t kSubBucketCount = 1 << kSubBucketBits;    // 32 exact values
+const uint64_t kSubBucketHalfCount = kSubBucketCount / 2;  // 16 buckets per power of two
+const size_t kBucketsCount = kSubBucketCount + (64 - kSubBucketBits) * kSubBucketHalfCount;
+
+unsigned MostSignificantBit(uint64_t value) {
+  unsigned msb = 0;
+  while (value >>= 1) {
+    msb++;
+  }
+  return msb;
+}
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() : counts_(kBucketsCount, 0), total_count_(0), min_(0), max_(0), sum_(0) {}
+
+size_t LatencyHistogram::IndexFor(uint64_t value) {
+  if (value < kSubBucketCount) {
+    return static_cast<size_t>(value);
+  }
+
+  const unsigned shift = MostSignificantBit(value) - (kSubBucketBits - 1);
+  const uint64_t sub = value >> shift;  // [kSubBucketHalfCount, kSubBucketCount)
+  return static_cast<size_t>(kSubBucketCount + (shift - 1) * kSubBucketHalfCount + (sub - kSubBucketHalfCount));
+}
+
+uint64_t LatencyHistogram::HighestEquivalentValue(size_t index) {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+
+  const uint64_t shift = (index - kSubBucketCount) / kSubBucketHalfCount + 1;
+  const uint64_t sub = (index - kSubBucketCount) % kSubBucketHalfCount + kSubBucketHalfCount;
+  return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t value) {
+  counts_[IndexFor(value)]++;
+  if (total_count_ == 0 || value < min_) {
+    min_ = value;
+  }
+  if (value > max_) {
+    max_ = value;
+  }
+  total_count_++;
+  sum_ += static_cast<double>(value);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+  if (other.total_count_ == 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  if (total_count_ == 0 || other.min_ < min_) {
+    min_ = other.min_;
+  }
+  if (other.max_ > max_) {
+    max_ = other.max_;
+  }
+  total_count_ += other.total_count_;
+  sum_ += other.sum_;
+}
+
+void LatencyHistogram::Reset() {
+  counts_.assign(kBucketsCount, 0);
+  total_count_ = 0;
+  min_ = 0;
+  max_ = 0;
+  sum_ = 0;
+}
+
+uint64_t LatencyHistogram::GetCount() const {
+  return total_count_;
+}
+
+uint64_t LatencyHistogram::GetMin() const {
+  return min_;
+}
+
+uint64_t LatencyHistogram::GetMax() const {
+  return max_;
+}
+
+double LatencyHistogram::GetMean() const {
+  if (total_count_ == 0) {
+    return 0;
+  }
+
+  return sum_ / static_cast<double>(total_count_);
+}
+
+uint64_t LatencyHistogram::GetValueAtPercentile(double percentile) const {
+  if (total_count_ == 0) {
+    return 0;
+  }
+
+  if (percentile < 0) {
+    percentile = 0;
+  } else if (percentile > 100) {
+    percentile = 100;
+  }
+
+  uint64_t target = static_cast<uint64_t>(ceil(percentile / 100.0 * static_cast<double>(total_count_)));
+  if (target == 0) {
+    target = 1;
+  }
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    cumulative += counts_[i];
+    if (cumulative >= target) {
+      uint64_t value = HighestEquivalentValue(i);
+      return value < max_ ? value : max_;
+    }
+  }
+
+  return max_;
+}
+
+}  // namespace core
+}  // namespace fastonosql
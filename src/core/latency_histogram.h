@@ -0,0 +1,59 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace fastonosql {
+namespace core {
+
+// HDR like histogram: values less than 32 stored exactly, bigger values stored in log-linear
+// buckets (16 per power of two), so relative error of any percentile is less than 1/16.
+// Values are unitless, by convention microseconds for latencies.
+class LatencyHistogram {
+ public:
+  LatencyHistogram();
+
+  void Record(uint64_t value);
+  void Merge(const LatencyHistogram& other);
+  void Reset();
+
+  uint64_t GetCount() const;
+  uint64_t GetMin() const;
+  uint64_t GetMax() const;
+  double GetMean() const;
+  uint64_t GetValueAtPercentile(double percentile) const;  // percentile in [0, 100]
+
+ private:
+  static size_t IndexFor(uint64_t value);
+  static uint64_t HighestEquivalentValue(size_t index);
+
+  std::vector<uint64_t> counts_;
+  uint64_t total_count_;
+  uint64_t min_;
+  uint64_t max_;
+  double sum_;
+};
+
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,781 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/logical_dump.h"
+
+#include <errno.h>
+#include <string.h>
+
+#ifdef OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <common/convert2string.h>
+#include <common/file_system/file_system.h>  // for prepare_path
+#include <common/sprintf.h>
+#include <common/string_util.h>
+#include <common/text_decoders/compress_zlib_edcoder.h>
+#include <common/time.h>
+#include <common/utils.h>  // for crc64
+
+#include "core/connection_types.h"  // for ALL_KEYS_PATTERNS
+#include "core/value.h"             // for ConvertValue
+
+#define DUMP_MAGIC "FASTODMP"
+#define DUMP_MAGIC_SIZE 8
+#define DUMP_VERSION 2
+#define DUMP_HEADER_SIZE (DUMP_MAGIC_SIZE + 2)
+
+#define DUMP_BLOCK_COMPRESSED 0x01
+#define DUMP_BLOCK_END 0x02
+
+#define DUMP_MAX_BLOCK_SIZE (1ULL << 31)  // guard against allocation from corrupted sizes
+
+namespace fastonosql {
+namespace core {
+
+namespace {
+
+enum DumpValueType { DUMP_STRING = 0, DUMP_LIST = 1, DUMP_SET = 2, DUMP_ZSET = 3, DUMP_HASH = 4 };
+
+struct DumpBlockHeader {
+  DumpBlockHeader() : flags(0), records(0), cursor(0), raw_size(0), stored_size(0), checksum(0), size(0) {}
+
+  unsigned char flags;
+  uint64_t records;
+  uint64_t cursor;
+  uint64_t raw_size;
+  uint64_t stored_size;
+  uint64_t checksum;
+  uint64_t size;  // header and stored data in file
+};
+
+void PutVarint(std::string* out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void PutFixed64(std::string* out, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out->push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+  }
+}
+
+void PutString(std::string* out, const std::string& value) {
+  PutVarint(out, value.size());
+  out->append(value);
+}
+
+bool GetVarint(const std::string& data, size_t* pos, uint64_t* value) {
+  uint64_t result = 0;
+  for (unsigned shift = 0; shift < 64 && *pos < data.size(); shift += 7) {
+    const unsigned char byte = data[(*pos)++];
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool GetString(const std::string& data, size_t* pos, std::string* value) {
+  uint64_t size = 0;
+  if (!GetVarint(data, pos, &size) || size > data.size() - *pos) {
+    return false;
+  }
+
+  value->assign(data, *pos, size);
+  *pos += size;
+  return true;
+}
+
+bool ReadVarint(FILE* file, uint64_t* value, uint64_t* size) {
+  uint64_t result = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    const int byte = fgetc(file);
+    if (byte == EOF) {
+      return false;
+    }
+
+    (*size)++;
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t Checksum(const std::string& data) {
+  common::buffer_t buff;
+  if (!common::ConvertFromString(data, &buff)) {
+    return 0;
+  }
+  return common::utils::hash::crc64(0, buff);
+}
+
+std::string MakeHeader(unsigned char flags) {
+  std::string header(DUMP_MAGIC, DUMP_MAGIC_SIZE);
+  header.push_back(static_cast<char>(DUMP_VERSION));
+  header.push_back(static_cast<char>(flags));
+  return header;
+}
+
+common::Error ReadHeader(FILE* file, unsigned char* flags) {
+  char header[DUMP_HEADER_SIZE];
+  if (fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, DUMP_MAGIC, DUMP_MAGIC_SIZE) != 0) {
+    return common::make_error("Not a dump file");
+  }
+
+  const unsigned char version = header[DUMP_MAGIC_SIZE];
+  if (version != DUMP_VERSION) {
+    return common::make_error(common::MemSPrintf("Unsupported dump version: %d", static_cast<int>(version)));
+  }
+
+  *flags = header[DUMP_MAGIC_SIZE + 1];
+  return common::Error();
+}
+
+// eof only at block boundary, torn or corrupted block is an error
+common::Error ReadBlock(FILE* file, unsigned char flags, DumpBlockHeader* header, std::string* stored, bool* eof) {
+  const int block_flags = fgetc(file);
+  if (block_flags == EOF) {
+    *eof = true;
+    return common::Error();
+  }
+
+  DumpBlockHeader lheader;
+  lheader.flags = block_flags;
+  lheader.size = 1;
+  if (!ReadVarint(file, &lheader.records, &lheader.size) || !ReadVarint(file, &lheader.cursor, &lheader.size) ||
+      !ReadVarint(file, &lheader.raw_size, &lheader.size) || !ReadVarint(file, &lheader.stored_size, &lheader.size)) {
+    return common::make_error("Torn dump block header");
+  }
+
+  if (lheader.raw_size > DUMP_MAX_BLOCK_SIZE || lheader.stored_size > DUMP_MAX_BLOCK_SIZE) {
+    return common::make_error("Corrupted dump block size");
+  }
+
+  if (flags & DUMP_FLAG_CHECKSUM) {
+    unsigned char crc[8];
+    if (fread(crc, 1, sizeof(crc), file) != sizeof(crc)) {
+      return common::make_error("Torn dump block header");
+    }
+    for (int i = 0; i < 8; ++i) {
+      lheader.checksum |= static_cast<uint64_t>(crc[i]) << (i * 8);
+    }
+    lheader.size += sizeof(crc);
+  }
+
+  std::string lstored(lheader.stored_size, 0);
+  if (lheader.stored_size && fread(&lstored[0], 1, lstored.size(), file) != lstored.size()) {
+    return common::make_error("Torn dump block");
+  }
+  lheader.size += lheader.stored_size;
+
+  if ((flags & DUMP_FLAG_CHECKSUM) && Checksum(lstored) != lheader.checksum) {
+    return common::make_error("Dump block checksum mismatch");
+  }
+
+  *header = lheader;
+  stored->swap(lstored);
+  *eof = false;
+  return common::Error();
+}
+
+common::Error DecodeBlock(const DumpBlockHeader& header, const std::string& stored, DumpBlock* block) {
+  const uint64_t now_ms = common::time::current_mstime();
+  if (!(header.flags & DUMP_BLOCK_COMPRESSED)) {
+    return DecodeDumpRecords(stored, header.records, now_ms, &block->records, &block->expired);
+  }
+
+  common::CompressZlibEDcoder dec;
+  std::string raw;
+  common::Error err = dec.Decode(stored, &raw);
+  if (err) {
+    return err;
+  }
+
+  if (raw.size() != header.raw_size) {
+    return common::make_error("Dump block size mismatch after decompression");
+  }
+  return DecodeDumpRecords(raw, header.records, now_ms, &block->records, &block->expired);
+}
+
+common::Error TruncateFile(FILE* file, uint64_t size) {
+  if (fflush(file) != 0) {
+    return common::make_error(common::MemSPrintf("Can't flush dump file, error: %s", strerror(errno)));
+  }
+
+#ifdef OS_WIN
+  const int res = _chsize_s(_fileno(file), size);
+#else
+  const int res = ftruncate(fileno(file), size);
+#endif
+  if (res != 0) {
+    return common::make_error(common::MemSPrintf("Can't truncate dump file, error: %s", strerror(errno)));
+  }
+
+  if (fseek(file, 0, SEEK_END) != 0) {
+    return common::make_error(common::MemSPrintf("Can't seek dump file, error: %s", strerror(errno)));
+  }
+  return common::Error();
+}
+
+std::string ConvertElement(common::Value* value) {
+  return ConvertValue(value, std::string(), false);
+}
+
+}  // namespace
+
+DumpConfig::DumpConfig()
+    : path(), pattern(ALL_KEYS_PATTERNS), count(default_count), flags(0), resume(false), from_block(0) {}
+
+DumpReport::DumpReport() : keys(0), skipped(0), blocks(0), bytes(0), msec(0), completed(false) {}
+
+DumpBlock::DumpBlock() : cursor(0), load_ms(0), expired(0), records() {}
+
+void EncodeDumpRecord(const NDbKValue& record, uint64_t now_ms, std::string* out) {
+  if (!out) {
+    DNOTREACHED();
+    return;
+  }
+
+  const NKey key = record.GetKey();
+  NValue value = record.GetValue();
+  common::Value* val = value.get();
+  const common::Value::Type type = val ? val->GetType() : common::Value::TYPE_NULL;
+  std::vector<std::string> elements;
+  unsigned char dump_type = DUMP_STRING;
+  if (type == common::Value::TYPE_ARRAY) {
+    dump_type = DUMP_LIST;
+    common::ArrayValue* arr = static_cast<common::ArrayValue*>(val);
+    for (auto it = arr->begin(); it != arr->end(); ++it) {
+      elements.push_back(ConvertElement(*it));
+    }
+  } else if (type == common::Value::TYPE_SET) {
+    dump_type = DUMP_SET;
+    common::SetValue* set = static_cast<common::SetValue*>(val);
+    for (auto it = set->begin(); it != set->end(); ++it) {
+      elements.push_back(ConvertElement(*it));
+    }
+  } else if (type == common::Value::TYPE_ZSET) {
+    dump_type = DUMP_ZSET;
+    common::ZSetValue* zset = static_cast<common::ZSetValue*>(val);
+    for (auto it = zset->begin(); it != zset->end(); ++it) {
+      auto v = *it;
+      elements.push_back(ConvertElement(v.second));  // member
+      elements.push_back(ConvertElement(v.first));   // score
+    }
+  } else if (type == common::Value::TYPE_HASH) {
+    dump_type = DUMP_HASH;
+    common::HashValue* hash = static_cast<common::HashValue*>(val);
+    for (auto it = hash->begin(); it != hash->end(); ++it) {
+      auto v = *it;
+      elements.push_back(ConvertElement(v.first));
+      elements.push_back(ConvertElement(v.second));
+    }
+  } else if (val) {
+    elements.push_back(ConvertElement(val));
+  }
+
+  const ttl_t ttl = key.GetTTL();
+  out->push_back(static_cast<char>(dump_type));
+  PutString(out, key.GetKey().GetKeyData());
+  PutVarint(out, ttl > 0 ? now_ms + static_cast<uint64_t>(ttl) * 1000 : 0);
+  if (dump_type == DUMP_STRING) {
+    PutString(out, elements.empty() ? std::string() : elements[0]);
+    return;
+  }
+
+  PutVarint(out, dump_type == DUMP_ZSET || dump_type == DUMP_HASH ? elements.size() / 2 : elements.size());
+  for (size_t i = 0; i < elements.size(); ++i) {
+    PutString(out, elements[i]);
+  }
+}
+
+common::Error DecodeDumpRecords(const std::string& data,
+                                uint64_t count,
+                                uint64_t now_ms,
+                                std::vector<NDbKValue>* records,
+                                uint64_t* expired) {
+  if (!records || !expired) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  static const char corrupted[] = "Corrupted dump record";
+  std::vector<NDbKValue> lrecords;
+  uint64_t lexpired = 0;
+  size_t pos = 0;
+  for (uint64_t i = 0; i < count; ++i) {
+    if (pos >= data.size()) {
+      return common::make_error(corrupted);
+    }
+
+    const unsigned char dump_type = data[pos++];
+    std::string key;
+    uint64_t expire_ms = 0;
+    if (!GetString(data, &pos, &key) || !GetVarint(data, &pos, &expire_ms)) {
+      return common::make_error(corrupted);
+    }
+
+    common::Value* value = nullptr;
+    if (dump_type == DUMP_STRING) {
+      std::string str;
+      if (!GetString(data, &pos, &str)) {
+        return common::make_error(corrupted);
+      }
+      value = common::Value::CreateStringValue(str);
+    } else if (dump_type <= DUMP_HASH) {
+      uint64_t size = 0;
+      if (!GetVarint(data, &pos, &size)) {
+        return common::make_error(corrupted);
+      }
+
+      const bool pairs = dump_type == DUMP_ZSET || dump_type == DUMP_HASH;
+      std::vector<std::string> elements;
+      for (uint64_t j = 0; j < (pairs ? size * 2 : size); ++j) {
+        std::string element;
+        if (!GetString(data, &pos, &element)) {
+          return common::make_error(corrupted);
+        }
+        elements.push_back(element);
+      }
+
+      if (dump_type == DUMP_LIST) {
+        common::ArrayValue* arr = common::Value::CreateArrayValue();
+        for (size_t j = 0; j < elements.size(); ++j) {
+          arr->AppendString(elements[j]);
+        }
+        value = arr;
+      } else if (dump_type == DUMP_SET) {
+        common::SetValue* set = common::Value::CreateSetValue();
+        for (size_t j = 0; j < elements.size(); ++j) {
+          set->Insert(common::Value::CreateStringValue(elements[j]));
+        }
+        value = set;
+      } else if (dump_type == DUMP_ZSET) {
+        common::ZSetValue* zset = common::Value::CreateZSetValue();
+        for (size_t j = 0; j + 1 < elements.size(); j += 2) {
+          zset->Insert(common::Value::CreateStringValue(elements[j + 1]),
+                       common::Value::CreateStringValue(elements[j]));
+        }
+        value = zset;
+      } else {
+        common::HashValue* hash = common::Value::CreateHashValue();
+        for (size_t j = 0; j + 1 < elements.size(); j += 2) {
+          hash->Insert(common::Value::CreateStringValue(elements[j]),
+                       common::Value::CreateStringValue(elements[j + 1]));
+        }
+        value = hash;
+      }
+    } else {
+      return common::make_error(common::MemSPrintf("Unknown dump value type: %d", static_cast<int>(dump_type)));
+    }
+
+    NValue nvalue(value);
+    if (expire_ms && expire_ms <= now_ms) {
+      lexpired++;  // expired while dump was stored
+      continue;
+    }
+
+    const ttl_t ttl = expire_ms ? static_cast<ttl_t>((expire_ms - now_ms + 999) / 1000) : NO_TTL;  // rounded up
+    lrecords.push_back(NDbKValue(NKey(key_t(key), ttl), nvalue));
+  }
+
+  if (pos != data.size()) {
+    return common::make_error(corrupted);
+  }
+
+  records->swap(lrecords);
+  *expired = lexpired;
+  return common::Error();
+}
+
+DumpWriter::DumpWriter(size_t queue_size) : queue_(queue_size), file_(nullptr), flags_(0), bytes_(0), error_() {}
+
+DumpWriter::~DumpWriter() {
+  if (file_) {
+    common::Error err = Close(false);
+    UNUSED(err);
+  }
+}
+
+common::Error DumpWriter::Open(const DumpConfig& dconfig, DumpReport* report, uint64_t* cursor) {
+  if (!report || !cursor) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (file_) {
+    return common::make_error("Dump file already opened");
+  }
+
+  DumpReport lreport;
+  uint64_t lcursor = 0;
+  unsigned char flags = dconfig.flags;
+  FILE* file = dconfig.resume ? fopen(dconfig.path.c_str(), "r+b") : nullptr;
+  if (file) {
+    common::Error err = ReadHeader(file, &flags);
+    if (err) {
+      fclose(file);
+      return err;
+    }
+
+    // complete blocks are kept, torn tail of interrupted export is cut
+    uint64_t offset = DUMP_HEADER_SIZE;
+    while (true) {
+      DumpBlockHeader header;
+      std::string stored;
+      bool eof = false;
+      err = ReadBlock(file, flags, &header, &stored, &eof);
+      if (err || eof) {
+        break;
+      }
+
+      if (header.flags & DUMP_BLOCK_END) {
+        fclose(file);
+        return common::make_error("Dump is already complete, nothing to resume");
+      }
+
+      offset += header.size;
+      lreport.blocks++;
+      lreport.keys += header.records;
+      lcursor = header.cursor;
+    }
+
+    err = TruncateFile(file, offset);
+    if (err) {
+      fclose(file);
+      return err;
+    }
+    lreport.bytes = offset;
+  } else {
+    file = fopen(dconfig.path.c_str(), "wb");
+    if (!file) {
+      return common::make_error(
+          common::MemSPrintf("Can't open dump file: %s, error: %s", dconfig.path, strerror(errno)));
+    }
+
+    const std::string header = MakeHeader(flags);
+    if (fwrite(header.data(), 1, header.size(), file) != header.size()) {
+      fclose(file);
+      return common::make_error(common::MemSPrintf("Can't write dump file, error: %s", strerror(errno)));
+    }
+    lreport.bytes = header.size();
+  }
+
+  file_ = file;
+  flags_ = flags;
+  bytes_ = lreport.bytes;
+  error_ = common::Error();
+  thread_ = std::thread(&DumpWriter::Run, this);
+  *report = lreport;
+  *cursor = lcursor;
+  return common::Error();
+}
+
+bool DumpWriter::Write(DumpBlock* block) {
+  return queue_.Push(block);
+}
+
+common::Error DumpWriter::Close(bool completed) {
+  if (!file_) {
+    return common::make_error("Dump file not opened");
+  }
+
+  queue_.Close();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  common::Error err = error_;
+  if (!err && completed) {
+    std::string end;
+    end.push_back(static_cast<char>(DUMP_BLOCK_END));
+    PutVarint(&end, 0);  // records
+    PutVarint(&end, 0);  // cursor
+    PutVarint(&end, 0);  // raw size
+    PutVarint(&end, 0);  // stored size
+    if (flags_ & DUMP_FLAG_CHECKSUM) {
+      PutFixed64(&end, Checksum(std::string()));
+    }
+    err = WriteRaw(end);
+  }
+
+  if (fclose(file_) != 0 && !err) {
+    err = common::make_error(common::MemSPrintf("Can't close dump file, error: %s", strerror(errno)));
+  }
+  file_ = nullptr;
+  return err;
+}
+
+uint64_t DumpWriter::GetWrittenBytes() const {
+  return bytes_;
+}
+
+void DumpWriter::Run() {
+  DumpBlock block;
+  while (queue_.Pop(&block)) {
+    std::string raw;
+    for (size_t i = 0; i < block.records.size(); ++i) {
+      EncodeDumpRecord(block.records[i], block.load_ms, &raw);
+    }
+
+    const uint64_t raw_size = raw.size();
+    unsigned char block_flags = 0;
+    std::string stored;
+    if (flags_ & DUMP_FLAG_COMPRESSED) {
+      common::CompressZlibEDcoder enc;
+      common::Error err = enc.Encode(raw, &stored);
+      if (!err && stored.size() < raw.size()) {
+        block_flags |= DUMP_BLOCK_COMPRESSED;
+      }
+    }
+    if (!(block_flags & DUMP_BLOCK_COMPRESSED)) {
+      stored.swap(raw);  // incompressible data is stored as is
+    }
+
+    std::string header;
+    header.push_back(static_cast<char>(block_flags));
+    PutVarint(&header, block.records.size());
+    PutVarint(&header, block.cursor);
+    PutVarint(&header, raw_size);
+    PutVarint(&header, stored.size());
+    if (flags_ & DUMP_FLAG_CHECKSUM) {
+      PutFixed64(&header, Checksum(stored));
+    }
+
+    common::Error err = WriteRaw(header);
+    if (!err) {
+      err = WriteRaw(stored);
+    }
+    if (err) {
+      error_ = err;
+      queue_.Close();  // producer is stopped on next write
+      return;
+    }
+  }
+}
+
+common::Error DumpWriter::WriteRaw(const std::string& data) {
+  if (fwrite(data.data(), 1, data.size(), file_) != data.size()) {
+    return common::make_error(common::MemSPrintf("Can't write dump file, error: %s", strerror(errno)));
+  }
+
+  bytes_ += data.size();
+  return common::Error();
+}
+
+DumpReader::DumpReader(size_t queue_size)
+    : queue_(queue_size), file_(nullptr), flags_(0), bytes_(0), completed_(false), error_() {}
+
+DumpReader::~DumpReader() {
+  if (file_) {
+    common::Error err = Close();
+    UNUSED(err);
+  }
+}
+
+common::Error DumpReader::Open(const DumpConfig& dconfig) {
+  if (file_) {
+    return common::make_error("Dump file already opened");
+  }
+
+  FILE* file = fopen(dconfig.path.c_str(), "rb");
+  if (!file) {
+    return common::make_error(common::MemSPrintf("Can't open dump file: %s, error: %s", dconfig.path, strerror(errno)));
+  }
+
+  unsigned char flags = 0;
+  common::Error err = ReadHeader(file, &flags);
+  if (err) {
+    fclose(file);
+    return err;
+  }
+
+  file_ = file;
+  flags_ = flags;
+  bytes_ = DUMP_HEADER_SIZE;
+  completed_ = false;
+  error_ = common::Error();
+  thread_ = std::thread(&DumpReader::Run, this, dconfig.from_block);
+  return common::Error();
+}
+
+bool DumpReader::Read(DumpBlock* block) {
+  return queue_.Pop(block);
+}
+
+common::Error DumpReader::Close() {
+  if (!file_) {
+    return common::make_error("Dump file not opened");
+  }
+
+  queue_.Close();  // reading thread is stopped on next block
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  fclose(file_);
+  file_ = nullptr;
+  return error_;
+}
+
+uint64_t DumpReader::GetReadBytes() const {
+  return bytes_;
+}
+
+bool DumpReader::IsCompleted() const {
+  return completed_;
+}
+
+void DumpReader::Run(uint64_t from_block) {
+  for (uint64_t index = 0;; ++index) {
+    DumpBlockHeader header;
+    std::string stored;
+    bool eof = false;
+    common::Error err = ReadBlock(file_, flags_, &header, &stored, &eof);
+    if (err) {
+      error_ = err;
+      break;
+    }
+
+    if (eof) {
+      error_ = common::make_error("Dump has no end block, export was interrupted and should be resumed");
+      break;
+    }
+
+    bytes_ += header.size;
+    if (header.flags & DUMP_BLOCK_END) {
+      completed_ = true;
+      break;
+    }
+
+    if (index < from_block) {
+      continue;
+    }
+
+    DumpBlock block;
+    block.cursor = header.cursor;
+    err = DecodeBlock(header, stored, &block);
+    if (err) {
+      error_ = err;
+      break;
+    }
+
+    if (!queue_.Push(&block)) {
+      break;  // consumer stopped
+    }
+  }
+
+  queue_.Close();
+}
+
+common::Error ParseDumpExportArgs(const commands_args_t& argv, DumpConfig* dconfig) {
+  if (!dconfig || argv.empty()) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  DumpConfig lconfig;
+  lconfig.path = common::file_system::prepare_path(argv[0]);
+  for (size_t i = 1; i < argv.size(); ++i) {
+    const std::string option = common::StringToUpperASCII(argv[i]);
+    if (option == "COMPRESS") {
+      lconfig.flags |= DUMP_FLAG_COMPRESSED;
+      continue;
+    } else if (option == "CHECKSUM") {
+      lconfig.flags |= DUMP_FLAG_CHECKSUM;
+      continue;
+    } else if (option == "RESUME") {
+      lconfig.resume = true;
+      continue;
+    }
+
+    if (i + 1 >= argv.size()) {
+      return common::make_error(common::MemSPrintf("Missing value for option: %s", argv[i]));
+    }
+
+    const command_buffer_t& value = argv[++i];
+    if (option == "MATCH") {
+      lconfig.pattern = value;
+    } else if (option == "COUNT") {
+      if (!common::ConvertFromString(value, &lconfig.count) || lconfig.count == 0) {
+        return common::make_error(common::MemSPrintf("Invalid value for option %s: %s", option, value));
+      }
+    } else {
+      return common::make_error(common::MemSPrintf("Unknown option: %s", argv[i - 1]));
+    }
+  }
+
+  *dconfig = lconfig;
+  return common::Error();
+}
+
+common::Error ParseDumpImportArgs(const commands_args_t& argv, DumpConfig* dconfig) {
+  if (!dconfig || argv.empty()) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  DumpConfig lconfig;
+  lconfig.path = common::file_system::prepare_path(argv[0]);
+  for (size_t i = 1; i < argv.size(); i += 2) {
+    if (i + 1 >= argv.size()) {
+      return common::make_error(common::MemSPrintf("Missing value for option: %s", argv[i]));
+    }
+
+    const std::string option = common::StringToUpperASCII(argv[i]);
+    const command_buffer_t& value = argv[i + 1];
+    if (option == "FROM") {
+      if (!common::ConvertFromString(value, &lconfig.from_block)) {
+        return common::make_error(common::MemSPrintf("Invalid value for option %s: %s", option, value));
+      }
+    } else {
+      return common::make_error(common::MemSPrintf("Unknown option: %s", argv[i]));
+    }
+  }
+
+  *dconfig = lconfig;
+  return common::Error();
+}
+
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+
+std::string ConvertToString(const fastonosql::core::DumpReport& report) {
+  return common::MemSPrintf("%s: %llu keys, %llu skipped, %llu blocks, %llu bytes, %.2f seconds",
+                            report.completed ? "completed" : "interrupted",
+                            static_cast<unsigned long long>(report.keys),
+                            static_cast<unsigned long long>(report.skipped),
+                            static_cast<unsigned long long>(report.blocks),
+                            static_cast<unsigned long long>(report.bytes), static_cast<double>(report.msec) / 1000);
+}
+
+}  // namespace common
@@ -0,0 +1,193 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <common/error.h>
+
+#include "core/db_key.h"  // for NDbKValue
+#include "core/types.h"   // for commands_args_t
+
+#define DUMP_FLAG_COMPRESSED 0x01  // blocks are zlib compressed when it saves space
+#define DUMP_FLAG_CHECKSUM 0x02    // blocks carry crc64 of stored data
+
+namespace fastonosql {
+namespace core {
+
+// engine independent logical dump of keys, written by EXPORT and loaded by IMPORT:
+// header: magic, version, flags
+// block: block flags, records, source cursor after block, raw size, stored size, [crc64], data
+// record: value type, key, expire time in unix msec or 0 without ttl, value
+// dump is complete only when it ends with end block
+struct DumpConfig {
+  enum { default_count = 1000, default_queue_size = 4 };
+  DumpConfig();
+
+  std::string path;
+  std::string pattern;  // export SCAN MATCH
+  uint64_t count;       // export keys per SCAN page, one block per page
+  unsigned char flags;  // export DUMP_FLAG_*
+  bool resume;          // export continues from last complete block of existing file
+  uint64_t from_block;  // import skips blocks applied before interruption
+};
+
+struct DumpReport {
+  DumpReport();
+
+  uint64_t keys;     // in complete blocks
+  uint64_t skipped;  // export keys deleted or expired after SCAN, import keys expired before load
+  uint64_t blocks;   // complete blocks, checkpoint for IMPORT FROM
+  uint64_t bytes;    // file bytes written or read
+  uint64_t msec;
+  bool completed;  // export reached end of keyspace, import reached end block
+};
+
+typedef std::function<void(const DumpReport& report)> dump_report_observer_t;
+
+struct DumpBlock {
+  DumpBlock();
+
+  uint64_t cursor;   // source SCAN cursor after block
+  uint64_t load_ms;  // export time records were loaded, ttl is counted from it
+  uint64_t expired;  // import records dropped while decoding
+  std::vector<NDbKValue> records;
+};
+
+// ttl is stored as expire time, relative to now_ms on both sides
+void EncodeDumpRecord(const NDbKValue& record, uint64_t now_ms, std::string* out);
+common::Error DecodeDumpRecords(const std::string& data,
+                                uint64_t count,
+                                uint64_t now_ms,
+                                std::vector<NDbKValue>* records,
+                                uint64_t* expired) WARN_UNUSED_RESULT;
+
+// bounded queue between dump file thread and connection thread, closed by any side to stop other one
+template <typename T>
+class DumpQueue {
+ public:
+  explicit DumpQueue(size_t limit) : limit_(limit), mutex_(), cond_(), items_(), closed_(false) {}
+
+  bool Push(T* item) {  // waits for space, false if closed
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return closed_ || items_.size() < limit_; });
+    if (closed_) {
+      return false;
+    }
+
+    items_.push_back(std::move(*item));
+    cond_.notify_all();
+    return true;
+  }
+
+  bool Pop(T* item) {  // waits for item, rest items are popped after close
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return false;
+    }
+
+    *item = std::move(items_.front());
+    items_.pop_front();
+    cond_.notify_all();
+    return true;
+  }
+
+  void Close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    closed_ = true;
+    cond_.notify_all();
+  }
+
+ private:
+  const size_t limit_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<T> items_;
+  bool closed_;
+};
+
+// encodes, compresses and writes blocks on own thread
+class DumpWriter {
+ public:
+  explicit DumpWriter(size_t queue_size = DumpConfig::default_queue_size);
+  ~DumpWriter();
+
+  // with resume keeps complete blocks of existing file, report and cursor are taken from them
+  common::Error Open(const DumpConfig& dconfig, DumpReport* report, uint64_t* cursor) WARN_UNUSED_RESULT;
+  bool Write(DumpBlock* block);                            // false after write error
+  common::Error Close(bool completed) WARN_UNUSED_RESULT;  // end block is written for completed dump
+  uint64_t GetWrittenBytes() const;
+
+ private:
+  void Run();
+  common::Error WriteRaw(const std::string& data) WARN_UNUSED_RESULT;
+
+  DumpQueue<DumpBlock> queue_;
+  FILE* file_;
+  unsigned char flags_;
+  std::atomic<uint64_t> bytes_;
+  common::Error error_;  // of writing thread, read after join
+  std::thread thread_;
+};
+
+// reads, verifies and decodes blocks on own thread
+class DumpReader {
+ public:
+  explicit DumpReader(size_t queue_size = DumpConfig::default_queue_size);
+  ~DumpReader();
+
+  common::Error Open(const DumpConfig& dconfig) WARN_UNUSED_RESULT;  // blocks before from_block are skipped
+  bool Read(DumpBlock* block);                                       // false at end of dump or on error
+  common::Error Close() WARN_UNUSED_RESULT;                          // also error for dump without end block
+  uint64_t GetReadBytes() const;
+  bool IsCompleted() const;  // end block reached, valid after Close
+
+ private:
+  void Run(uint64_t from_block);
+
+  DumpQueue<DumpBlock> queue_;
+  FILE* file_;
+  unsigned char flags_;
+  std::atomic<uint64_t> bytes_;
+  bool completed_;
+  common::Error error_;  // of reading thread, read after join
+  std::thread thread_;
+};
+
+// EXPORT <path> [MATCH <pattern>] [COUNT <n>] [COMPRESS] [CHECKSUM] [RESUME]
+common::Error ParseDumpExportArgs(const commands_args_t& argv, DumpConfig* dconfig) WARN_UNUSED_RESULT;
+// IMPORT <path> [FROM <block>]
+common::Error ParseDumpImportArgs(const commands_args_t& argv, DumpConfig* dconfig) WARN_UNUSED_RESULT;
+
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+std::string ConvertToString(const fastonosql::core::DumpReport& report);
+}  // namespace common
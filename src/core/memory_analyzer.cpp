@@ -0,0 +1,265 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/memory_analyzer.h"
+
+#include <algorithm>
+
+#include <common/convert2string.h>
+#include <common/sprintf.h>
+#include <common/string_util.h>
+
+namespace fastonosql {
+namespace core {
+
+namespace {
+
+uint64_t GetSortValue(MemoryAnalyzerConfig::SortBy sort_by, uint64_t bytes, uint64_t length) {
+  return sort_by == MemoryAnalyzerConfig::SORT_BY_LENGTH ? length : bytes;
+}
+
+}  // namespace
+
+MemoryAnalyzerConfig::MemoryAnalyzerConfig()
+    : pattern("*"),
+      count(default_count),
+      samples(default_samples),
+      top(default_top),
+      ops(0),
+      depth(default_depth),
+      ns_separator(":"),
+      sort_by(SORT_BY_MEMORY) {}
+
+MemoryKeyInfo::MemoryKeyInfo() : key(), type(), bytes(0), length(0) {}
+
+MemoryKeyInfo::MemoryKeyInfo(const std::string& key, const std::string& type, uint64_t bytes, uint64_t length)
+    : key(key), type(type), bytes(bytes), length(length) {}
+
+MemoryGroupInfo::MemoryGroupInfo() : name(), keys(0), bytes(0), length(0) {}
+
+MemoryReport::MemoryReport() : keys(0), bytes(0), msec(0), completed(false), top_keys(), prefixes(), types() {}
+
+const char MemoryAnalyzer::no_prefix[] = "(no prefix)";
+const char MemoryAnalyzer::other_prefix[] = "(other)";
+
+MemoryAnalyzer::MemoryAnalyzer(const MemoryAnalyzerConfig& aconfig)
+    : aconfig_(aconfig), keys_(0), bytes_(0), top_keys_(), prefixes_(), types_() {}
+
+void MemoryAnalyzer::Add(const MemoryKeyInfo& info) {
+  keys_++;
+  bytes_ += info.bytes;
+
+  std::string prefix = GetPrefix(info.key);
+  if (prefixes_.size() >= max_prefixes && prefixes_.find(prefix) == prefixes_.end()) {
+    prefix = other_prefix;
+  }
+  AddToGroup(&prefixes_, prefix, info);
+  AddToGroup(&types_, info.type, info);
+
+  if (aconfig_.top == 0) {
+    return;
+  }
+
+  auto greater = [this](const MemoryKeyInfo& lhs, const MemoryKeyInfo& rhs) {
+    return IsLess(rhs.bytes, rhs.length, lhs.bytes, lhs.length);
+  };
+  if (top_keys_.size() < aconfig_.top) {
+    top_keys_.push_back(info);
+    std::push_heap(top_keys_.begin(), top_keys_.end(), greater);
+    return;
+  }
+
+  const MemoryKeyInfo& smallest = top_keys_.front();
+  if (!IsLess(smallest.bytes, smallest.length, info.bytes, info.length)) {
+    return;
+  }
+
+  std::pop_heap(top_keys_.begin(), top_keys_.end(), greater);
+  top_keys_.back() = info;
+  std::push_heap(top_keys_.begin(), top_keys_.end(), greater);
+}
+
+std::string MemoryAnalyzer::GetPrefix(const std::string& key) const {
+  const std::string& separator = aconfig_.ns_separator;
+  if (separator.empty() || aconfig_.depth == 0) {
+    return no_prefix;
+  }
+
+  // up to depth-th separator, shorter keys are grouped by all their namespaces
+  size_t end = std::string::npos;
+  size_t pos = key.find(separator);
+  for (uint64_t level = 0; level < aconfig_.depth && pos != std::string::npos; ++level) {
+    end = pos;
+    pos = key.find(separator, pos + separator.size());
+  }
+
+  if (end == std::string::npos) {
+    return no_prefix;
+  }
+  return key.substr(0, end);
+}
+
+MemoryReport MemoryAnalyzer::GetReport() const {
+  MemoryReport report;
+  report.keys = keys_;
+  report.bytes = bytes_;
+  report.top_keys = top_keys_;
+  std::sort(report.top_keys.begin(), report.top_keys.end(), [this](const MemoryKeyInfo& lhs, const MemoryKeyInfo& rhs) {
+    return IsLess(rhs.bytes, rhs.length, lhs.bytes, lhs.length);
+  });
+  report.prefixes = SortGroups(prefixes_);
+  report.types = SortGroups(types_);
+  return report;
+}
+
+bool MemoryAnalyzer::IsLess(uint64_t lbytes, uint64_t llength, uint64_t rbytes, uint64_t rlength) const {
+  const uint64_t lvalue = GetSortValue(aconfig_.sort_by, lbytes, llength);
+  const uint64_t rvalue = GetSortValue(aconfig_.sort_by, rbytes, rlength);
+  if (lvalue != rvalue) {
+    return lvalue < rvalue;
+  }
+  // ties are broken by other metric
+  return GetSortValue(aconfig_.sort_by, llength, lbytes) < GetSortValue(aconfig_.sort_by, rlength, rbytes);
+}
+
+void MemoryAnalyzer::AddToGroup(std::unordered_map<std::string, MemoryGroupInfo>* groups,
+                                const std::string& name,
+                                const MemoryKeyInfo& info) {
+  MemoryGroupInfo& group = (*groups)[name];
+  group.name = name;
+  group.keys++;
+  group.bytes += info.bytes;
+  group.length += info.length;
+}
+
+std::vector<MemoryGroupInfo> MemoryAnalyzer::SortGroups(
+    const std::unordered_map<std::string, MemoryGroupInfo>& groups) const {
+  std::vector<MemoryGroupInfo> result;
+  result.reserve(groups.size());
+  for (auto it = groups.begin(); it != groups.end(); ++it) {
+    result.push_back(it->second);
+  }
+  std::sort(result.begin(), result.end(), [this](const MemoryGroupInfo& lhs, const MemoryGroupInfo& rhs) {
+    if (IsLess(rhs.bytes, rhs.length, lhs.bytes, lhs.length)) {
+      return true;
+    }
+    if (IsLess(lhs.bytes, lhs.length, rhs.bytes, rhs.length)) {
+      return false;
+    }
+    return lhs.name < rhs.name;
+  });
+  return result;
+}
+
+common::Error ParseMemoryAnalyzerArgs(const commands_args_t& argv, MemoryAnalyzerConfig* aconfig) {
+  if (!aconfig) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  MemoryAnalyzerConfig lconfig;
+  for (size_t i = 0; i < argv.size(); i += 2) {
+    if (i + 1 >= argv.size()) {
+      return common::make_error(common::MemSPrintf("Missing value for option: %s", argv[i]));
+    }
+
+    const std::string option = common::StringToUpperASCII(argv[i]);
+    const command_buffer_t& value = argv[i + 1];
+    if (option == "MATCH") {
+      lconfig.pattern = value;
+      continue;
+    } else if (option == "SEPARATOR") {
+      lconfig.ns_separator = value;
+      continue;
+    } else if (option == "BY") {
+      const std::string by = common::StringToUpperASCII(value);
+      if (by == "MEMORY") {
+        lconfig.sort_by = MemoryAnalyzerConfig::SORT_BY_MEMORY;
+      } else if (by == "LENGTH") {
+        lconfig.sort_by = MemoryAnalyzerConfig::SORT_BY_LENGTH;
+      } else {
+        return common::make_error(common::MemSPrintf("BY should be MEMORY or LENGTH: %s", value));
+      }
+      continue;
+    }
+
+    uint64_t number;
+    if (!common::ConvertFromString(value, &number)) {
+      return common::make_error(common::MemSPrintf("Invalid value for option %s: %s", option, value));
+    }
+
+    if (option == "COUNT") {
+      lconfig.count = number;
+    } else if (option == "SAMPLES") {
+      lconfig.samples = number;
+    } else if (option == "TOP") {
+      lconfig.top = number;
+    } else if (option == "OPS") {
+      lconfig.ops = number;
+    } else if (option == "DEPTH") {
+      lconfig.depth = number;
+    } else {
+      return common::make_error(common::MemSPrintf("Unknown option: %s", argv[i]));
+    }
+  }
+
+  if (lconfig.count == 0) {
+    return common::make_error("COUNT should be positive");
+  }
+
+  *aconfig = lconfig;
+  return common::Error();
+}
+
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+
+std::string ConvertToString(const fastonosql::core::MemoryReport& report) {
+  std::string result = MemSPrintf("%llu keys, %llu bytes, scanned in %.2f seconds%s\n",
+                                  static_cast<unsigned long long>(report.keys),
+                                  static_cast<unsigned long long>(report.bytes),
+                                  static_cast<double>(report.msec) / 1000, report.completed ? "" : " (partial)");
+
+  result += "\ntop keys (bytes, length, type, key):\n";
+  for (size_t i = 0; i < report.top_keys.size(); ++i) {
+    const fastonosql::core::MemoryKeyInfo& info = report.top_keys[i];
+    result += MemSPrintf("%llu\t%llu\t%s\t%s\n", static_cast<unsigned long long>(info.bytes),
+                         static_cast<unsigned long long>(info.length), info.type, info.key);
+  }
+
+  result += "\nprefixes (bytes, keys, length, prefix):\n";
+  for (size_t i = 0; i < report.prefixes.size(); ++i) {
+    const fastonosql::core::MemoryGroupInfo& group = report.prefixes[i];
+    result += MemSPrintf("%llu\t%llu\t%llu\t%s\n", static_cast<unsigned long long>(group.bytes),
+                         static_cast<unsigned long long>(group.keys), static_cast<unsigned long long>(group.length),
+                         group.name);
+  }
+
+  result += "\ntypes (bytes, keys, length, type):\n";
+  for (size_t i = 0; i < report.types.size(); ++i) {
+    const fastonosql::core::MemoryGroupInfo& group = report.types[i];
+    result += MemSPrintf("%llu\t%llu\t%llu\t%s\n", static_cast<unsigned long long>(group.bytes),
+                         static_cast<unsigned long long>(group.keys), static_cast<unsigned long long>(group.length),
+                         group.name);
+  }
+  return result;
+}
+
+}  // namespace common
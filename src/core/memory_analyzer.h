@@ -0,0 +1,117 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <common/error.h>
+
+#include "core/types.h"  // for commands_args_t
+
+namespace fastonosql {
+namespace core {
+
+// redis-cli --memkeys like keyspace report: biggest keys and totals per namespace prefix and type
+struct MemoryAnalyzerConfig {
+  enum SortBy { SORT_BY_MEMORY, SORT_BY_LENGTH };
+  enum { default_count = 1000, default_samples = 5, default_top = 50, default_depth = 1 };
+  MemoryAnalyzerConfig();
+
+  std::string pattern;       // SCAN MATCH
+  uint64_t count;            // keys per SCAN page, one pipeline per page
+  uint64_t samples;          // redis MEMORY USAGE SAMPLES, 0 means all nested values
+  uint64_t top;              // keys in report
+  uint64_t ops;              // commands per second limit, 0 means unlimited
+  uint64_t depth;            // namespace levels of prefix
+  std::string ns_separator;  // namespace separator of keys
+  SortBy sort_by;
+};
+
+struct MemoryKeyInfo {
+  MemoryKeyInfo();
+  MemoryKeyInfo(const std::string& key, const std::string& type, uint64_t bytes, uint64_t length);
+
+  std::string key;
+  std::string type;
+  uint64_t bytes;
+  uint64_t length;  // elements of collection, bytes of string
+};
+
+struct MemoryGroupInfo {
+  MemoryGroupInfo();
+
+  std::string name;  // prefix or type
+  uint64_t keys;
+  uint64_t bytes;
+  uint64_t length;
+};
+
+struct MemoryReport {
+  MemoryReport();
+
+  uint64_t keys;
+  uint64_t bytes;
+  uint64_t msec;
+  bool completed;                         // whole keyspace scanned
+  std::vector<MemoryKeyInfo> top_keys;    // sorted by config sort_by, descending
+  std::vector<MemoryGroupInfo> prefixes;  // sorted by config sort_by, descending
+  std::vector<MemoryGroupInfo> types;     // sorted by config sort_by, descending
+};
+
+typedef std::function<void(const MemoryReport& report)> memory_report_observer_t;
+
+// aggregates scanned keys, top keys are kept in a bounded heap
+class MemoryAnalyzer {
+ public:
+  enum { max_prefixes = 100000 };  // prefixes over it are summed into other_prefix
+  static const char no_prefix[];
+  static const char other_prefix[];
+
+  explicit MemoryAnalyzer(const MemoryAnalyzerConfig& aconfig);
+
+  void Add(const MemoryKeyInfo& info);
+  std::string GetPrefix(const std::string& key) const;
+  MemoryReport GetReport() const;  // msec and completed are not set
+
+ private:
+  bool IsLess(uint64_t lbytes, uint64_t llength, uint64_t rbytes, uint64_t rlength) const;
+  void AddToGroup(std::unordered_map<std::string, MemoryGroupInfo>* groups, const std::string& name,
+                  const MemoryKeyInfo& info);
+  std::vector<MemoryGroupInfo> SortGroups(const std::unordered_map<std::string, MemoryGroupInfo>& groups) const;
+
+  const MemoryAnalyzerConfig aconfig_;
+  uint64_t keys_;
+  uint64_t bytes_;
+  std::vector<MemoryKeyInfo> top_keys_;  // min heap by sort_by
+  std::unordered_map<std::string, MemoryGroupInfo> prefixes_;
+  std::unordered_map<std::string, MemoryGroupInfo> types_;
+};
+
+// [MATCH <pattern>] [COUNT <n>] [SAMPLES <n>] [TOP <n>] [OPS <n>] [DEPTH <n>] [SEPARATOR <str>] [BY MEMORY|LENGTH]
+common::Error ParseMemoryAnalyzerArgs(const commands_args_t& argv, MemoryAnalyzerConfig* aconfig) WARN_UNUSED_RESULT;
+
+}  // namespace core
+}  // namespace fastonosql
+
+namespace common {
+std::string ConvertToString(const fastonosql::core::MemoryReport& report);  // human readable report
+}  // namespace common
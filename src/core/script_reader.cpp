@@ -0,0 +1,139 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/script_reader.h"
+
+#include <common/macros.h>
+#include <common/sprintf.h>
+
+namespace fastonosql {
+namespace core {
+
+ScriptReader::ScriptReader(const command_buffer_t* text)
+    : text_(text), path_(), file_(), total_bytes_(text ? text->size() : 0), read_bytes_(0) {
+  DCHECK(text);
+}
+
+ScriptReader::ScriptReader(const std::string& path, uint64_t total_bytes)
+    : text_(nullptr),
+      path_(path),
+      file_(path.c_str(), std::ios::in | std::ios::binary),
+      total_bytes_(total_bytes),
+      read_bytes_(0) {}
+
+common::Error ScriptReader::OpenFile(const std::string& path, ScriptReader** reader) {
+  if (path.empty() || !reader) {
+    return common::make_error_inval();
+  }
+
+  std::ifstream probe(path.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+  if (!probe.is_open()) {
+    return common::make_error(common::MemSPrintf("Can't open script file: %s", path));
+  }
+
+  const std::streamoff size = probe.tellg();
+  ScriptReader* lreader = new ScriptReader(path, size > 0 ? static_cast<uint64_t>(size) : 0);
+  if (!lreader->file_.is_open()) {
+    delete lreader;
+    return common::make_error(common::MemSPrintf("Can't open script file: %s", path));
+  }
+
+  *reader = lreader;
+  return common::Error();
+}
+
+bool ScriptReader::ReadCommand(command_buffer_t* command) {
+  command_buffer_t line;
+  while (ReadLine(&line)) {
+    // blank lines are skipped here, StableCommand expects at least one token
+    if (line.find_first_not_of(" \t\r") == command_buffer_t::npos) {
+      continue;
+    }
+
+    command_buffer_t stable = StableCommand(line);
+    if (stable.empty()) {
+      continue;
+    }
+
+    *command = stable;
+    return true;
+  }
+
+  return false;
+}
+
+common::Error ScriptReader::Rewind() {
+  read_bytes_ = 0;
+  if (text_) {
+    return common::Error();
+  }
+
+  file_.clear();
+  file_.seekg(0, std::ios::beg);
+  if (!file_) {
+    return common::make_error(common::MemSPrintf("Can't rewind script file: %s", path_));
+  }
+
+  return common::Error();
+}
+
+common::Error ScriptReader::GetReadError() const {
+  if (!text_ && file_.bad()) {
+    return common::make_error(common::MemSPrintf("Read script file error: %s", path_));
+  }
+
+  return common::Error();
+}
+
+uint64_t ScriptReader::GetReadBytes() const {
+  return read_bytes_;
+}
+
+uint64_t ScriptReader::GetTotalBytes() const {
+  return total_bytes_;
+}
+
+bool ScriptReader::ReadLine(command_buffer_t* line) {
+  if (text_) {
+    if (read_bytes_ >= text_->size()) {
+      return false;
+    }
+
+    const size_t start = static_cast<size_t>(read_bytes_);
+    size_t end = text_->find('\n', start);
+    if (end == command_buffer_t::npos) {
+      end = text_->size();
+    }
+    line->assign(*text_, start, end - start);
+    read_bytes_ = end < text_->size() ? end + 1 : end;
+    return true;
+  }
+
+  if (!std::getline(file_, *line)) {
+    return false;
+  }
+
+  read_bytes_ += line->size();
+  if (!file_.eof()) {  // newline consumed by getline
+    read_bytes_++;
+  }
+  return true;
+}
+
+}  // namespace core
+}  // namespace fastonosql
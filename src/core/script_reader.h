@@ -0,0 +1,63 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <fstream>
+#include <string>
+
+#include <common/error.h>
+
+#include "core/types.h"
+
+namespace fastonosql {
+namespace core {
+
+// commands of a script taken one line at a time, so a script of any size
+// is executed without being split into a vector of commands first
+class ScriptReader {
+ public:
+  // text must outlive the reader
+  explicit ScriptReader(const command_buffer_t* text);
+  static common::Error OpenFile(const std::string& path, ScriptReader** reader) WARN_UNUSED_RESULT;
+
+  // next non empty command passed through StableCommand, false at the end of the script
+  bool ReadCommand(command_buffer_t* command);
+  common::Error Rewind() WARN_UNUSED_RESULT;
+  // file read failures, end of script is not an error
+  common::Error GetReadError() const;
+
+  uint64_t GetReadBytes() const;
+  uint64_t GetTotalBytes() const;
+
+ private:
+  ScriptReader(const std::string& path, uint64_t total_bytes);
+
+  bool ReadLine(command_buffer_t* line);
+
+  const command_buffer_t* text_;
+  const std::string path_;
+  std::ifstream file_;
+  const uint64_t total_bytes_;
+  uint64_t read_bytes_;
+};
+
+}  // namespace core
+}  // namespace fastonosql
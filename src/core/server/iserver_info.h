@@ -18,7 +18,9 @@
 
 #pragma once
 
-#include <memory>  // for shared_ptr
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <vector>      // for vector
 
 #include <common/net/types.h>  // for HostAndPortAndSlot
 #include <common/types.h>      // for time64_t
@@ -72,6 +74,7 @@ class ServerDiscoverySentinelInfo : public ServerDiscoveryInfoBase {
 };
 
 typedef std::shared_ptr<ServerDiscoverySentinelInfo> ServerDiscoverySentinelInfoSPtr;
+typedef std::function<void(const std::vector<ServerDiscoverySentinelInfoSPtr>& infos)> discovery_sentinel_observer_t;
 
 class ServerDiscoveryClusterInfo : public ServerDiscoveryInfoBase {
  public:
@@ -86,6 +89,7 @@ class ServerDiscoveryClusterInfo : public ServerDiscoveryInfoBase {
 };
 
 typedef std::shared_ptr<ServerDiscoveryClusterInfo> ServerDiscoveryClusterInfoSPtr;
+typedef std::function<void(const std::vector<ServerDiscoveryClusterInfoSPtr>& infos)> discovery_cluster_observer_t;
 
 struct IStateField {
   virtual common::Value* GetValueByIndex(unsigned char index) const = 0;
@@ -45,6 +45,9 @@
 #ifdef BUILD_WITH_FORESTDB
 #include "gui/db/forestdb/connection_widget.h"
 #endif
+#ifdef BUILD_WITH_RDB
+#include "gui/db/rdb/connection_widget.h"
+#endif
 
 namespace fastonosql {
 namespace gui {
@@ -94,6 +97,11 @@ ConnectionBaseWidget* createWidgetImpl(core::connectionTypes type, QWidget* pare
   if (type == core::FORESTDB) {
     return new forestdb::ConnectionWidget(parent);
   }
+#endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    return new rdb::ConnectionWidget(parent);
+  }
 #endif
   NOTREACHED();
   return nullptr;
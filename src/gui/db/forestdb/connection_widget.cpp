@@ -18,14 +18,23 @@
 
 #include "gui/db/forestdb/connection_widget.h"
 
+#include <QCheckBox>
 #include <QHBoxLayout>
 #include <QLabel>
 #include <QLineEdit>
+#include <QSpinBox>
 
 #include <common/qt/convert2string.h>
 
 #include "proxy/db/forestdb/connection_settings.h"
 
+namespace {
+const QString trCommitMaxPending = QObject::tr("Commit every N mutations (0 - disabled):");
+const QString trCommitInterval = QObject::tr("Commit interval (msec, 0 - disabled):");
+const QString trCompactionStale = QObject::tr("Compact when stale data exceeds (%, 0 - disabled):");
+const QString trManualWalFlush = QObject::tr("Bulk load (flush WAL only on COMMIT)");
+}  // namespace
+
 namespace fastonosql {
 namespace gui {
 namespace forestdb {
@@ -38,6 +47,33 @@ ConnectionWidget::ConnectionWidget(QWidget* parent)
   db_name_edit_ = new QLineEdit;
   name_layout->addWidget(db_name_edit_);
   addLayout(name_layout);
+
+  QHBoxLayout* commit_max_pending_layout = new QHBoxLayout;
+  commit_max_pending_label_ = new QLabel;
+  commit_max_pending_layout->addWidget(commit_max_pending_label_);
+  commit_max_pending_edit_ = new QSpinBox;
+  commit_max_pending_edit_->setRange(0, INT32_MAX);
+  commit_max_pending_layout->addWidget(commit_max_pending_edit_);
+  addLayout(commit_max_pending_layout);
+
+  QHBoxLayout* commit_interval_layout = new QHBoxLayout;
+  commit_interval_label_ = new QLabel;
+  commit_interval_layout->addWidget(commit_interval_label_);
+  commit_interval_edit_ = new QSpinBox;
+  commit_interval_edit_->setRange(0, INT32_MAX);
+  commit_interval_layout->addWidget(commit_interval_edit_);
+  addLayout(commit_interval_layout);
+
+  QHBoxLayout* compaction_stale_layout = new QHBoxLayout;
+  compaction_stale_label_ = new QLabel;
+  compaction_stale_layout->addWidget(compaction_stale_label_);
+  compaction_stale_edit_ = new QSpinBox;
+  compaction_stale_edit_->setRange(0, 100);
+  compaction_stale_layout->addWidget(compaction_stale_edit_);
+  addLayout(compaction_stale_layout);
+
+  manual_wal_flush_ = new QCheckBox;
+  addWidget(manual_wal_flush_);
 }
 
 void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection) {
@@ -48,12 +84,20 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
     if (common::ConvertFromString(config.db_name, &qdb_name)) {
       db_name_edit_->setText(qdb_name);
     }
+    commit_max_pending_edit_->setValue(config.commit_max_pending);
+    commit_interval_edit_->setValue(config.commit_interval_msec);
+    compaction_stale_edit_->setValue(config.compaction_stale_percent);
+    manual_wal_flush_->setChecked(config.manual_wal_flush);
   }
   ConnectionLocalWidget::syncControls(forestdb);
 }
 
 void ConnectionWidget::retranslateUi() {
   db_name_label_->setText(trDBName);
+  commit_max_pending_label_->setText(trCommitMaxPending);
+  commit_interval_label_->setText(trCommitInterval);
+  compaction_stale_label_->setText(trCompactionStale);
+  manual_wal_flush_->setText(trManualWalFlush);
   ConnectionLocalWidget::retranslateUi();
 }
 
@@ -62,6 +106,10 @@ proxy::IConnectionSettingsLocal* ConnectionWidget::createConnectionLocalImpl(
   proxy::forestdb::ConnectionSettings* conn = new proxy::forestdb::ConnectionSettings(path);
   core::forestdb::Config config = conn->GetInfo();
   config.db_name = common::ConvertToString(db_name_edit_->text());
+  config.commit_max_pending = commit_max_pending_edit_->value();
+  config.commit_interval_msec = commit_interval_edit_->value();
+  config.compaction_stale_percent = compaction_stale_edit_->value();
+  config.manual_wal_flush = manual_wal_flush_->isChecked();
   conn->SetInfo(config);
   return conn;
 }
@@ -20,6 +20,8 @@
 
 #include "gui/widgets/connection_local_widget.h"
 
+class QSpinBox;
+
 namespace fastonosql {
 namespace gui {
 namespace forestdb {
@@ -38,6 +40,17 @@ class ConnectionWidget : public ConnectionLocalWidgetFilePath {
 
   QLabel* db_name_label_;
   QLineEdit* db_name_edit_;
+
+  QLabel* commit_max_pending_label_;
+  QSpinBox* commit_max_pending_edit_;
+
+  QLabel* commit_interval_label_;
+  QSpinBox* commit_interval_edit_;
+
+  QLabel* compaction_stale_label_;
+  QSpinBox* compaction_stale_edit_;
+
+  QCheckBox* manual_wal_flush_;
 };
 
 }  // namespace forestdb
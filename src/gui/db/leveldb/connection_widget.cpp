@@ -44,6 +44,18 @@ ConnectionWidget::ConnectionWidget(QWidget* parent) : ConnectionLocalWidgetDirec
   type_comp_layout->addWidget(compLabel_);
   type_comp_layout->addWidget(typeComparators_);
   addLayout(type_comp_layout);
+
+  QHBoxLayout* profile_layout = new QHBoxLayout;
+  tuning_profiles_ = new QComboBox;
+  for (uint32_t i = 0; i < core::leveldb::g_tuning_profiles.size(); ++i) {
+    const char* prof = core::leveldb::g_tuning_profiles[i];
+    tuning_profiles_->addItem(prof, i);
+  }
+
+  profile_label_ = new QLabel;
+  profile_layout->addWidget(profile_label_);
+  profile_layout->addWidget(tuning_profiles_);
+  addLayout(profile_layout);
 }
 
 void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection) {
@@ -52,6 +64,7 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
     core::leveldb::Config config = lev->GetInfo();
     create_db_if_missing_->setChecked(config.create_if_missing);
     typeComparators_->setCurrentIndex(config.comparator);
+    tuning_profiles_->setCurrentIndex(config.profile);
   }
   ConnectionLocalWidget::syncControls(lev);
 }
@@ -59,6 +72,7 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
 void ConnectionWidget::retranslateUi() {
   create_db_if_missing_->setText(trCreateDBIfMissing);
   compLabel_->setText(trComparator + ":");
+  profile_label_->setText(trTuningProfile + ":");
   ConnectionLocalWidget::retranslateUi();
 }
 
@@ -68,6 +82,7 @@ proxy::IConnectionSettingsLocal* ConnectionWidget::createConnectionLocalImpl(
   core::leveldb::Config config = conn->GetInfo();
   config.create_if_missing = create_db_if_missing_->isChecked();
   config.comparator = static_cast<core::leveldb::ComparatorType>(typeComparators_->currentIndex());
+  config.ApplyProfile(static_cast<core::leveldb::TuningProfile>(tuning_profiles_->currentIndex()));
   conn->SetInfo(config);
   return conn;
 }
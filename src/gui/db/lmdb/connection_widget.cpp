@@ -35,6 +35,11 @@
 
 namespace {
 const QString trMaxDBSCount = QObject::tr("Max database count:");
+const QString trMapSize = QObject::tr("Map size (MB, 0 - default):");
+const QString trMapGrowth = QObject::tr("Map growth when full (%, 0 - disabled):");
+const QString trWriteBatchSize = QObject::tr("Keys per write transaction:");
+const QString trNoTLS = QObject::tr("No thread local readers (MDB_NOTLS)");
+const QString trNoReadAhead = QObject::tr("No read ahead (MDB_NORDAHEAD)");
 }
 
 namespace fastonosql {
@@ -79,8 +84,38 @@ ConnectionWidget::ConnectionWidget(QWidget* parent) : base_class(parent) {
   max_dbs_layout->addWidget(max_dbs_count_edit_);
   addLayout(max_dbs_layout);
 
+  QHBoxLayout* map_size_layout = new QHBoxLayout;
+  map_size_label_ = new QLabel;
+  map_size_layout->addWidget(map_size_label_);
+  map_size_edit_ = new QSpinBox;
+  map_size_edit_->setRange(0, INT32_MAX);
+  map_size_layout->addWidget(map_size_edit_);
+  addLayout(map_size_layout);
+
+  QHBoxLayout* map_growth_layout = new QHBoxLayout;
+  map_growth_label_ = new QLabel;
+  map_growth_layout->addWidget(map_growth_label_);
+  map_growth_edit_ = new QSpinBox;
+  map_growth_edit_->setRange(0, 1000);
+  map_growth_layout->addWidget(map_growth_edit_);
+  addLayout(map_growth_layout);
+
+  QHBoxLayout* write_batch_size_layout = new QHBoxLayout;
+  write_batch_size_label_ = new QLabel;
+  write_batch_size_layout->addWidget(write_batch_size_label_);
+  write_batch_size_edit_ = new QSpinBox;
+  write_batch_size_edit_->setRange(1, INT32_MAX);
+  write_batch_size_layout->addWidget(write_batch_size_edit_);
+  addLayout(write_batch_size_layout);
+
   read_only_db_ = new QCheckBox;
   addWidget(read_only_db_);
+
+  no_tls_ = new QCheckBox;
+  addWidget(no_tls_);
+
+  no_read_ahead_ = new QCheckBox;
+  addWidget(no_read_ahead_);
 }
 
 void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection) {
@@ -104,6 +139,11 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
       db_name_edit_->setText(qdb_name);
     }
     max_dbs_count_edit_->setValue(config.max_dbs);
+    map_size_edit_->setValue(config.map_size_mb);
+    map_growth_edit_->setValue(config.map_growth_percent);
+    write_batch_size_edit_->setValue(config.write_batch_size);
+    no_tls_->setChecked(config.IsNoTLS());
+    no_read_ahead_->setChecked(config.IsNoReadAhead());
   }
   base_class::syncControls(lmdb);
 }
@@ -115,6 +155,11 @@ void ConnectionWidget::retranslateUi() {
   read_only_db_->setText(trReadOnlyDB);
   db_name_label_->setText(trDBName);
   max_dbs_count_label_->setText(trMaxDBSCount);
+  map_size_label_->setText(trMapSize);
+  map_growth_label_->setText(trMapGrowth);
+  write_batch_size_label_->setText(trWriteBatchSize);
+  no_tls_->setText(trNoTLS);
+  no_read_ahead_->setText(trNoReadAhead);
   base_class::retranslateUi();
 }
 
@@ -156,6 +201,11 @@ proxy::IConnectionSettingsBase* ConnectionWidget::createConnectionImpl(const pro
   config.db_name = common::ConvertToString(db_name_edit_->text());
   config.SetSingleFileDB(is_file_path);
   config.max_dbs = max_dbs_count_edit_->value();
+  config.map_size_mb = map_size_edit_->value();
+  config.map_growth_percent = map_growth_edit_->value();
+  config.write_batch_size = write_batch_size_edit_->value();
+  config.SetNoTLS(no_tls_->isChecked());
+  config.SetNoReadAhead(no_read_ahead_->isChecked());
   conn->SetInfo(config);
   return conn;
 }
@@ -58,6 +58,18 @@ class ConnectionWidget : public ConnectionBaseWidget {
 
   QLabel* max_dbs_count_label_;
   QSpinBox* max_dbs_count_edit_;
+
+  QLabel* map_size_label_;
+  QSpinBox* map_size_edit_;
+
+  QLabel* map_growth_label_;
+  QSpinBox* map_growth_edit_;
+
+  QLabel* write_batch_size_label_;
+  QSpinBox* write_batch_size_edit_;
+
+  QCheckBox* no_tls_;
+  QCheckBox* no_read_ahead_;
 };
 
 }  // namespace lmdb
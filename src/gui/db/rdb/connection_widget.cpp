@@ -0,0 +1,75 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/db/rdb/connection_widget.h"
+
+#include <algorithm>
+
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QSpinBox>
+
+#include "proxy/db/rdb/connection_settings.h"
+
+namespace {
+const QString trRdbFilter = QObject::tr("RDB files (*.rdb);;All files (*.*)");
+const QString trRdbCaption = QObject::tr("Select RDB dump file");
+const QString trIndexLimit = QObject::tr("Max keys in GET index (rest found by file walk):");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+namespace rdb {
+
+ConnectionWidget::ConnectionWidget(QWidget* parent)
+    : ConnectionLocalWidgetFilePath(trDBPath, trRdbFilter, trRdbCaption, parent) {
+  QHBoxLayout* index_limit_layout = new QHBoxLayout;
+  index_limit_label_ = new QLabel;
+  index_limit_layout->addWidget(index_limit_label_);
+  index_limit_edit_ = new QSpinBox;
+  index_limit_edit_->setRange(0, INT32_MAX);
+  index_limit_layout->addWidget(index_limit_edit_);
+  addLayout(index_limit_layout);
+}
+
+void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection) {
+  proxy::rdb::ConnectionSettings* rdb = static_cast<proxy::rdb::ConnectionSettings*>(connection);
+  if (rdb) {
+    core::rdb::Config config = rdb->GetInfo();
+    index_limit_edit_->setValue(static_cast<int>(std::min<uint64_t>(config.index_limit, INT32_MAX)));
+  }
+  ConnectionLocalWidget::syncControls(rdb);
+}
+
+void ConnectionWidget::retranslateUi() {
+  index_limit_label_->setText(trIndexLimit);
+  ConnectionLocalWidget::retranslateUi();
+}
+
+proxy::IConnectionSettingsLocal* ConnectionWidget::createConnectionLocalImpl(
+    const proxy::connection_path_t& path) const {
+  proxy::rdb::ConnectionSettings* conn = new proxy::rdb::ConnectionSettings(path);
+  core::rdb::Config config = conn->GetInfo();
+  config.index_limit = index_limit_edit_->value();
+  conn->SetInfo(config);
+  return conn;
+}
+
+}  // namespace rdb
+}  // namespace gui
+}  // namespace fastonosql
@@ -27,6 +27,12 @@
 
 #include "proxy/connection_settings/iconnection_settings_local.h"
 
+namespace {
+const QString trEnableTransactions = QObject::tr("Enable transactions (UPS_ENABLE_TRANSACTIONS)");
+const QString trEnableDuplicates = QObject::tr("Duplicate keys in created databases (UPS_ENABLE_DUPLICATE_KEYS)");
+const QString trWriteBatchSize = QObject::tr("Keys per write transaction:");
+}
+
 namespace fastonosql {
 namespace gui {
 namespace upscaledb {
@@ -44,6 +50,19 @@ ConnectionWidget::ConnectionWidget(QWidget* parent)
   def_layout->addWidget(default_db_label_);
   def_layout->addWidget(default_db_num_);
   addLayout(def_layout);
+
+  enable_transactions_ = new QCheckBox;
+  addWidget(enable_transactions_);
+  enable_duplicates_ = new QCheckBox;
+  addWidget(enable_duplicates_);
+
+  QHBoxLayout* write_batch_size_layout = new QHBoxLayout;
+  write_batch_size_label_ = new QLabel;
+  write_batch_size_layout->addWidget(write_batch_size_label_);
+  write_batch_size_edit_ = new QSpinBox;
+  write_batch_size_edit_->setRange(1, INT32_MAX);
+  write_batch_size_layout->addWidget(write_batch_size_edit_);
+  addLayout(write_batch_size_layout);
 }
 
 void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection) {
@@ -52,6 +71,9 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
     core::upscaledb::Config config = ups->GetInfo();
     create_db_if_missing_->setChecked(config.create_if_missing);
     default_db_num_->setValue(config.dbnum);
+    enable_transactions_->setChecked(config.enable_transactions);
+    enable_duplicates_->setChecked(config.enable_duplicates);
+    write_batch_size_edit_->setValue(config.write_batch_size);
   }
   ConnectionLocalWidget::syncControls(ups);
 }
@@ -59,6 +81,9 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
 void ConnectionWidget::retranslateUi() {
   create_db_if_missing_->setText(trCreateDBIfMissing);
   default_db_label_->setText(trDefaultDb);
+  enable_transactions_->setText(trEnableTransactions);
+  enable_duplicates_->setText(trEnableDuplicates);
+  write_batch_size_label_->setText(trWriteBatchSize);
   ConnectionLocalWidget::retranslateUi();
 }
 
@@ -68,6 +93,9 @@ proxy::IConnectionSettingsLocal* ConnectionWidget::createConnectionLocalImpl(
   core::upscaledb::Config config = conn->GetInfo();
   config.create_if_missing = create_db_if_missing_->isChecked();
   config.dbnum = default_db_num_->value();
+  config.enable_transactions = enable_transactions_->isChecked();
+  config.enable_duplicates = enable_duplicates_->isChecked();
+  config.write_batch_size = write_batch_size_edit_->value();
   conn->SetInfo(config);
   return conn;
 }
@@ -40,6 +40,11 @@ class ConnectionWidget : public ConnectionLocalWidgetFilePath {
 
   QLabel* default_db_label_;
   QSpinBox* default_db_num_;
+
+  QCheckBox* enable_transactions_;
+  QCheckBox* enable_duplicates_;
+  QLabel* write_batch_size_label_;
+  QSpinBox* write_batch_size_edit_;
 };
 
 }  // namespace upscaledb
@@ -165,6 +165,10 @@ AboutDialog::AboutDialog(QWidget* parent) : QDialog(parent) {
   typedef core::ConnectionTraits<core::FORESTDB> forestdb_traits_t;
   addDBItem(dblist_widget, forestdb_traits_t::GetDBName(), forestdb_traits_t::GetBasedOn(),
             forestdb_traits_t::GetVersionApi());
+#endif
+#ifdef BUILD_WITH_RDB
+  typedef core::ConnectionTraits<core::RDB> rdb_traits_t;
+  addDBItem(dblist_widget, rdb_traits_t::GetDBName(), rdb_traits_t::GetBasedOn(), rdb_traits_t::GetVersionApi());
 #endif
   main_tab->addTab(dblist_widget, QObject::tr("Availible databases"));
 
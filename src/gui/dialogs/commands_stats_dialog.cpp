@@ -0,0 +1,185 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/commands_stats_dialog.h"
+
+#include <QDialogButtonBox>
+#include <QDir>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+#include <common/qt/convert2string.h>    // for ConvertFromString
+#include <common/qt/gui/glass_widget.h>  // for GlassWidget
+
+#include "proxy/events/events_info.h"
+#include "proxy/server/iserver.h"  // for IServer
+
+#include "gui/gui_factory.h"  // for GuiFactory
+#include "gui/utils.h"        // for ShowSaveFileDialog
+
+#include "translations/global.h"  // for trLoading, trExport
+
+namespace {
+const QString trCommandsStatsTemplate_1S = QObject::tr("%1 commands statistics");
+const QString trRefresh = QObject::tr("Refresh");
+const QString trReset = QObject::tr("Reset");
+const QString trFilterForJson = QObject::tr("Json files (*.json)");
+const QString trSummaryTemplate_4S = QObject::tr("Sent: %1 bytes, received: %2 bytes, network p99: %3 usec, "
+                                                 "reply parse p99: %4 usec");
+const QStringList kColumns = {QObject::tr("Command"), QObject::tr("Count"),  QObject::tr("Errors"),
+                              QObject::tr("Min"),     QObject::tr("p50"),    QObject::tr("p99"),
+                              QObject::tr("p99.9"),   QObject::tr("Max"),    QObject::tr("Mean (usec)")};
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+CommandsStatsDialog::CommandsStatsDialog(proxy::IServerSPtr server, QWidget* parent)
+    : QDialog(parent), server_(server) {
+  CHECK(server_);
+
+  setWindowIcon(GuiFactory::GetInstance().GetIcon(server->GetType()));
+  setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);  // Remove help
+                                                                     // button (?)
+
+  commands_table_ = new QTableWidget(0, kColumns.size());
+  commands_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  commands_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  commands_table_->setSortingEnabled(true);
+  commands_table_->verticalHeader()->hide();
+  commands_table_->horizontalHeader()->setStretchLastSection(true);
+
+  summary_ = new QLabel;
+  summary_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+  QDialogButtonBox* buttons = new QDialogButtonBox(QDialogButtonBox::Close);
+  refresh_button_ = buttons->addButton(trRefresh, QDialogButtonBox::ActionRole);
+  reset_button_ = buttons->addButton(trReset, QDialogButtonBox::ResetRole);
+  export_button_ = buttons->addButton(translations::trExport, QDialogButtonBox::ActionRole);
+  VERIFY(connect(refresh_button_, &QPushButton::clicked, this, &CommandsStatsDialog::refresh));
+  VERIFY(connect(reset_button_, &QPushButton::clicked, this, &CommandsStatsDialog::reset));
+  VERIFY(connect(export_button_, &QPushButton::clicked, this, &CommandsStatsDialog::exportStats));
+  VERIFY(connect(buttons, &QDialogButtonBox::rejected, this, &CommandsStatsDialog::reject));
+
+  QVBoxLayout* mainL = new QVBoxLayout;
+  mainL->addWidget(commands_table_);
+  mainL->addWidget(summary_);
+  mainL->addWidget(buttons);
+
+  setMinimumSize(QSize(min_width, min_height));
+  setLayout(mainL);
+
+  glassWidget_ = new common::qt::gui::GlassWidget(GuiFactory::GetInstance().GetPathToLoadingGif(),
+                                                  translations::trLoading, 0.5, QColor(111, 111, 100), this);
+
+  VERIFY(connect(server.get(), &proxy::IServer::LoadCommandsStatsStarted, this,
+                 &CommandsStatsDialog::startLoadCommandsStats));
+  VERIFY(connect(server.get(), &proxy::IServer::LoadCommandsStatsFinished, this,
+                 &CommandsStatsDialog::finishLoadCommandsStats));
+  retranslateUi();
+}
+
+void CommandsStatsDialog::startLoadCommandsStats(const proxy::events_info::CommandsStatsInfoRequest& req) {
+  UNUSED(req);
+
+  glassWidget_->start();
+}
+
+void CommandsStatsDialog::finishLoadCommandsStats(const proxy::events_info::CommandsStatsInfoResponce& res) {
+  glassWidget_->stop();
+  common::Error err = res.errorInfo();
+  if (err) {
+    return;
+  }
+
+  const core::CommandsStatsSnapShoot stats = res.stats;
+  commands_table_->setSortingEnabled(false);
+  commands_table_->setRowCount(static_cast<int>(stats.commands.size()));
+  for (size_t i = 0; i < stats.commands.size(); ++i) {
+    const core::CommandStatsInfo& command = stats.commands[i];
+    const core::LatencyInfo& lat = command.latency;
+    QString name;
+    common::ConvertFromString(command.name, &name);
+    int row = static_cast<int>(i);
+    commands_table_->setItem(row, 0, new QTableWidgetItem(name));
+    const double values[] = {static_cast<double>(lat.count), static_cast<double>(command.errors),
+                             static_cast<double>(lat.min),   static_cast<double>(lat.p50),
+                             static_cast<double>(lat.p99),   static_cast<double>(lat.p999),
+                             static_cast<double>(lat.max),   lat.mean};
+    for (size_t j = 0; j < sizeof(values) / sizeof(values[0]); ++j) {
+      QTableWidgetItem* item = new QTableWidgetItem;
+      item->setData(Qt::DisplayRole, values[j]);  // numeric sort
+      commands_table_->setItem(row, static_cast<int>(j + 1), item);
+    }
+  }
+  commands_table_->setSortingEnabled(true);
+
+  summary_->setText(trSummaryTemplate_4S.arg(stats.bytes_sent)
+                        .arg(stats.bytes_received)
+                        .arg(stats.network.p99)
+                        .arg(stats.reply_parse.p99));
+}
+
+void CommandsStatsDialog::refresh() {
+  proxy::events_info::CommandsStatsInfoRequest req(this);
+  server_->LoadCommandsStats(req);
+}
+
+void CommandsStatsDialog::reset() {
+  proxy::events_info::CommandsStatsInfoRequest req(this, true);
+  server_->LoadCommandsStats(req);
+}
+
+void CommandsStatsDialog::exportStats() {
+  QString filepath = ShowSaveFileDialog(this, translations::trSaveAs, QDir::homePath(), trFilterForJson);
+  if (filepath.isEmpty()) {
+    return;
+  }
+
+  proxy::events_info::CommandsStatsInfoRequest req(this, false, common::ConvertToString(filepath));
+  server_->LoadCommandsStats(req);
+}
+
+void CommandsStatsDialog::changeEvent(QEvent* e) {
+  if (e->type() == QEvent::LanguageChange) {
+    retranslateUi();
+  }
+  QDialog::changeEvent(e);
+}
+
+void CommandsStatsDialog::showEvent(QShowEvent* e) {
+  QDialog::showEvent(e);
+  refresh();
+}
+
+void CommandsStatsDialog::retranslateUi() {
+  commands_table_->setHorizontalHeaderLabels(kColumns);
+  refresh_button_->setText(trRefresh);
+  reset_button_->setText(trReset);
+  export_button_->setText(translations::trExport);
+  QString name;
+  if (common::ConvertFromString(server_->GetName(), &name)) {
+    setWindowTitle(trCommandsStatsTemplate_1S.arg(name));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
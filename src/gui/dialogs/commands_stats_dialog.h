@@ -0,0 +1,81 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QDialog>
+
+#include "proxy/proxy_fwd.h"  // for IServerSPtr
+
+class QEvent;
+class QLabel;
+class QPushButton;
+class QShowEvent;
+class QTableWidget;
+class QWidget;
+
+namespace common {
+namespace qt {
+namespace gui {
+class GlassWidget;
+}
+}  // namespace qt
+}  // namespace common
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct CommandsStatsInfoRequest;
+struct CommandsStatsInfoResponce;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+
+// client side latency per command and connection counters collected by driver
+class CommandsStatsDialog : public QDialog {
+  Q_OBJECT
+ public:
+  explicit CommandsStatsDialog(proxy::IServerSPtr server, QWidget* parent = Q_NULLPTR);
+  enum { min_width = 640, min_height = 320 };
+
+ private Q_SLOTS:
+  void startLoadCommandsStats(const proxy::events_info::CommandsStatsInfoRequest& req);
+  void finishLoadCommandsStats(const proxy::events_info::CommandsStatsInfoResponce& res);
+
+  void refresh();
+  void reset();
+  void exportStats();
+
+ protected:
+  virtual void changeEvent(QEvent* e) override;
+  virtual void showEvent(QShowEvent* e) override;
+
+ private:
+  void retranslateUi();
+
+  common::qt::gui::GlassWidget* glassWidget_;
+  QTableWidget* commands_table_;
+  QLabel* summary_;
+  QPushButton* refresh_button_;
+  QPushButton* reset_button_;
+  QPushButton* export_button_;
+  const proxy::IServerSPtr server_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
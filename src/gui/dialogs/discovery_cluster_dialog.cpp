@@ -112,31 +112,38 @@ std::vector<ConnectionListWidgetItemDiscovered*> DiscoveryClusterDiagnosticDialo
 
 void DiscoveryClusterDiagnosticDialog::connectionResult(bool suc,
                                                         qint64 mstimeExecute,
-                                                        const QString& resultText,
-                                                        std::vector<core::ServerDiscoveryClusterInfoSPtr> infos) {
+                                                        const QString& resultText) {
   glassWidget_->stop();
 
   executeTimeLabel_->setText(translations::trTimeTemplate_1S.arg(mstimeExecute));
-  listWidget_->setEnabled(suc);
-  listWidget_->clear();
+  listWidget_->setEnabled(listWidget_->topLevelItemCount() != 0);
   if (suc) {
     QIcon icon = GuiFactory::GetInstance().GetSuccessIcon();
     const QPixmap pm = icon.pixmap(stateIconSize);
     iconLabel_->setPixmap(pm);
+  }
+  statusLabel_->setText(translations::trConnectionStatusTemplate_1S.arg(resultText));
+}
 
-    for (size_t i = 0; i < infos.size(); ++i) {
-      core::ServerDiscoveryClusterInfoSPtr inf = infos[i];
-      common::net::HostAndPortAndSlot host = inf->GetHost();
-      proxy::connection_path_t path(common::file_system::get_separator_string<char>() + inf->GetName());
-      proxy::IConnectionSettingsBaseSPtr con(
-          proxy::ConnectionSettingsFactory::GetInstance().CreateFromType(inf->GetConnectionType(), path, host));
-      ConnectionListWidgetItemDiscovered* item = new ConnectionListWidgetItemDiscovered(inf->GetInfo(), nullptr);
-      item->setConnection(con);
-      item->setDisabled(inf->Self() || cluster_->FindSettingsByHost(host));
-      listWidget_->addTopLevelItem(item);
+void DiscoveryClusterDiagnosticDialog::discovered(std::vector<core::ServerDiscoveryClusterInfoSPtr> infos) {
+  glassWidget_->stop();
+  listWidget_->setEnabled(true);
+  for (size_t i = 0; i < infos.size(); ++i) {
+    core::ServerDiscoveryClusterInfoSPtr inf = infos[i];
+    common::net::HostAndPortAndSlot host = inf->GetHost();
+    if (isDiscovered(host)) {
+      continue;
     }
+
+    discovered_hosts_.push_back(host);
+    proxy::connection_path_t path(common::file_system::get_separator_string<char>() + inf->GetName());
+    proxy::IConnectionSettingsBaseSPtr con(
+        proxy::ConnectionSettingsFactory::GetInstance().CreateFromType(inf->GetConnectionType(), path, host));
+    ConnectionListWidgetItemDiscovered* item = new ConnectionListWidgetItemDiscovered(inf->GetInfo(), nullptr);
+    item->setConnection(con);
+    item->setDisabled(inf->Self() || cluster_->FindSettingsByHost(host));
+    listWidget_->addTopLevelItem(item);
   }
-  statusLabel_->setText(translations::trConnectionStatusTemplate_1S.arg(resultText));
 }
 
 void DiscoveryClusterDiagnosticDialog::showEvent(QShowEvent* e) {
@@ -145,17 +152,38 @@ void DiscoveryClusterDiagnosticDialog::showEvent(QShowEvent* e) {
 }
 
 void DiscoveryClusterDiagnosticDialog::testConnection(proxy::IConnectionSettingsBaseSPtr connection) {
+  // selected node is asked first, other known nodes answer in parallel if it is down
+  std::vector<proxy::IConnectionSettingsBaseSPtr> nodes = {connection};
+  if (cluster_) {
+    proxy::IClusterSettingsBase::cluster_nodes_t cluster_nodes = cluster_->GetNodes();
+    for (size_t i = 0; i < cluster_nodes.size(); ++i) {
+      if (cluster_nodes[i] != connection) {
+        nodes.push_back(cluster_nodes[i]);
+      }
+    }
+  }
+
   QThread* th = new QThread;
-  DiscoveryConnection* cheker = new DiscoveryConnection(connection);
+  DiscoveryConnection* cheker = new DiscoveryConnection(nodes);
   cheker->moveToThread(th);
   VERIFY(connect(th, &QThread::started, cheker, &DiscoveryConnection::routine));
   VERIFY(connect(cheker, &DiscoveryConnection::connectionResult, this,
                  &DiscoveryClusterDiagnosticDialog::connectionResult));
+  VERIFY(connect(cheker, &DiscoveryConnection::discovered, this, &DiscoveryClusterDiagnosticDialog::discovered));
   VERIFY(connect(cheker, &DiscoveryConnection::connectionResult, th, &QThread::quit));
   VERIFY(connect(th, &QThread::finished, cheker, &DiscoveryConnection::deleteLater));
   VERIFY(connect(th, &QThread::finished, th, &QThread::deleteLater));
   th->start();
 }
 
+bool DiscoveryClusterDiagnosticDialog::isDiscovered(const common::net::HostAndPort& host) const {
+  for (size_t i = 0; i < discovered_hosts_.size(); ++i) {
+    if (discovered_hosts_[i] == host) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace gui
 }  // namespace fastonosql
@@ -53,16 +53,15 @@ class DiscoveryClusterDiagnosticDialog : public QDialog {
   std::vector<fastonosql::gui::ConnectionListWidgetItemDiscovered*> selectedConnections() const;
 
  private Q_SLOTS:
-  void connectionResult(bool suc,
-                        qint64 mstimeExecute,
-                        const QString& resultText,
-                        std::vector<core::ServerDiscoveryClusterInfoSPtr> infos);
+  void connectionResult(bool suc, qint64 mstimeExecute, const QString& resultText);
+  void discovered(std::vector<core::ServerDiscoveryClusterInfoSPtr> infos);
 
  protected:
   virtual void showEvent(QShowEvent* e) override;
 
  private:
   void testConnection(proxy::IConnectionSettingsBaseSPtr connection);
+  bool isDiscovered(const common::net::HostAndPort& host) const;
 
   common::qt::gui::GlassWidget* glassWidget_;
   QLabel* executeTimeLabel_;
@@ -70,6 +69,7 @@ class DiscoveryClusterDiagnosticDialog : public QDialog {
   QTreeWidget* listWidget_;
   QLabel* iconLabel_;
   proxy::IClusterSettingsBaseSPtr cluster_;
+  std::vector<common::net::HostAndPort> discovered_hosts_;  // every seed node reports whole cluster
 };
 
 }  // namespace gui
@@ -28,27 +28,27 @@
 namespace fastonosql {
 namespace gui {
 
-DiscoveryConnection::DiscoveryConnection(proxy::IConnectionSettingsBaseSPtr conn, QObject* parent)
-    : QObject(parent), connection_(conn), start_time_(common::time::current_mstime()) {
+DiscoveryConnection::DiscoveryConnection(const std::vector<proxy::IConnectionSettingsBaseSPtr>& nodes,
+                                         QObject* parent)
+    : QObject(parent), nodes_(nodes), start_time_(common::time::current_mstime()) {
   qRegisterMetaType<std::vector<core::ServerDiscoveryClusterInfoSPtr>>(
       "std::vector<core::ServerDiscoveryClusterInfoSPtr>");
 }
 
 void DiscoveryConnection::routine() {
-  std::vector<core::ServerDiscoveryClusterInfoSPtr> inf;
-
-  if (!connection_) {
-    emit connectionResult(false, common::time::current_mstime() - start_time_, "Invalid connection settings", inf);
+  if (nodes_.empty()) {
+    emit connectionResult(false, common::time::current_mstime() - start_time_, "Invalid connection settings");
     return;
   }
 
-  common::Error err = proxy::ServersManager::GetInstance().DiscoveryClusterConnection(connection_, &inf);
+  auto observer = [this](const std::vector<core::ServerDiscoveryClusterInfoSPtr>& infos) { emit discovered(infos); };
+  common::Error err = proxy::ServersManager::GetInstance().DiscoveryClusterConnection(nodes_, observer);
   if (err) {
     QString qdesc;
     common::ConvertFromString(err->GetDescription(), &qdesc);
-    emit connectionResult(false, common::time::current_mstime() - start_time_, qdesc, inf);
+    emit connectionResult(false, common::time::current_mstime() - start_time_, qdesc);
   } else {
-    emit connectionResult(true, common::time::current_mstime() - start_time_, translations::trSuccess, inf);
+    emit connectionResult(true, common::time::current_mstime() - start_time_, translations::trSuccess);
   }
 }
 
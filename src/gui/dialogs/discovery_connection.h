@@ -31,19 +31,19 @@ namespace gui {
 class DiscoveryConnection : public QObject {
   Q_OBJECT
  public:
-  explicit DiscoveryConnection(proxy::IConnectionSettingsBaseSPtr conn, QObject* parent = Q_NULLPTR);
+  explicit DiscoveryConnection(const std::vector<proxy::IConnectionSettingsBaseSPtr>& nodes,
+                               QObject* parent = Q_NULLPTR);
 
  Q_SIGNALS:
-  void connectionResult(bool suc,
-                        qint64 msTimeExecute,
-                        const QString& resultText,
-                        std::vector<core::ServerDiscoveryClusterInfoSPtr> infos);
+  void connectionResult(bool suc, qint64 msTimeExecute, const QString& resultText);
+  // emitted from routine thread as servers arrive
+  void discovered(std::vector<core::ServerDiscoveryClusterInfoSPtr> infos);
 
  public Q_SLOTS:
   void routine();
 
  private:
-  proxy::IConnectionSettingsBaseSPtr connection_;
+  const std::vector<proxy::IConnectionSettingsBaseSPtr> nodes_;
   common::time64_t start_time_;
 };
 
@@ -35,20 +35,19 @@ DiscoverySentinelConnection::DiscoverySentinelConnection(proxy::IConnectionSetti
 }
 
 void DiscoverySentinelConnection::routine() {
-  std::vector<core::ServerDiscoverySentinelInfoSPtr> inf;
-
   if (!connection_) {
-    emit connectionResult(false, common::time::current_mstime() - startTime_, "Invalid connection settings", inf);
+    emit connectionResult(false, common::time::current_mstime() - startTime_, "Invalid connection settings");
     return;
   }
 
-  common::Error err = proxy::ServersManager::GetInstance().DiscoverySentinelConnection(connection_, &inf);
+  auto observer = [this](const std::vector<core::ServerDiscoverySentinelInfoSPtr>& infos) { emit discovered(infos); };
+  common::Error err = proxy::ServersManager::GetInstance().DiscoverySentinelConnection(connection_, observer);
   if (err) {
     QString qdesc;
     common::ConvertFromString(err->GetDescription(), &qdesc);
-    emit connectionResult(false, common::time::current_mstime() - startTime_, qdesc, inf);
+    emit connectionResult(false, common::time::current_mstime() - startTime_, qdesc);
   } else {
-    emit connectionResult(true, common::time::current_mstime() - startTime_, translations::trSuccess, inf);
+    emit connectionResult(true, common::time::current_mstime() - startTime_, translations::trSuccess);
   }
 }
 
@@ -32,10 +32,9 @@ class DiscoverySentinelConnection : public QObject {
   explicit DiscoverySentinelConnection(proxy::IConnectionSettingsBaseSPtr conn, QObject* parent = Q_NULLPTR);
 
  Q_SIGNALS:
-  void connectionResult(bool suc,
-                        qint64 msTimeExecute,
-                        const QString& resultText,
-                        std::vector<core::ServerDiscoverySentinelInfoSPtr> infos);
+  void connectionResult(bool suc, qint64 msTimeExecute, const QString& resultText);
+  // emitted from routine thread as servers arrive
+  void discovered(std::vector<core::ServerDiscoverySentinelInfoSPtr> infos);
 
  public Q_SLOTS:
   void routine();
@@ -109,36 +109,38 @@ std::vector<ConnectionListWidgetItemDiscovered*> DiscoverySentinelDiagnosticDial
   return res;
 }
 
-void DiscoverySentinelDiagnosticDialog::connectionResultReady(
-    bool suc,
-    qint64 mstimeExecute,
-    const QString& resultText,
-    std::vector<core::ServerDiscoverySentinelInfoSPtr> infos) {
+void DiscoverySentinelDiagnosticDialog::connectionResultReady(bool suc,
+                                                              qint64 mstimeExecute,
+                                                              const QString& resultText) {
   glassWidget_->stop();
 
   executeTimeLabel_->setText(translations::trTimeTemplate_1S.arg(mstimeExecute));
-  listWidget_->setEnabled(suc);
-  listWidget_->clear();
+  listWidget_->setEnabled(listWidget_->topLevelItemCount() != 0);
   if (suc) {
     QIcon icon = GuiFactory::GetInstance().GetSuccessIcon();
     QPixmap pm = icon.pixmap(stateIconSize);
     iconLabel_->setPixmap(pm);
-
-    for (size_t i = 0; i < infos.size(); ++i) {
-      core::ServerDiscoverySentinelInfoSPtr inf = infos[i];
-      common::net::HostAndPort host = inf->GetHost();
-      proxy::connection_path_t path(common::file_system::get_separator_string<char>() + inf->GetName());
-      proxy::IConnectionSettingsBaseSPtr con(
-          proxy::ConnectionSettingsFactory::GetInstance().CreateFromType(inf->GetConnectionType(), path, host));
-
-      ConnectionListWidgetItemDiscovered* item = new ConnectionListWidgetItemDiscovered(inf->GetInfo(), nullptr);
-      item->setConnection(con);
-      listWidget_->addTopLevelItem(item);
-    }
   }
   statusLabel_->setText(translations::trConnectionStatusTemplate_1S.arg(resultText));
 }
 
+void DiscoverySentinelDiagnosticDialog::discoveredReady(std::vector<core::ServerDiscoverySentinelInfoSPtr> infos) {
+  // masters come first, slaves are appended while discovery is still running
+  glassWidget_->stop();
+  listWidget_->setEnabled(true);
+  for (size_t i = 0; i < infos.size(); ++i) {
+    core::ServerDiscoverySentinelInfoSPtr inf = infos[i];
+    common::net::HostAndPort host = inf->GetHost();
+    proxy::connection_path_t path(common::file_system::get_separator_string<char>() + inf->GetName());
+    proxy::IConnectionSettingsBaseSPtr con(
+        proxy::ConnectionSettingsFactory::GetInstance().CreateFromType(inf->GetConnectionType(), path, host));
+
+    ConnectionListWidgetItemDiscovered* item = new ConnectionListWidgetItemDiscovered(inf->GetInfo(), nullptr);
+    item->setConnection(con);
+    listWidget_->addTopLevelItem(item);
+  }
+}
+
 void DiscoverySentinelDiagnosticDialog::showEvent(QShowEvent* e) {
   QDialog::showEvent(e);
   glassWidget_->start();
@@ -151,6 +153,8 @@ void DiscoverySentinelDiagnosticDialog::testConnection(proxy::IConnectionSetting
   VERIFY(connect(th, &QThread::started, cheker, &DiscoverySentinelConnection::routine));
   VERIFY(connect(cheker, &DiscoverySentinelConnection::connectionResult, this,
                  &DiscoverySentinelDiagnosticDialog::connectionResultReady));
+  VERIFY(connect(cheker, &DiscoverySentinelConnection::discovered, this,
+                 &DiscoverySentinelDiagnosticDialog::discoveredReady));
   VERIFY(connect(cheker, &DiscoverySentinelConnection::connectionResult, th, &QThread::quit));
   VERIFY(connect(th, &QThread::finished, cheker, &DiscoverySentinelConnection::deleteLater));
   VERIFY(connect(th, &QThread::finished, th, &QThread::deleteLater));
@@ -49,10 +49,8 @@ class DiscoverySentinelDiagnosticDialog : public QDialog {
   std::vector<ConnectionListWidgetItemDiscovered*> selectedConnections() const;
 
  private Q_SLOTS:
-  void connectionResultReady(bool suc,
-                             qint64 mstimeExecute,
-                             const QString& resultText,
-                             std::vector<core::ServerDiscoverySentinelInfoSPtr> infos);
+  void connectionResultReady(bool suc, qint64 mstimeExecute, const QString& resultText);
+  void discoveredReady(std::vector<core::ServerDiscoverySentinelInfoSPtr> infos);
 
  protected:
   virtual void showEvent(QShowEvent* e) override;
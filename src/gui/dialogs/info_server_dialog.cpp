@@ -58,6 +58,9 @@
 #ifdef BUILD_WITH_FORESTDB
 #include "core/db/forestdb/server_info.h"
 #endif
+#ifdef BUILD_WITH_RDB
+#include "core/db/rdb/server_info.h"
+#endif
 
 #include "core/connection_types.h"     // for connectionTypes, etc
 #include "proxy/events/events_info.h"  // for ServerInfoResponce, etc
@@ -223,6 +226,17 @@ const QString trForestdbTextServerTemplate = QObject::tr(
     "<b>Stats:</b><br/>"
     "DB path: %1<br/>"
     "DB size: %2 bytes<br/>");
+
+const QString trRdbTextServerTemplate = QObject::tr(
+    "<b>Stats:</b><br/>"
+    "DB path: %1<br/>"
+    "DB size: %2 bytes<br/>"
+    "RDB version: %3<br/>"
+    "Redis version: %4<br/>"
+    "Created: %5<br/>"
+    "Databases: %6<br/>"
+    "Keys: %7<br/>"
+    "Expires: %8<br/>");
 }  // namespace
 
 namespace fastonosql {
@@ -292,6 +306,11 @@ InfoServerDialog::InfoServerDialog(proxy::IServerSPtr server, QWidget* parent) :
     updateText(core::forestdb::ServerInfo());
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    updateText(core::rdb::ServerInfo());
+  }
+#endif
 
   VERIFY(connect(server.get(), &proxy::IServer::LoadServerInfoStarted, this, &InfoServerDialog::startServerInfo));
   VERIFY(connect(server.get(), &proxy::IServer::LoadServerInfoFinished, this, &InfoServerDialog::finishServerInfo));
@@ -381,6 +400,13 @@ void InfoServerDialog::finishServerInfo(const proxy::events_info::ServerInfoResp
     updateText(*infr);
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    core::rdb::ServerInfo* infr = static_cast<core::rdb::ServerInfo*>(inf.get());
+    CHECK(infr);
+    updateText(*infr);
+  }
+#endif
 }
 
 void InfoServerDialog::showEvent(QShowEvent* e) {
@@ -645,6 +671,27 @@ void InfoServerDialog::updateText(const core::forestdb::ServerInfo& serv) {
   serverTextInfo_->setText(textServ);
 }
 #endif
+#ifdef BUILD_WITH_RDB
+void InfoServerDialog::updateText(const core::rdb::ServerInfo& serv) {
+  core::rdb::ServerInfo::Stats stats = serv.stats_;
+  QString qdb_path;
+  common::ConvertFromString(stats.db_path, &qdb_path);
+  QString qredis_version;
+  common::ConvertFromString(stats.redis_version, &qredis_version);
+  QString qrdb_ctime;
+  common::ConvertFromString(stats.rdb_ctime, &qrdb_ctime);
+
+  QString textServ = trRdbTextServerTemplate.arg(qdb_path)
+                         .arg(stats.db_size)
+                         .arg(stats.rdb_version)
+                         .arg(qredis_version)
+                         .arg(qrdb_ctime)
+                         .arg(stats.databases)
+                         .arg(stats.keys)
+                         .arg(stats.expires);
+  serverTextInfo_->setText(textServ);
+}
+#endif
 
 }  // namespace gui
 }  // namespace fastonosql
@@ -61,6 +61,9 @@ class ServerInfo;
 namespace forestdb {
 class ServerInfo;
 }
+namespace rdb {
+class ServerInfo;
+}
 }  // namespace core
 }  // namespace fastonosql
 
@@ -115,6 +118,9 @@ class InfoServerDialog : public QDialog {
 #endif
 #ifdef BUILD_WITH_FORESTDB
   void updateText(const core::forestdb::ServerInfo& serv);
+#endif
+#ifdef BUILD_WITH_RDB
+  void updateText(const core::rdb::ServerInfo& serv);
 #endif
   QTextEdit* serverTextInfo_;
   common::qt::gui::GlassWidget* glassWidget_;
@@ -487,6 +487,24 @@ ExplorerSentinelItem* ExplorerTreeModel::findSentinelItem(proxy::ISentinelSPtr s
   return nullptr;
 }
 
+std::vector<proxy::IServerSPtr> ExplorerTreeModel::servers() const {
+  std::vector<proxy::IServerSPtr> result;
+  std::vector<common::qt::gui::TreeItem*> parents = {root_};
+  while (!parents.empty()) {
+    common::qt::gui::TreeItem* parent = parents.back();
+    parents.pop_back();
+    for (size_t i = 0; i < parent->childrenCount(); ++i) {
+      IExplorerTreeItem* item = static_cast<IExplorerTreeItem*>(parent->child(i));
+      if (item->type() == IExplorerTreeItem::eServer) {
+        result.push_back(static_cast<ExplorerServerItem*>(item)->server());
+      } else if (item->type() == IExplorerTreeItem::eCluster || item->type() == IExplorerTreeItem::eSentinel) {
+        parents.push_back(item);
+      }
+    }
+  }
+  return result;
+}
+
 ExplorerServerItem* ExplorerTreeModel::findServerItem(proxy::IServer* server) const {
   return static_cast<ExplorerServerItem*>(
       common::qt::gui::findItemRecursive(root_, [server](common::qt::gui::TreeItem* item) -> bool {
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <common/qt/gui/base/tree_model.h>  // for TreeModel
 
 #include "proxy/database/idatabase.h"
@@ -79,6 +81,8 @@ class ExplorerTreeModel : public common::qt::gui::TreeModel {
   void updateValue(proxy::IServer* server, core::IDataBaseInfoSPtr db, const core::NDbKValue& dbv);
   void removeAllKeys(proxy::IServer* server, core::IDataBaseInfoSPtr db);
 
+  std::vector<proxy::IServerSPtr> servers() const;  // standalone, cluster and sentinel members
+
  private:
   ExplorerClusterItem* findClusterItem(proxy::IClusterSPtr cl);
   ExplorerSentinelItem* findSentinelItem(proxy::ISentinelSPtr sentinel);
@@ -34,6 +34,11 @@
 #include "proxy/server/iserver_remote.h"  // for IServer, IServerRemote
 #include "proxy/settings_manager.h"       // for SettingsManager
 
+#ifdef BUILD_WITH_REDIS
+#include "proxy/db/redis/server.h"  // for Server
+#endif
+
+#include "gui/dialogs/commands_stats_dialog.h"  // for CommandsStatsDialog
 #include "gui/dialogs/dbkey_dialog.h"           // for DbKeyDialog
 #include "gui/dialogs/history_server_dialog.h"  // for ServerHistoryDialog
 #include "gui/dialogs/info_server_dialog.h"     // for InfoServerDialog
@@ -57,7 +62,11 @@ const QString trViewKeyTemplate_1S = QObject::tr("View keys in %1 database");
 const QString trViewChannelsTemplate_1S = QObject::tr("View channels in %1 server");
 const QString trConnectDisconnect = QObject::tr("Connect/Disconnect");
 const QString trClearDb = QObject::tr("Clear database");
+const QString trCommandsStats = QObject::tr("Commands statistics");
 const QString trRealyRemoveAllKeysTemplate_1S = QObject::tr("Really remove all keys from %1 database?");
+const QString trDestinationServer = QObject::tr("Destination server:");
+const QString trNoCopyKeysDestination = QObject::tr("Connect to another Redis server to copy keys to it.");
+const QString trReplaceExistingKeys = QObject::tr("Replace keys which already exist on destination server?");
 const QString trLoadContentTemplate_1S = QObject::tr("Load %1 content");
 const QString trSetMaxConnectionOnServerTemplate_1S = QObject::tr("Set max connection on %1 server");
 const QString trSetTTLOnKeyTemplate_1S = QObject::tr("Set ttl for %1 key");
@@ -251,6 +260,27 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
     infoServerAction->setEnabled(is_connected);
     menu.addAction(infoServerAction);
 
+    QAction* commandsStatsAction = new QAction(trCommandsStats, this);
+    VERIFY(connect(commandsStatsAction, &QAction::triggered, this, &ExplorerTreeView::openCommandsStatsDialog));
+    commandsStatsAction->setEnabled(is_connected);
+    menu.addAction(commandsStatsAction);
+
+    if (server->IsLiveModeSupported()) {
+      QAction* liveModeAction = new QAction(translations::trLiveUpdates, this);
+      liveModeAction->setCheckable(true);
+      liveModeAction->setChecked(server->IsLiveMode());
+      VERIFY(connect(liveModeAction, &QAction::toggled, this, &ExplorerTreeView::toggleLiveMode));
+      liveModeAction->setEnabled(is_connected);
+      menu.addAction(liveModeAction);
+    }
+
+    if (is_redis || server->GetType() == core::RDB) {
+      QAction* memoryAnalysisAction = new QAction(translations::trMemoryAnalysis, this);
+      VERIFY(connect(memoryAnalysisAction, &QAction::triggered, this, &ExplorerTreeView::analyzeMemory));
+      memoryAnalysisAction->setEnabled(is_connected);
+      menu.addAction(memoryAnalysisAction);
+    }
+
     if (is_redis) {
       QAction* propertyServerAction = new QAction(translations::trProperty, this);
       VERIFY(connect(propertyServerAction, &QAction::triggered, this, &ExplorerTreeView::openPropertyServerDialog));
@@ -264,6 +294,11 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
       pubSubAction->setEnabled(is_connected);
       menu.addAction(pubSubAction);
 
+      QAction* copyKeysAction = new QAction(translations::trCopyKeysTo, this);
+      VERIFY(connect(copyKeysAction, &QAction::triggered, this, &ExplorerTreeView::copyKeys));
+      copyKeysAction->setEnabled(is_connected);
+      menu.addAction(copyKeysAction);
+
       bool is_local = true;
       bool is_can_remote = server->IsCanRemote();
       if (is_can_remote) {
@@ -513,6 +548,25 @@ void ExplorerTreeView::openPropertyServerDialog() {
   }
 }
 
+void ExplorerTreeView::openCommandsStatsDialog() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    if (!server) {
+      continue;
+    }
+
+    CommandsStatsDialog statsDialog(server, this);
+    statsDialog.exec();
+  }
+}
+
 void ExplorerTreeView::openHistoryServerDialog() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -621,6 +675,87 @@ void ExplorerTreeView::viewPubSub() {
   }
 }
 
+void ExplorerTreeView::analyzeMemory() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    // runs on worker connection, progress and report are shown in console output
+    proxy::IServerSPtr server = node->server();
+    const std::string command = "MEMKEYS SEPARATOR " + server->GetNsSeparator();
+    QString qcommand;
+    if (common::ConvertFromString(command, &qcommand)) {
+      emit consoleOpenedAndExecute(server, qcommand);
+    }
+  }
+}
+
+void ExplorerTreeView::copyKeys() {
+#ifdef BUILD_WITH_REDIS
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    std::vector<proxy::IServerSPtr> servers = source_model_->servers();
+    std::vector<proxy::redis::Server*> destinations;
+    QStringList names;
+    for (size_t i = 0; i < servers.size(); ++i) {
+      proxy::IServerSPtr destination = servers[i];
+      QString name;
+      if (destination != server && destination->GetType() == core::REDIS && destination->IsConnected() &&
+          common::ConvertFromString(destination->GetName(), &name)) {
+        destinations.push_back(static_cast<proxy::redis::Server*>(destination.get()));
+        names << name;
+      }
+    }
+
+    if (destinations.empty()) {
+      QMessageBox::information(this, translations::trCopyKeysTo, trNoCopyKeysDestination);
+      return;
+    }
+
+    bool ok = false;
+    const QString name =
+        QInputDialog::getItem(this, translations::trCopyKeysTo, trDestinationServer, names, 0, false, &ok);
+    if (!ok) {
+      continue;
+    }
+
+    core::redis::CopyKeysConfig cconfig;
+    cconfig.replace = QMessageBox::question(this, translations::trCopyKeysTo, trReplaceExistingKeys, QMessageBox::Yes,
+                                            QMessageBox::No) == QMessageBox::Yes;
+
+    // destination config goes to driver as is, so auth stays out of console and history,
+    // report is written to log when copy finishes
+    proxy::events_info::CopyKeysInfoRequest req(this, destinations[names.indexOf(name)]->GetConfig(), cconfig);
+    server->CopyKeys(req);
+  }
+#endif
+}
+
+void ExplorerTreeView::toggleLiveMode(bool live) {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    server->SetLiveMode(live);
+  }
+}
+
 void ExplorerTreeView::importServer() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -66,6 +66,7 @@ class ExplorerTreeView : public QTreeView {
   void createDb();
   void openInfoServerDialog();
   void openPropertyServerDialog();
+  void openCommandsStatsDialog();
   void openHistoryServerDialog();
   void clearHistory();
   void closeServerConnection();
@@ -84,6 +85,9 @@ class ExplorerTreeView : public QTreeView {
   void editKey();
   void viewKeys();
   void viewPubSub();
+  void analyzeMemory();
+  void copyKeys();
+  void toggleLiveMode(bool live);
 
   void loadValue();
   void renKey();
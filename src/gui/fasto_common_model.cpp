@@ -177,5 +177,30 @@ void FastoCommonModel::changeValue(const core::NDbKValue& value) {
   }
 }
 
+void FastoCommonModel::insertItems(const QModelIndex& parent, const std::vector<common::qt::gui::TreeItem*>& items) {
+  if (items.empty()) {
+    return;
+  }
+
+  common::qt::gui::TreeItem* parent_item = nullptr;
+  if (parent.isValid()) {
+    parent_item = common::qt::item<common::qt::gui::TreeItem*, common::qt::gui::TreeItem*>(parent);
+  } else {
+    parent_item = root();
+  }
+
+  if (!parent_item) {
+    DNOTREACHED();
+    return;
+  }
+
+  const int first = static_cast<int>(parent_item->childrenCount());
+  beginInsertRows(parent, first, first + static_cast<int>(items.size()) - 1);
+  for (size_t i = 0; i < items.size(); ++i) {
+    parent_item->addChildren(items[i]);
+  }
+  endInsertRows();
+}
+
 }  // namespace gui
 }  // namespace fastonosql
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <common/qt/gui/base/tree_model.h>  // for TreeModel
 
 namespace fastonosql {
@@ -39,6 +41,8 @@ class FastoCommonModel : public common::qt::gui::TreeModel {
   virtual int columnCount(const QModelIndex& parent) const override;
 
   void changeValue(const core::NDbKValue& value);
+  // one beginInsertRows/endInsertRows for all items, takes ownerships
+  void insertItems(const QModelIndex& parent, const std::vector<common::qt::gui::TreeItem*>& items);
 
  Q_SIGNALS:
   void changedValue(const core::NDbKValue& value);
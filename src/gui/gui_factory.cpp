@@ -154,6 +154,8 @@ const QIcon& GuiFactory::GetIcon(core::connectionTypes type) const {
     return upscaledbConnectionIcon();
   } else if (type == core::FORESTDB) {
     return forestdbConnectionIcon();
+  } else if (type == core::RDB) {
+    return redisConnectionIcon();
   } else {
     return GetServerIcon();
   }
@@ -354,6 +356,8 @@ const QIcon& GuiFactory::GetCommandIcon(core::connectionTypes type) const {
     return upscaledbConnectionIcon();
   } else if (type == core::UPSCALEDB) {
     return forestdbConnectionIcon();
+  } else if (type == core::RDB) {
+    return redisConnectionIcon();
   } else {
     return GetServerIcon();
   }
@@ -18,7 +18,7 @@
 
 #include "gui/shell/base_lexer.h"
 
-#include <common/qt/convert2string.h>  // for ConvertFromString
+#include <common/qt/convert2string.h>  // for ConvertFromString, ConvertToString
 #include <common/sprintf.h>
 
 namespace fastonosql {
@@ -55,20 +55,16 @@ BaseCommandsQsciApi::BaseCommandsQsciApi(BaseCommandsQsciLexer* lexer) : BaseQsc
 
 void BaseCommandsQsciApi::updateAutoCompletionList(const QStringList& context, QStringList& list) {
   BaseCommandsQsciLexer* lex = static_cast<BaseCommandsQsciLexer*>(lexer());
-  auto commands = lex->commands();
+  const BaseCommandsQsciLexer::validated_commands_t& commands = lex->commands();
   for (auto it = context.begin(); it != context.end(); ++it) {
-    QString val = *it;
-    for (size_t i = 0; i < commands.size(); ++i) {
-      core::CommandInfo cmd = commands[i];
-      if (canSkipCommand(cmd)) {
+    std::vector<size_t> found;
+    lex->findCommandsByPrefix(*it, &found);
+    for (size_t i = 0; i < found.size(); ++i) {
+      if (canSkipCommand(commands[found[i]])) {
         continue;
       }
 
-      QString jval;
-      common::ConvertFromString(cmd.name, &jval);
-      if (jval.startsWith(val, Qt::CaseInsensitive)) {
-        list.append(jval + "?1");
-      }
+      list.append(lex->commandName(found[i]) + "?1");
     }
   }
 }
@@ -81,17 +77,10 @@ QStringList BaseCommandsQsciApi::callTips(const QStringList& context,
   UNUSED(style);
   UNUSED(shifts);
   BaseCommandsQsciLexer* lex = static_cast<BaseCommandsQsciLexer*>(lexer());
-  auto commands = lex->commands();
   for (auto it = context.begin(); it != context.end(); ++it) {
-    QString val = *it;
-    for (size_t i = 0; i < commands.size(); ++i) {
-      core::CommandInfo cmd = commands[i];
-
-      QString jval;
-      common::ConvertFromString(cmd.name, &jval);
-      if (QString::compare(jval, val, Qt::CaseInsensitive) == 0) {
-        return QStringList() << makeCallTip(cmd);
-      }
+    size_t index;
+    if (lex->findCommand(*it, &index)) {
+      return QStringList() << makeCallTip(lex->commands()[index]);
     }
   }
 
@@ -133,7 +122,15 @@ BaseQsciApi* BaseQsciLexer::apis() const {
 }
 
 BaseCommandsQsciLexer::BaseCommandsQsciLexer(const std::vector<core::CommandHolder>& commands, QObject* parent)
-    : BaseQsciLexer(parent), commands_(MakeValidatedCommands(commands)) {}
+    : BaseQsciLexer(parent), commands_(MakeValidatedCommands(commands)), commands_names_(), commands_trie_() {
+  commands_names_.reserve(commands_.size());
+  for (size_t i = 0; i < commands_.size(); ++i) {
+    QString name;
+    common::ConvertFromString(commands_[i].name, &name);
+    commands_names_.push_back(name);
+    commands_trie_.Insert(commands_[i].name, i);
+  }
+}
 
 std::vector<uint32_t> BaseCommandsQsciLexer::supportedVersions() const {
   std::vector<uint32_t> result;
@@ -166,40 +163,63 @@ size_t BaseCommandsQsciLexer::commandsCount() const {
   return commands_.size();
 }
 
+void BaseCommandsQsciLexer::findCommandsByPrefix(const QString& prefix, std::vector<size_t>* indexes) const {
+  const std::string prefix_str = common::ConvertToString(prefix);
+  commands_trie_.FindByPrefix(prefix_str.data(), prefix_str.size(), indexes);
+}
+
+bool BaseCommandsQsciLexer::findCommand(const QString& name, size_t* index) const {
+  const std::string name_str = common::ConvertToString(name);
+  return commands_trie_.Find(name_str.data(), name_str.size(), index);
+}
+
+const QString& BaseCommandsQsciLexer::commandName(size_t index) const {
+  return commands_names_[index];
+}
+
 void BaseCommandsQsciLexer::styleText(int start, int end) {
   if (!editor()) {
     return;
   }
 
-  char* data = new char[end - start + 1];
-  editor()->SendScintilla(QsciScintilla::SCI_GETTEXTRANGE, start, end, data);
-  QString source(data);
-  delete[] data;
-
-  if (source.isEmpty()) {
+  // restyle from the beginning of the edited line, a command can start before start
+  const long line = editor()->SendScintilla(QsciScintilla::SCI_LINEFROMPOSITION, start);
+  const int line_start = static_cast<int>(editor()->SendScintilla(QsciScintilla::SCI_POSITIONFROMLINE, line));
+  if (end <= line_start) {
     return;
   }
 
-  paintCommands(source, start);
+  std::vector<char> data(end - line_start + 1);
+  editor()->SendScintilla(QsciScintilla::SCI_GETTEXTRANGE, line_start, end, data.data());
+  paintCommands(data.data(), end - line_start, line_start);
 }
 
-void BaseCommandsQsciLexer::paintCommands(const QString& source, int start) {
-  for (size_t i = 0; i < commands_.size(); ++i) {
-    core::CommandInfo cmd = commands_[i];
-    QString word;
-    if (common::ConvertFromString(cmd.name, &word)) {
-      int index = 0;
-      int begin = 0;
-
-      int st = cmd.type == core::CommandInfo::Native ? Command : ExCommand;
-      while ((begin = source.indexOf(word, index, Qt::CaseInsensitive)) != -1) {
-        index = begin + word.length();
-
-        startStyling(start + begin);
-        setStyling(word.length(), st);
-        startStyling(start + begin);
+void BaseCommandsQsciLexer::paintCommands(const char* text, int size, int start) {
+  // single pass: commands start only at word beginnings, everything else is default
+  startStyling(start);
+  int plain = 0;
+  int pos = 0;
+  while (pos < size) {
+    if (pos == 0 || !core::CommandsTrie::IsWordChar(text[pos - 1])) {
+      size_t index = 0;
+      const int len = static_cast<int>(commands_trie_.MatchWord(text + pos, size - pos, &index));
+      if (len) {
+        if (plain) {
+          setStyling(plain, Default);
+          plain = 0;
+        }
+        setStyling(len, commands_[index].type == core::CommandInfo::Native ? Command : ExCommand);
+        pos += len;
+        continue;
       }
     }
+
+    plain++;
+    pos++;
+  }
+
+  if (plain) {
+    setStyling(plain, Default);
   }
 }
 
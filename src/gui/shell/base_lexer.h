@@ -22,6 +22,7 @@
 #include <Qsci/qscilexercustom.h>
 
 #include "core/command_holder.h"
+#include "core/commands_trie.h"
 
 namespace fastonosql {
 namespace gui {
@@ -73,14 +74,21 @@ class BaseCommandsQsciLexer : public BaseQsciLexer {
   virtual size_t commandsCount() const override;
   const validated_commands_t& commands() const;
 
+  // indexes in commands(), case insensitive
+  void findCommandsByPrefix(const QString& prefix, std::vector<size_t>* indexes) const;
+  bool findCommand(const QString& name, size_t* index) const;
+  const QString& commandName(size_t index) const;
+
  protected:
   explicit BaseCommandsQsciLexer(const std::vector<core::CommandHolder>& commands, QObject* parent = Q_NULLPTR);
 
  private:
   virtual void styleText(int start, int end) override;
-  void paintCommands(const QString& source, int start);
+  void paintCommands(const char* text, int size, int start);
 
   const validated_commands_t commands_;
+  std::vector<QString> commands_names_;
+  core::CommandsTrie commands_trie_;
 };
 
 class BaseCommandsQsciApi : public BaseQsciApi {
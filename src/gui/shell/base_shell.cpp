@@ -57,6 +57,9 @@
 #ifdef BUILD_WITH_FORESTDB
 #include "gui/db/forestdb/lexer.h"
 #endif
+#ifdef BUILD_WITH_RDB
+#include "gui/db/rdb/lexer.h"
+#endif
 
 namespace {
 const QSize image_size(64, 64);
@@ -113,6 +116,11 @@ BaseShell::BaseShell(core::connectionTypes type, bool showAutoCompl, QWidget* pa
   if (type == core::FORESTDB) {
     lex = new forestdb::Lexer(this);
   }
+#endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    lex = new rdb::Lexer(this);
+  }
 #endif
   const QIcon& ic = gui::GuiFactory::GetInstance().GetCommandIcon(type);
   QPixmap pix = ic.pixmap(image_size);
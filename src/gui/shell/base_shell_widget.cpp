@@ -32,7 +32,7 @@
 
 #include <common/qt/convert2string.h>  // for ConvertToString
 #include <common/qt/gui/icon_label.h>  // for IconLabel
-#include <common/qt/logger.h>          // for LOG_ERROR
+#include <common/qt/logger.h>          // for LOG_ERROR, LOG_MSG
 
 #include "proxy/server/iserver_local.h"
 #include "proxy/server/iserver_remote.h"
@@ -60,6 +60,8 @@ const QString trAdvancedOptions = QObject::tr("Advanced options");
 const QString trIntervalMsec = QObject::tr("Interval msec:");
 const QString trRepeat = QObject::tr("Repeat:");
 const QString trBasedOn_2S = QObject::tr("Based on <b>%1</b> version: <b>%2</b>");
+const QString trExecuteFromFile = QObject::tr("Execute script from file");
+const QString trScriptExecutedTemplate_2S = QObject::tr("Script executed, commands: %1, failed: %2");
 
 }  // namespace
 
@@ -93,6 +95,7 @@ BaseShellWidget::BaseShellWidget(proxy::IServerSPtr server, const QString& fileP
       loadAction_(nullptr),
       saveAction_(nullptr),
       saveAsAction_(nullptr),
+      executeFileAction_(nullptr),
       validateAction_(nullptr),
       supported_commands_count_(nullptr),
       validated_commands_count_(nullptr),
@@ -127,6 +130,11 @@ QToolBar* BaseShellWidget::createToolBar() {
   VERIFY(connect(saveAsAction_, &QAction::triggered, this, &BaseShellWidget::saveToFileAs));
   savebar->addAction(saveAsAction_);
 
+  executeFileAction_ = new QAction;
+  executeFileAction_->setIcon(gui::GuiFactory::GetInstance().GetExecuteIcon());
+  VERIFY(connect(executeFileAction_, &QAction::triggered, this, &BaseShellWidget::executeFromFile));
+  savebar->addAction(executeFileAction_);
+
   connectAction_ = new QAction;
   connectAction_->setIcon(gui::GuiFactory::GetInstance().GetConnectIcon());
   VERIFY(connect(connectAction_, &QAction::triggered, this, &BaseShellWidget::connectToServer));
@@ -332,6 +340,7 @@ void BaseShellWidget::retranslateUi() {
   loadAction_->setText(translations::trLoad);
   saveAction_->setText(translations::trSave);
   saveAsAction_->setText(translations::trSaveAs);
+  executeFileAction_->setText(trExecuteFromFile);
   connectAction_->setText(translations::trConnect);
   disConnectAction_->setText(translations::trDisconnect);
   executeAction_->setText(translations::trExecute);
@@ -382,7 +391,7 @@ void BaseShellWidget::executeArgs(const QString& text, int repeat, int interval,
 }
 
 void BaseShellWidget::stop() {
-  server_->StopCurrentEvent();
+  server_->StopEvent(this);
 }
 
 void BaseShellWidget::connectToServer() {
@@ -419,6 +428,21 @@ bool BaseShellWidget::loadFromFile(const QString& path) {
   return false;
 }
 
+void BaseShellWidget::executeFromFile() {
+  QString filepath =
+      QFileDialog::getOpenFileName(this, trExecuteFromFile, filePath_, translations::trfilterForScripts);
+  if (filepath.isEmpty()) {
+    return;
+  }
+
+  // file is streamed by the driver, results are not kept only counted
+  int repeat = repeatCount_->value();
+  int interval = intervalMsec_->value();
+  proxy::events_info::ExecuteInfoRequest req(this, core::command_buffer_t(), repeat, interval, false, true,
+                                             core::C_USER, common::ConvertToString(filepath));
+  server_->Execute(req);
+}
+
 void BaseShellWidget::saveToFileAs() {
   QString filepath = ShowSaveFileDialog(this, translations::trSaveAs, filePath_, translations::trfilterForScripts);
   if (filepath.isEmpty()) {
@@ -552,15 +576,20 @@ void BaseShellWidget::startExecute(const proxy::events_info::ExecuteInfoRequest&
   intervalMsec_->setEnabled(false);
   historyCall_->setEnabled(false);
   executeAction_->setEnabled(false);
+  executeFileAction_->setEnabled(false);
   stopAction_->setEnabled(true);
 }
 void BaseShellWidget::finishExecute(const proxy::events_info::ExecuteInfoResponce& res) {
-  UNUSED(res);
+  if (res.silence && !res.errorInfo()) {
+    QString msg = trScriptExecutedTemplate_2S.arg(res.executed_commands).arg(res.failed_commands);
+    LOG_MSG(common::ConvertToString(msg), common::logging::LOG_LEVEL_INFO, true);
+  }
 
   repeatCount_->setEnabled(true);
   intervalMsec_->setEnabled(true);
   historyCall_->setEnabled(true);
   executeAction_->setEnabled(true);
+  executeFileAction_->setEnabled(true);
   stopAction_->setEnabled(false);
 }
 
@@ -93,6 +93,7 @@ class BaseShellWidget : public QWidget {
   void disconnectFromServer();
   void loadFromFile();
   bool loadFromFile(const QString& path);
+  void executeFromFile();
   void saveToFileAs();
   void saveToFile();
   void validateClick();
@@ -157,6 +158,7 @@ class BaseShellWidget : public QWidget {
   QAction* loadAction_;
   QAction* saveAction_;
   QAction* saveAsAction_;
+  QAction* executeFileAction_;
   QAction* validateAction_;
   QLabel* supported_commands_count_;
   QLabel* validated_commands_count_;
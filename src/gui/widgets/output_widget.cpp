@@ -94,8 +94,8 @@ OutputWidget::OutputWidget(proxy::IServerSPtr server, QWidget* parent) : QWidget
   VERIFY(connect(server_.get(), &proxy::IServer::RootCompleated, this, &OutputWidget::rootCompleate,
                  Qt::DirectConnection));
 
-  VERIFY(connect(server_.get(), &proxy::IServer::ChildAdded, this, &OutputWidget::addChild, Qt::DirectConnection));
-  VERIFY(connect(server_.get(), &proxy::IServer::ItemUpdated, this, &OutputWidget::updateItem, Qt::DirectConnection));
+  VERIFY(connect(server_.get(), &proxy::IServer::RootChildrenAdded, this, &OutputWidget::rootChildrenAdd,
+                 Qt::DirectConnection));
 
   treeView_ = new QTreeView;
   treeView_->setModel(commonModel_);
@@ -171,76 +171,73 @@ void OutputWidget::finishExecuteCommand(const proxy::events_info::ExecuteInfoRes
   UNUSED(res);
 }
 
-void OutputWidget::addChild(core::FastoObjectIPtr child) {
-  DCHECK(child->GetParent());
-
-  core::FastoObjectCommand* command = dynamic_cast<core::FastoObjectCommand*>(child.get());  // +
-  if (command) {
-    return;
-  }
-
-  command = dynamic_cast<core::FastoObjectCommand*>(child->GetParent());  // +
-  if (command) {
-    addCommand(command, child.get());
-    return;
-  }
-
-  core::FastoObject* arr = dynamic_cast<core::FastoObject*>(child->GetParent());  // +
-  CHECK(arr);
-
-  QModelIndex parent;
-  bool isFound = commonModel_->findItem(arr, &parent);
-  if (!isFound) {
-    return;
+void OutputWidget::rootChildrenAdd(const proxy::events_info::CommandRootChildrenAddedInfo& res) {
+  // consecutive children of the same parent inserted with one beginInsertRows/endInsertRows
+  void* group_owner = nullptr;
+  QModelIndex group_index;
+  FastoCommonItem* group_item = nullptr;
+  std::vector<common::qt::gui::TreeItem*> group;
+  for (size_t i = 0; i < res.childs.size(); ++i) {
+    core::FastoObject* child = res.childs[i].get();
+    DCHECK(child->GetParent());
+
+    if (dynamic_cast<core::FastoObjectCommand*>(child)) {  // +
+      continue;
+    }
+
+    core::FastoObjectCommand* command = dynamic_cast<core::FastoObjectCommand*>(child->GetParent());  // +
+    void* owner = command ? static_cast<void*>(command->GetParent()) : static_cast<void*>(child->GetParent());
+    if (owner != group_owner) {
+      commonModel_->insertItems(group_index, group);
+      group.clear();
+      group_owner = nullptr;
+      group_item = nullptr;
+
+      QModelIndex parent;
+      bool isFound = commonModel_->findItem(owner, &parent);
+      if (!isFound) {
+        continue;
+      }
+
+      FastoCommonItem* par = nullptr;
+      if (!parent.isValid()) {
+        par = static_cast<FastoCommonItem*>(commonModel_->root());
+      } else {
+        par = common::qt::item<common::qt::gui::TreeItem*, FastoCommonItem*>(parent);
+      }
+
+      if (!par) {
+        DNOTREACHED();
+        continue;
+      }
+
+      group_owner = owner;
+      group_index = parent;
+      group_item = par;
+    }
+
+    FastoCommonItem* comChild = command ? createCommandItem(group_item, command, child)
+                                        : createItem(group_item, core::command_buffer_t(), true, child);
+    group.push_back(comChild);
   }
+  commonModel_->insertItems(group_index, group);
 
-  fastonosql::gui::FastoCommonItem* par = nullptr;
-  if (!parent.isValid()) {
-    par = static_cast<fastonosql::gui::FastoCommonItem*>(commonModel_->root());
-  } else {
-    par = common::qt::item<common::qt::gui::TreeItem*, fastonosql::gui::FastoCommonItem*>(parent);
+  for (size_t i = 0; i < res.updates.size(); ++i) {
+    updateItem(res.updates[i].first, res.updates[i].second);
   }
-
-  if (!par) {
-    DNOTREACHED();
-    return;
-  }
-
-  fastonosql::gui::FastoCommonItem* comChild = createItem(par, core::command_buffer_t(), true, child.get());
-  commonModel_->insertItem(parent, comChild);
 }
 
-void OutputWidget::addCommand(core::FastoObjectCommand* command, core::FastoObject* child) {
-  void* parentinner = command->GetParent();
-
-  QModelIndex parent;
-  bool isFound = commonModel_->findItem(parentinner, &parent);
-  if (!isFound) {
-    return;
-  }
-
-  fastonosql::gui::FastoCommonItem* par = nullptr;
-  if (!parent.isValid()) {
-    par = static_cast<fastonosql::gui::FastoCommonItem*>(commonModel_->root());
-  } else {
-    par = common::qt::item<common::qt::gui::TreeItem*, fastonosql::gui::FastoCommonItem*>(parent);
-  }
-
-  if (!par) {
-    DNOTREACHED();
-    return;
-  }
-
-  fastonosql::gui::FastoCommonItem* comChild = nullptr;
+FastoCommonItem* OutputWidget::createCommandItem(FastoCommonItem* parent,
+                                                 core::FastoObjectCommand* command,
+                                                 core::FastoObject* child) {
   core::translator_t tr = server_->GetTranslator();
   core::command_buffer_t input_cmd = command->GetInputCommand();
   core::string_key_t key;
   if (tr->IsLoadKeyCommand(input_cmd, &key)) {
-    comChild = createItem(par, key, false, child);
-  } else {
-    comChild = createItem(par, input_cmd, true, child);
+    return createItem(parent, key, false, child);
   }
-  commonModel_->insertItem(parent, comChild);
+
+  return createItem(parent, input_cmd, true, child);
 }
 
 void OutputWidget::updateItem(core::FastoObject* item, common::ValueSPtr newValue) {
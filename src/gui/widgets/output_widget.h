@@ -44,6 +44,7 @@ struct ExecuteInfoRequest;
 struct ExecuteInfoResponce;
 struct CommandRootCompleatedInfo;
 struct CommandRootCreatedInfo;
+struct CommandRootChildrenAddedInfo;
 }  // namespace events_info
 }  // namespace proxy
 }  // namespace fastonosql
@@ -51,6 +52,7 @@ namespace fastonosql {
 namespace gui {
 class FastoTextView;
 class FastoCommonModel;
+class FastoCommonItem;
 }  // namespace gui
 }  // namespace fastonosql
 
@@ -70,19 +72,20 @@ class OutputWidget : public QWidget {
 
   void rootCreate(const proxy::events_info::CommandRootCreatedInfo& res);
   void rootCompleate(const proxy::events_info::CommandRootCompleatedInfo& res);
+  void rootChildrenAdd(const proxy::events_info::CommandRootChildrenAddedInfo& res);
 
   void addKey(core::IDataBaseInfoSPtr db, core::NDbKValue key);
   void updateKey(core::IDataBaseInfoSPtr db, core::NDbKValue key);
 
-  void addChild(core::FastoObjectIPtr child);
-  void addCommand(core::FastoObjectCommand* command, core::FastoObject* child);
-  void updateItem(core::FastoObject* item, common::ValueSPtr newValue);
-
   void setTreeView();
   void setTableView();
   void setTextView();
 
  private:
+  FastoCommonItem* createCommandItem(FastoCommonItem* parent,
+                                     core::FastoObjectCommand* command,
+                                     core::FastoObject* child);
+  void updateItem(core::FastoObject* item, common::ValueSPtr newValue);
   void syncWithSettings();
   void updateTimeLabel(const proxy::events_info::EventInfoBase& evinfo);
   common::qt::gui::IconLabel* timeLabel_;
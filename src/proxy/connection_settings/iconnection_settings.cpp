@@ -55,6 +55,9 @@
 #ifdef BUILD_WITH_FORESTDB
 #define LOGGING_FORESTDB_FILE_EXTENSION ".forestdb"
 #endif
+#ifdef BUILD_WITH_RDB
+#define LOGGING_RDB_FILE_EXTENSION ".rdbinfo"
+#endif
 
 namespace fastonosql {
 namespace proxy {
@@ -202,6 +205,11 @@ std::string IConnectionSettingsBase::GetLoggingPath() const {
     return prefix + LOGGING_FORESTDB_FILE_EXTENSION;
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (type_ == core::RDB) {
+    return prefix + LOGGING_RDB_FILE_EXTENSION;
+  }
+#endif
 
   NOTREACHED();
   return std::string();
@@ -56,6 +56,10 @@
 #include "proxy/db/forestdb/connection_settings.h"  // for ConnectionSettings
 #define LOGGING_FORESTDB_FILE_EXTENSION ".forestdb"
 #endif
+#ifdef BUILD_WITH_RDB
+#include "proxy/db/rdb/connection_settings.h"  // for ConnectionSettings
+#define LOGGING_RDB_FILE_EXTENSION ".rdbinfo"
+#endif
 
 namespace fastonosql {
 namespace proxy {
@@ -106,6 +110,11 @@ IConnectionSettingsBase* ConnectionSettingsFactory::CreateFromType(core::connect
   if (type == core::FORESTDB) {
     return new forestdb::ConnectionSettings(conName);
   }
+#endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    return new rdb::ConnectionSettings(conName);
+  }
 #endif
   return nullptr;
 }
@@ -18,7 +18,10 @@
 
 #include "proxy/db/forestdb/driver.h"
 
+#include <QTimerEvent>
+
 #include <common/convert2string.h>  // for ConvertToString
+#include <common/qt/logger.h>       // for LOG_ERROR
 
 #include "core/db/forestdb/database_info.h"
 #include "core/db/forestdb/db_connection.h"  // for DBConnection
@@ -31,12 +34,16 @@
 
 #define FORESTDB_GET_DATABASES_COMMAND "CONFIG GET databases"
 
+namespace {
+const int kMaintenanceIntervalMsec = 1000;  // if commit interval is disabled
+}
+
 namespace fastonosql {
 namespace proxy {
 namespace forestdb {
 
 Driver::Driver(IConnectionSettingsBaseSPtr settings)
-    : IDriverLocal(settings), impl_(new core::forestdb::DBConnection(this)) {
+    : IDriverLocal(settings), impl_(new core::forestdb::DBConnection(this)), maintenance_timer_id_(0) {
   COMPILE_ASSERT(core::forestdb::DBConnection::connection_t == core::FORESTDB,
                  "DBConnection must be the same type as Driver!");
   CHECK(GetType() == core::FORESTDB);
@@ -58,6 +65,14 @@ core::translator_t Driver::GetTranslator() const {
   return impl_->GetTranslator();
 }
 
+core::CommandsStatsSnapShoot Driver::GetCommandsStats() const {
+  return impl_->GetCommandsStats();
+}
+
+void Driver::ResetCommandsStats() {
+  impl_->ResetCommandsStats();
+}
+
 bool Driver::IsConnected() const {
   return impl_->IsConnected();
 }
@@ -80,12 +95,36 @@ core::FastoObjectCommandIPtr Driver::CreateCommandFast(const core::command_buffe
   return proxy::CreateCommandFast<forestdb::Command>(input, ct);
 }
 
+void Driver::timerEvent(QTimerEvent* event) {
+  if (maintenance_timer_id_ == event->timerId() && IsConnected()) {
+    // commits and compaction run on driver thread between commands
+    common::Error err = impl_->Maintenance();
+    if (err) {
+      LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, false);
+    }
+  }
+  IDriverLocal::timerEvent(event);
+}
+
 common::Error Driver::SyncConnect() {
   auto forestdb_settings = GetSpecificSettings<ConnectionSettings>();
-  return impl_->Connect(forestdb_settings->GetInfo());
+  core::forestdb::Config config = forestdb_settings->GetInfo();
+  common::Error err = impl_->Connect(config);
+  if (err) {
+    return err;
+  }
+
+  maintenance_timer_id_ = startTimer(config.commit_interval_msec ? config.commit_interval_msec / 2 + 1
+                                                                 : kMaintenanceIntervalMsec);
+  DCHECK(maintenance_timer_id_ != 0);
+  return common::Error();
 }
 
 common::Error Driver::SyncDisconnect() {
+  if (maintenance_timer_id_ != 0) {
+    killTimer(maintenance_timer_id_);
+    maintenance_timer_id_ = 0;
+  }
   return impl_->Disconnect();
 }
 
@@ -39,10 +39,15 @@ class Driver : public IDriverLocal {
   virtual void SetInterrupted(bool interrupted) override;
 
   virtual core::translator_t GetTranslator() const override;
+  virtual core::CommandsStatsSnapShoot GetCommandsStats() const override;
+  virtual void ResetCommandsStats() override;
 
   virtual bool IsConnected() const override;
   virtual bool IsAuthenticated() const override;
 
+ protected:
+  virtual void timerEvent(QTimerEvent* event) override;
+
  private:
   virtual void InitImpl() override;
   virtual void ClearImpl() override;
@@ -69,6 +74,7 @@ class Driver : public IDriverLocal {
   virtual core::IServerInfoSPtr MakeServerInfoFromString(const std::string& val) override;
 
   core::forestdb::DBConnection* const impl_;
+  int maintenance_timer_id_;
 };
 
 }  // namespace forestdb
@@ -56,6 +56,14 @@ core::translator_t Driver::GetTranslator() const {
   return impl_->GetTranslator();
 }
 
+core::CommandsStatsSnapShoot Driver::GetCommandsStats() const {
+  return impl_->GetCommandsStats();
+}
+
+void Driver::ResetCommandsStats() {
+  impl_->ResetCommandsStats();
+}
+
 bool Driver::IsConnected() const {
   return impl_->IsConnected();
 }
@@ -42,6 +42,8 @@ class Driver : public IDriverLocal {
   virtual void SetInterrupted(bool interrupted) override;
 
   virtual core::translator_t GetTranslator() const override;
+  virtual core::CommandsStatsSnapShoot GetCommandsStats() const override;
+  virtual void ResetCommandsStats() override;
 
   virtual bool IsConnected() const override;
   virtual bool IsAuthenticated() const override;
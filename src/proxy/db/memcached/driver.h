@@ -42,6 +42,8 @@ class Driver : public IDriverRemote {
   virtual void SetInterrupted(bool interrupted) override;
 
   virtual core::translator_t GetTranslator() const override;
+  virtual core::CommandsStatsSnapShoot GetCommandsStats() const override;
+  virtual void ResetCommandsStats() override;
 
   virtual bool IsConnected() const override;
   virtual bool IsAuthenticated() const override;
@@ -59,6 +61,7 @@ class Driver : public IDriverRemote {
 
   virtual common::Error SyncConnect() override WARN_UNUSED_RESULT;
   virtual common::Error SyncDisconnect() override WARN_UNUSED_RESULT;
+  virtual IDriver* CreateWorkerImpl() const override;
 
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) override;
 
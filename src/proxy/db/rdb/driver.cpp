@@ -0,0 +1,262 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/db/rdb/driver.h"
+
+#include <common/convert2string.h>  // for ConvertToString
+
+#include "core/db/rdb/database_info.h"
+#include "core/db/rdb/db_connection.h"  // for DBConnection
+#include "core/value.h"
+
+#include "proxy/command/command.h"                  // for CreateCommand, etc
+#include "proxy/command/command_logger.h"           // for LOG_COMMAND
+#include "proxy/db/rdb/command.h"              // for Command
+#include "proxy/db/rdb/connection_settings.h"  // for ConnectionSettings
+
+#define RDB_GET_DATABASES_COMMAND "CONFIG GET databases"
+
+namespace fastonosql {
+namespace proxy {
+namespace rdb {
+
+Driver::Driver(IConnectionSettingsBaseSPtr settings)
+    : IDriverLocal(settings), impl_(new core::rdb::DBConnection(this)) {
+  COMPILE_ASSERT(core::rdb::DBConnection::connection_t == core::RDB,
+                 "DBConnection must be the same type as Driver!");
+  CHECK(GetType() == core::RDB);
+}
+
+Driver::~Driver() {
+  delete impl_;
+}
+
+bool Driver::IsInterrupted() const {
+  return impl_->IsInterrupted();
+}
+
+void Driver::SetInterrupted(bool interrupted) {
+  impl_->SetInterrupted(interrupted);
+}
+
+core::translator_t Driver::GetTranslator() const {
+  return impl_->GetTranslator();
+}
+
+core::CommandsStatsSnapShoot Driver::GetCommandsStats() const {
+  return impl_->GetCommandsStats();
+}
+
+void Driver::ResetCommandsStats() {
+  impl_->ResetCommandsStats();
+}
+
+bool Driver::IsConnected() const {
+  return impl_->IsConnected();
+}
+
+bool Driver::IsAuthenticated() const {
+  return impl_->IsAuthenticated();
+}
+
+void Driver::InitImpl() {}
+
+void Driver::ClearImpl() {}
+
+core::FastoObjectCommandIPtr Driver::CreateCommand(core::FastoObject* parent,
+                                                   const core::command_buffer_t& input,
+                                                   core::CmdLoggingType ct) {
+  return proxy::CreateCommand<rdb::Command>(parent, input, ct);
+}
+
+core::FastoObjectCommandIPtr Driver::CreateCommandFast(const core::command_buffer_t& input, core::CmdLoggingType ct) {
+  return proxy::CreateCommandFast<rdb::Command>(input, ct);
+}
+
+common::Error Driver::SyncConnect() {
+  auto rdb_settings = GetSpecificSettings<ConnectionSettings>();
+  return impl_->Connect(rdb_settings->GetInfo());
+}
+
+common::Error Driver::SyncDisconnect() {
+  return impl_->Disconnect();
+}
+
+common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) {
+  return impl_->Execute(command, out);
+}
+
+common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
+  LOG_COMMAND(cmd);
+  core::rdb::ServerInfo::Stats cm;
+  common::Error err = impl_->Info(std::string(), &cm);
+  if (err) {
+    return err;
+  }
+
+  *info = new core::rdb::ServerInfo(cm);
+  return common::Error();
+}
+
+common::Error Driver::GetServerCommands(std::vector<const core::CommandInfo*>* commands) {
+  std::vector<const core::CommandInfo*> lcommands;
+  const core::ConstantCommandsArray& origin = core::rdb::DBConnection::GetCommands();
+  for (size_t i = 0; i < origin.size(); ++i) {
+    lcommands.push_back(&origin[i]);
+  }
+  *commands = lcommands;
+  return common::Error();
+}
+
+common::Error Driver::GetServerLoadedModules(std::vector<core::ModuleInfo>* modules) {
+  *modules = std::vector<core::ModuleInfo>();
+  return common::Error();
+}
+
+common::Error Driver::GetCurrentDataBaseInfo(core::IDataBaseInfo** info) {
+  if (!info) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  return impl_->Select(impl_->GetCurrentDBName(), info);
+}
+
+void Driver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadDatabasesInfoResponceEvent::value_type res(ev->value());
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(RDB_GET_DATABASES_COMMAND, core::C_INNER);
+  NotifyProgress(sender, 50);
+
+  core::IDataBaseInfo* info = nullptr;
+  common::Error err = GetCurrentDataBaseInfo(&info);
+  if (err) {
+    res.setErrorInfo(err);
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  err = Execute(cmd.get());
+  if (err) {
+    res.setErrorInfo(err);
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+  CHECK_EQ(rchildrens.size(), 1);
+  auto ar = std::static_pointer_cast<common::ArrayValue>(rchildrens[0]->GetValue());
+  CHECK(ar);
+
+  core::IDataBaseInfoSPtr curdb(info);
+  if (!ar->IsEmpty()) {
+    for (size_t i = 0; i < ar->GetSize(); ++i) {
+      std::string name;
+      if (ar->GetString(i, &name)) {
+        core::IDataBaseInfoSPtr dbInf(new core::rdb::DataBaseInfo(name, false, 0));
+        if (dbInf->GetName() == curdb->GetName()) {
+          res.databases.push_back(curdb);
+        } else {
+          res.databases.push_back(dbInf);
+        }
+      }
+    }
+  } else {
+    res.databases.push_back(curdb);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadDatabaseContentResponceEvent::value_type res(ev->value());
+  const core::command_buffer_t pattern_result =
+      core::internal::GetKeysPattern(res.cursor_in, res.pattern, res.count_keys);
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(pattern_result, core::C_INNER);
+  NotifyProgress(sender, 50);
+  common::Error err = Execute(cmd);
+  if (err) {
+    res.setErrorInfo(err);
+  } else {
+    core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+    if (rchildrens.size()) {
+      CHECK_EQ(rchildrens.size(), 1);
+      core::FastoObject* array = rchildrens[0].get();
+      CHECK(array);
+      auto array_value = array->GetValue();
+      common::ArrayValue* arm = nullptr;
+      if (!array_value->GetAsList(&arm)) {
+        goto done;
+      }
+
+      CHECK_EQ(arm->GetSize(), 2);
+      std::string cursor;
+      bool isok = arm->GetString(0, &cursor);
+      if (!isok) {
+        goto done;
+      }
+
+      uint64_t lcursor;
+      if (common::ConvertFromString(cursor, &lcursor)) {
+        res.cursor_out = lcursor;
+      }
+
+      common::ArrayValue* ar = nullptr;
+      isok = arm->GetList(1, &ar);
+      if (!isok) {
+        goto done;
+      }
+
+      for (size_t i = 0; i < ar->GetSize(); ++i) {
+        std::string key_str;
+        if (ar->GetString(i, &key_str)) {
+          core::key_t key(key_str);
+          core::NKey k(key);
+          core::NValue empty_val(core::CreateEmptyValueFromType(common::Value::TYPE_STRING));
+          core::NDbKValue ress(k, empty_val);
+          res.keys.push_back(ress);
+        }
+      }
+
+      common::Error err = impl_->DBkcount(&res.db_keys_count);
+      DCHECK(!err);
+    }
+  }
+done:
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadDatabaseContentResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
+  core::IServerInfoSPtr res(core::rdb::MakeRdbServerInfo(val));
+  return res;
+}
+
+}  // namespace rdb
+}  // namespace proxy
+}  // namespace fastonosql
@@ -18,6 +18,8 @@
 
 #include "proxy/db/redis/driver.h"
 
+#include <algorithm>  // for std::min
+
 #include <common/convert2string.h>           // for ConvertFromString, etc
 #include <common/file_system/file_system.h>  // for copy_file
 
@@ -105,6 +107,14 @@ core::translator_t Driver::GetTranslator() const {
   return impl_->GetTranslator();
 }
 
+core::CommandsStatsSnapShoot Driver::GetCommandsStats() const {
+  return impl_->GetCommandsStats();
+}
+
+void Driver::ResetCommandsStats() {
+  impl_->ResetCommandsStats();
+}
+
 bool Driver::IsConnected() const {
   return impl_->IsConnected();
 }
@@ -127,20 +137,36 @@ core::FastoObjectCommandIPtr Driver::CreateCommandFast(const core::command_buffe
   return proxy::CreateCommandFast<Command>(input, ct);
 }
 
-common::Error Driver::SyncConnect() {
+core::redis::RConfig Driver::GetConfig() const {
   auto redis_settings = GetSpecificSettings<ConnectionSettings>();
-  core::redis::RConfig rconf(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
-  return impl_->Connect(rconf);
+  return core::redis::RConfig(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
+}
+
+common::Error Driver::SyncConnect() {
+  return impl_->Connect(GetConfig());
 }
 
 common::Error Driver::SyncDisconnect() {
   return impl_->Disconnect();
 }
 
+IDriver* Driver::CreateWorkerImpl() const {
+  return new Driver(GetSpecificSettings<IConnectionSettingsBase>());
+}
+
 common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) {
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteSilent(const std::vector<core::command_buffer_t>& commands,
+                                    core::CmdLoggingType ct,
+                                    size_t* failed,
+                                    common::Error* first_failure) {
+  UNUSED(ct);
+  // pipeline safe commands of the window are sent with one round trip
+  return impl_->ExecuteAsPipeline(commands, failed, first_failure);
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
   common::Error err = Execute(cmd.get());
@@ -297,6 +323,26 @@ void Driver::HandleRestoreEvent(events::RestoreRequestEvent* ev) {
   NotifyProgress(sender, 100);
 }
 
+void Driver::HandleCopyKeysEvent(events::CopyKeysRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::CopyKeysResponceEvent::value_type res(ev->value());
+  size_t total = 0;  // scanned part of it is progress, unknown for failed DBSIZE
+  common::Error err = impl_->DBkcount(&total);
+  UNUSED(err);
+  auto observer = [this, sender, total](const core::redis::CopyKeysReport& report) {
+    if (total) {
+      NotifyProgress(sender, static_cast<int>(std::min<uint64_t>(report.scanned * 100 / total, 99)));
+    }
+  };
+  err = impl_->CopyKeys(res.destination, res.cconfig, observer, &res.report);
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::CopyKeysResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
 void Driver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
@@ -20,6 +20,8 @@
 
 #include "proxy/driver/idriver_remote.h"  // for IDriverRemote
 
+#include "core/db/redis/db_connection.h"  // for RConfig
+
 namespace fastonosql {
 namespace core {
 namespace redis {
@@ -42,10 +44,14 @@ class Driver : public IDriverRemote {
   virtual void SetInterrupted(bool interrupted) override;
 
   virtual core::translator_t GetTranslator() const override;
+  virtual core::CommandsStatsSnapShoot GetCommandsStats() const override;
+  virtual void ResetCommandsStats() override;
 
   virtual bool IsConnected() const override;
   virtual bool IsAuthenticated() const override;
 
+  core::redis::RConfig GetConfig() const;  // for own connections outside of driver thread
+
  private:
   virtual void InitImpl() override;
   virtual void ClearImpl() override;
@@ -59,8 +65,13 @@ class Driver : public IDriverRemote {
 
   virtual common::Error SyncConnect() override WARN_UNUSED_RESULT;
   virtual common::Error SyncDisconnect() override WARN_UNUSED_RESULT;
+  virtual IDriver* CreateWorkerImpl() const override;
 
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) override;
+  virtual common::Error ExecuteSilent(const std::vector<core::command_buffer_t>& commands,
+                                      core::CmdLoggingType ct,
+                                      size_t* failed,
+                                      common::Error* first_failure) override WARN_UNUSED_RESULT;
 
   virtual common::Error GetCurrentServerInfo(core::IServerInfo** info) override;
   virtual common::Error GetServerCommands(std::vector<const core::CommandInfo*>* commands) override;
@@ -73,6 +84,7 @@ class Driver : public IDriverRemote {
   virtual void HandleLoadServerChannelsRequestEvent(events::LoadServerChannelsRequestEvent* ev) override;
   virtual void HandleBackupEvent(events::BackupRequestEvent* ev) override;
   virtual void HandleRestoreEvent(events::RestoreRequestEvent* ev) override;
+  virtual void HandleCopyKeysEvent(events::CopyKeysRequestEvent* ev) override;
 
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) override;
 
@@ -18,7 +18,13 @@
 
 #include "proxy/db/redis/server.h"
 
+#include <QTimerEvent>
+
+#include <common/convert2string.h>
+#include <common/qt/logger.h>  // for LOG_ERROR, LOG_MSG
+
 #include "core/db/redis/server_info.h"  // for ServerInfo, etc
+#include "core/value.h"                 // for CreateEmptyValueFromType
 
 #include "proxy/db/redis/database.h"  // for Database
 #include "proxy/db/redis/driver.h"    // for Driver
@@ -29,16 +35,29 @@
 #define SENTINEL_MODE "sentinel"
 #define CLUSTER_MODE "cluster"
 
+namespace {
+// keyspace events of one interval are coalesced and applied at once
+const int kLiveModeApplyIntervalMsec = 250;
+}  // namespace
+
 namespace fastonosql {
 namespace proxy {
 namespace redis {
 
 Server::Server(IConnectionSettingsBaseSPtr settings)
-    : IServerRemote(new Driver(settings)), role_(core::MASTER), mode_(core::STANDALONE) {
+    : IServerRemote(new Driver(settings)),
+      role_(core::MASTER),
+      mode_(core::STANDALONE),
+      live_mode_(false),
+      live_timer_id_(0),
+      live_listener_() {
+  VERIFY(connect(this, &IServer::DatabaseChanged, this, &Server::RestartLiveMode));
+  VERIFY(connect(this, &IServer::Disconnected, this, &Server::StopLiveMode));
   StartCheckKeyExistTimer();
 }
 
 Server::~Server() {
+  StopLiveMode();
   StopCheckKeyExistTimer();
 }
 
@@ -59,6 +78,129 @@ common::net::HostAndPort Server::GetHost() const {
   return rdrv->GetHost();
 }
 
+bool Server::IsLiveModeSupported() const {
+  return true;
+}
+
+bool Server::IsLiveMode() const {
+  return live_mode_;
+}
+
+void Server::SetLiveMode(bool live) {
+  if (live == live_mode_) {
+    return;
+  }
+
+  if (!live) {
+    StopLiveMode();
+    return;
+  }
+
+  live_mode_ = true;
+  RestartLiveMode();
+}
+
+void Server::timerEvent(QTimerEvent* event) {
+  if (live_timer_id_ != 0 && live_timer_id_ == event->timerId()) {
+    ApplyKeyspaceEvents();
+  }
+  IServerRemote::timerEvent(event);
+}
+
+core::redis::RConfig Server::GetConfig() const {
+  Driver* const rdrv = static_cast<Driver* const>(drv_);
+  core::redis::RConfig config = rdrv->GetConfig();
+  database_t cdb = GetCurrentDatabaseInfo();
+  int db_num = 0;
+  if (cdb && common::ConvertFromString(cdb->GetName(), &db_num)) {
+    config.db_num = db_num;
+  }
+  return config;
+}
+
+void Server::RestartLiveMode() {
+  if (!live_mode_) {
+    return;
+  }
+
+  // notifications are per database, listener follows current one
+  live_listener_.Stop();
+  database_t cdb = GetCurrentDatabaseInfo();
+  Driver* const rdrv = static_cast<Driver* const>(drv_);
+  core::redis::RConfig config = rdrv->GetConfig();
+  if (!cdb || !IsConnected() || !common::ConvertFromString(cdb->GetName(), &config.db_num)) {
+    StopLiveMode();
+    return;
+  }
+
+  live_listener_.Start(config);
+  if (live_timer_id_ == 0) {
+    live_timer_id_ = startTimer(kLiveModeApplyIntervalMsec);
+    DCHECK(live_timer_id_ != 0);
+  }
+}
+
+void Server::StopLiveMode() {
+  live_mode_ = false;
+  if (live_timer_id_ != 0) {
+    killTimer(live_timer_id_);
+    live_timer_id_ = 0;
+  }
+  live_listener_.Stop();  // events not applied yet are dropped with listening
+}
+
+void Server::ApplyKeyspaceEvents() {
+  std::vector<core::redis::KeyspaceEvent> events;
+  bool overflowed = false;
+  common::Error err = live_listener_.Take(&events, &overflowed);
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+    StopLiveMode();
+    return;
+  }
+
+  if (overflowed) {
+    LOG_MSG("Too many keyspace changes to follow, load database content to see all of them.",
+            common::logging::LOG_LEVEL_WARNING, true);
+  }
+
+  for (const core::redis::KeyspaceEvent& event : events) {
+    const core::NKey key{core::key_t(event.key)};
+    switch (event.type) {
+      case core::redis::KeyspaceEvent::KEY_CHANGED:
+        // type unknown from event, key appears after next content load
+        if (event.value_type != common::Value::TYPE_NULL) {
+          core::NValue empty_val(core::CreateEmptyValueFromType(event.value_type));
+          AddKey(core::NDbKValue(key, empty_val));
+        }
+        break;
+      case core::redis::KeyspaceEvent::KEY_REMOVED:
+        RemoveKey(key);
+        break;
+      case core::redis::KeyspaceEvent::KEY_EXPIRE_CHANGED: {
+        core::translator_t trans = GetTranslator();
+        core::command_buffer_t load_ttl_cmd;
+        err = trans->LoadKeyTTLCommand(key, &load_ttl_cmd);
+        if (!err) {
+          events_info::ExecuteInfoRequest req(this, load_ttl_cmd, 0, 0, true, true, core::C_INNER);
+          Execute(req);
+        }
+        break;
+      }
+      case core::redis::KeyspaceEvent::KEY_PERSISTED:
+        ChangeKeyTTL(key, NO_TTL);
+        break;
+      case core::redis::KeyspaceEvent::KEY_RENAMED:
+        RenameKey(key, event.new_key);
+        break;
+      case core::redis::KeyspaceEvent::KEY_RENAMED_FROM:
+      case core::redis::KeyspaceEvent::KEY_RENAMED_TO:
+        DNOTREACHED();  // paired by batch
+        break;
+    }
+  }
+}
+
 IDatabaseSPtr Server::CreateDatabase(core::IDataBaseInfoSPtr info) {
   return IDatabaseSPtr(new Database(shared_from_this(), info));
 }
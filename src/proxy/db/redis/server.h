@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include "core/db/redis/keyspace_events.h"  // for KeyspaceListener
+
 #include "proxy/connection_settings/iconnection_settings.h"  // for IConnectionSettingsBaseSPtr
 #include "proxy/server/iserver_remote.h"                     // for IServerRemote
 
@@ -36,13 +38,30 @@ class Server : public IServerRemote {
   virtual core::serverState GetState() const override;
   virtual common::net::HostAndPort GetHost() const override;
 
+  virtual bool IsLiveModeSupported() const override;
+  virtual bool IsLiveMode() const override;
+  virtual void SetLiveMode(bool live) override;
+
+  core::redis::RConfig GetConfig() const;  // with current database, for own connections to this server
+
  protected:
   virtual void HandleDiscoveryInfoResponceEvent(events::DiscoveryInfoResponceEvent* ev) override;
+  virtual void timerEvent(QTimerEvent* event) override;
+
+ private Q_SLOTS:
+  void RestartLiveMode();
+  void StopLiveMode();
 
  private:
   virtual IDatabaseSPtr CreateDatabase(core::IDataBaseInfoSPtr info) override;
+  void ApplyKeyspaceEvents();
+
   core::serverTypes role_;
   core::serverMode mode_;
+
+  bool live_mode_;
+  int live_timer_id_;
+  core::redis::KeyspaceListener live_listener_;
 };
 
 }  // namespace redis
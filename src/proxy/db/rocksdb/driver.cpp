@@ -20,6 +20,7 @@
 
 #include <common/convert2string.h>
 
+#include "core/db/rocksdb/database_info.h"
 #include "core/db/rocksdb/db_connection.h"  // for DBConnection
 #include "core/value.h"
 
@@ -28,6 +29,8 @@
 #include "proxy/db/rocksdb/command.h"              // for Command
 #include "proxy/db/rocksdb/connection_settings.h"  // for ConnectionSettings
 
+#define ROCKSDB_GET_DATABASES_COMMAND "CONFIG GET databases"
+
 namespace fastonosql {
 namespace proxy {
 namespace rocksdb {
@@ -55,6 +58,14 @@ core::translator_t Driver::GetTranslator() const {
   return impl_->GetTranslator();
 }
 
+core::CommandsStatsSnapShoot Driver::GetCommandsStats() const {
+  return impl_->GetCommandsStats();
+}
+
+void Driver::ResetCommandsStats() {
+  impl_->ResetCommandsStats();
+}
+
 bool Driver::IsConnected() const {
   return impl_->IsConnected();
 }
@@ -127,6 +138,61 @@ common::Error Driver::GetCurrentDataBaseInfo(core::IDataBaseInfo** info) {
   return impl_->Select(impl_->GetCurrentDBName(), info);
 }
 
+void Driver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadDatabasesInfoResponceEvent::value_type res(ev->value());
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(ROCKSDB_GET_DATABASES_COMMAND, core::C_INNER);
+  NotifyProgress(sender, 50);
+
+  core::IDataBaseInfo* info = nullptr;
+  common::Error err = GetCurrentDataBaseInfo(&info);
+  if (err) {
+    res.setErrorInfo(err);
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  err = Execute(cmd.get());
+  if (err) {
+    res.setErrorInfo(err);
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+  CHECK_EQ(rchildrens.size(), 1);
+  auto ar = std::static_pointer_cast<common::ArrayValue>(rchildrens[0]->GetValue());
+  CHECK(ar);
+
+  core::IDataBaseInfoSPtr curdb(info);
+  for (size_t i = 0; i < ar->GetSize(); ++i) {
+    std::string name;
+    if (!ar->GetString(i, &name)) {
+      continue;
+    }
+
+    if (name == curdb->GetName()) {
+      res.databases.push_back(curdb);
+      continue;
+    }
+
+    // not selected families are not iterated, estimation is enough for the list
+    core::rocksdb::ColumnFamilyStats stats;
+    common::Error err = impl_->GetColumnFamilyStats(name, &stats);
+    UNUSED(err);
+    core::IDataBaseInfoSPtr dbInf(new core::rocksdb::DataBaseInfo(name, false, stats.estimate_num_keys));
+    res.databases.push_back(dbInf);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
 void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
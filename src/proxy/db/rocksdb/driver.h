@@ -42,6 +42,8 @@ class Driver : public IDriverLocal {
   virtual void SetInterrupted(bool interrupted) override;
 
   virtual core::translator_t GetTranslator() const override;
+  virtual core::CommandsStatsSnapShoot GetCommandsStats() const override;
+  virtual void ResetCommandsStats() override;
 
   virtual bool IsConnected() const override;
   virtual bool IsAuthenticated() const override;
@@ -67,6 +69,7 @@ class Driver : public IDriverLocal {
   virtual common::Error GetServerLoadedModules(std::vector<core::ModuleInfo>* modules) override;
   virtual common::Error GetCurrentDataBaseInfo(core::IDataBaseInfo** info) override;
 
+  virtual void HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) override;
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) override;
 
   virtual core::IServerInfoSPtr MakeServerInfoFromString(const std::string& val) override;
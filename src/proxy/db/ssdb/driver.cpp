@@ -54,6 +54,14 @@ core::translator_t Driver::GetTranslator() const {
   return impl_->GetTranslator();
 }
 
+core::CommandsStatsSnapShoot Driver::GetCommandsStats() const {
+  return impl_->GetCommandsStats();
+}
+
+void Driver::ResetCommandsStats() {
+  impl_->ResetCommandsStats();
+}
+
 bool Driver::IsConnected() const {
   return impl_->IsConnected();
 }
@@ -85,6 +93,10 @@ common::Error Driver::SyncDisconnect() {
   return impl_->Disconnect();
 }
 
+IDriver* Driver::CreateWorkerImpl() const {
+  return new Driver(GetSpecificSettings<IConnectionSettingsBase>());
+}
+
 common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) {
   return impl_->Execute(command, out);
 }
@@ -18,6 +18,8 @@
 
 #include "proxy/driver/idriver.h"
 
+#include <memory>
+
 #include <QApplication>
 #include <QThread>
 
@@ -25,16 +27,21 @@
 #include <common/file_system/file.h>
 #include <common/file_system/file_system.h>
 #include <common/file_system/string_path_utils.h>
+#include <common/macros.h>  // for SIZEOFMASS
 #include <common/sprintf.h>
+#include <common/string_util.h>
 #include <common/threads/platform_thread.h>
 #include <common/time.h>  // for current_mstime
 
+#include "core/script_reader.h"
+
 #include "proxy/command/command_logger.h"  // for LOG_COMMAND
 #include "proxy/driver/first_child_update_root_locker.h"
 
 namespace {
 
 const char magicNumber = 0x1E;
+const size_t kScriptWindowSize = 512;  // commands sent per round of a silent script
 std::string createStamp(common::time64_t time) {
   return magicNumber + common::ConvertToString(time) + '\n';
 }
@@ -84,6 +91,58 @@ const struct RegisterTypes {
   }
 } reg_type;
 
+template <typename event_t>
+bool GetRequestInitiator(QEvent* event, QObject** initiator) {
+  if (event->type() != static_cast<QEvent::Type>(event_t::EventType)) {
+    return false;
+  }
+
+  *initiator = static_cast<event_t*>(event)->value().initiator();
+  return true;
+}
+
+// requests which user can stop
+QObject* GetCancellableRequestInitiator(QEvent* event) {
+  QObject* initiator = nullptr;
+  if (GetRequestInitiator<events::ExecuteRequestEvent>(event, &initiator) ||
+      GetRequestInitiator<events::LoadDatabaseContentRequestEvent>(event, &initiator) ||
+      GetRequestInitiator<events::BackupRequestEvent>(event, &initiator) ||
+      GetRequestInitiator<events::RestoreRequestEvent>(event, &initiator)) {
+    return initiator;
+  }
+
+#ifdef BUILD_WITH_REDIS
+  if (GetRequestInitiator<events::CopyKeysRequestEvent>(event, &initiator)) {
+    return initiator;
+  }
+#endif
+
+  return nullptr;
+}
+
+// commands which stream replies until user stops them
+const char* const kStreamingCommands[] = {"MONITOR", DB_SUBSCRIBE_COMMAND, "PSUBSCRIBE", "SYNC", "PSYNC"};
+
+bool IsStreamingRequest(QEvent* event) {
+  if (event->type() != static_cast<QEvent::Type>(events::ExecuteRequestEvent::EventType)) {
+    return false;
+  }
+
+  events::ExecuteRequestEvent::value_type req(static_cast<events::ExecuteRequestEvent*>(event)->value());
+  core::ScriptReader reader(&req.text);
+  core::command_buffer_t command;
+  while (reader.ReadCommand(&command)) {
+    const core::command_buffer_t name = common::StringToUpperASCII(command.substr(0, command.find_first_of(" \t")));
+    for (size_t i = 0; i < SIZEOFMASS(kStreamingCommands); ++i) {
+      if (name == kStreamingCommands[i]) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 void NotifyProgressImpl(IDriver* sender, QObject* reciver, int value) {
   IDriver::Reply(reciver, new events::ProgressResponceEvent(sender, events::ProgressResponceEvent::value_type(value)));
 }
@@ -106,7 +165,19 @@ void ReplyNotImplementedYet(IDriver* sender, event_request_type* ev, const char*
 }  // namespace
 
 IDriver::IDriver(IConnectionSettingsBaseSPtr settings)
-    : settings_(settings), thread_(nullptr), timer_info_id_(0), log_file_(nullptr) {
+    : settings_(settings),
+      thread_(nullptr),
+      timer_info_id_(0),
+      log_file_(nullptr),
+      children_batches_queue_depth_(0),
+      root_lockers_flusher_(),
+      is_worker_(false),
+      pending_requests_(0),
+      streaming_request_(false),
+      request_mutex_(),
+      current_initiator_(nullptr),
+      worker_database_(),
+      worker_selected_database_() {
   thread_ = new QThread(this);
   moveToThread(thread_);
 
@@ -165,8 +236,130 @@ void IDriver::Interrupt() {
   SetInterrupted(true);
 }
 
+void IDriver::Interrupt(QObject* initiator) {
+  std::unique_lock<std::mutex> lock(request_mutex_);
+  if (current_initiator_ && current_initiator_ == initiator) {
+    SetInterrupted(true);
+  }
+}
+
+size_t IDriver::GetChildrenBatchesQueueDepth() const {
+  return children_batches_queue_depth_;
+}
+
+size_t IDriver::ChildrenBatchPosted() {
+  return ++children_batches_queue_depth_;
+}
+
+void IDriver::ChildrenBatchDelivered() {
+  DCHECK(children_batches_queue_depth_ != 0);
+  --children_batches_queue_depth_;
+}
+
+RootLockersFlusher* IDriver::GetRootLockersFlusher() {
+  return &root_lockers_flusher_;
+}
+
+IDriver* IDriver::CreateWorker() const {
+  IDriver* worker = CreateWorkerImpl();
+  if (worker) {
+    worker->is_worker_ = true;
+  }
+  return worker;
+}
+
+bool IDriver::IsWorker() const {
+  return is_worker_;
+}
+
+void IDriver::SetWorkerDatabase(const std::string& name) {
+  DCHECK(is_worker_);
+  std::unique_lock<std::mutex> lock(request_mutex_);
+  worker_database_ = name;
+}
+
+void IDriver::ScheduleWorkerDisconnect() {
+  DCHECK(is_worker_);
+  VERIFY(QMetaObject::invokeMethod(this, "DisconnectWorker", Qt::QueuedConnection));
+}
+
+size_t IDriver::GetPendingRequestsCount() const {
+  return pending_requests_;
+}
+
+void IDriver::RequestPosted() {
+  ++pending_requests_;
+}
+
+bool IDriver::IsStreamingRequestRunning() const {
+  return streaming_request_;
+}
+
+IDriver* IDriver::CreateWorkerImpl() const {
+  return nullptr;
+}
+
+void IDriver::BeginRequest(QEvent* event) {
+  {
+    std::unique_lock<std::mutex> lock(request_mutex_);
+    current_initiator_ = GetCancellableRequestInitiator(event);
+    SetInterrupted(false);
+  }
+  streaming_request_ = IsStreamingRequest(event);
+
+  if (is_worker_) {
+    PrepareWorker();
+  }
+}
+
+void IDriver::FinishRequest() {
+  {
+    std::unique_lock<std::mutex> lock(request_mutex_);
+    current_initiator_ = nullptr;
+  }
+  streaming_request_ = false;
+
+  DCHECK(pending_requests_ != 0);
+  --pending_requests_;
+}
+
+void IDriver::PrepareWorker() {
+  if (!IsConnected()) {
+    worker_selected_database_.clear();
+    common::Error err = SyncConnect();
+    if (err) {  // request handler replies not connected error
+      return;
+    }
+  }
+
+  std::string database;
+  {
+    std::unique_lock<std::mutex> lock(request_mutex_);
+    database = worker_database_;
+  }
+
+  if (database.empty() || database == worker_selected_database_) {
+    return;
+  }
+
+  core::translator_t tran = GetTranslator();
+  core::command_buffer_t select_request;
+  common::Error err = tran->SelectDBCommand(database, &select_request);
+  if (err) {
+    return;
+  }
+
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(select_request, core::C_INNER);
+  err = Execute(cmd);
+  if (err) {
+    return;
+  }
+
+  worker_selected_database_ = database;
+}
+
 void IDriver::Init() {
-  if (settings_->IsHistoryEnabled()) {
+  if (settings_->IsHistoryEnabled() && !is_worker_) {
     int interval = settings_->GetLoggingMsTimeInterval();
     timer_info_id_ = startTimer(interval);
     DCHECK(timer_info_id_ != 0);
@@ -186,8 +379,16 @@ void IDriver::Clear() {
   ClearImpl();
 }
 
+void IDriver::DisconnectWorker() {
+  common::Error err = SyncDisconnect();
+  if (err) {
+    DNOTREACHED();
+  }
+  worker_selected_database_.clear();
+}
+
 void IDriver::customEvent(QEvent* event) {
-  SetInterrupted(false);
+  BeginRequest(event);
 
   QEvent::Type type = event->type();
   if (type == static_cast<QEvent::Type>(events::ConnectRequestEvent::EventType)) {
@@ -233,8 +434,17 @@ void IDriver::customEvent(QEvent* event) {
   } else if (type == static_cast<QEvent::Type>(events::DiscoveryInfoRequestEvent::EventType)) {
     events::DiscoveryInfoRequestEvent* ev = static_cast<events::DiscoveryInfoRequestEvent*>(event);
     HandleDiscoveryInfoEvent(ev);  //
+  } else if (type == static_cast<QEvent::Type>(events::CommandsStatsRequestEvent::EventType)) {
+    events::CommandsStatsRequestEvent* ev = static_cast<events::CommandsStatsRequestEvent*>(event);
+    HandleCommandsStatsEvent(ev);  //
+#ifdef BUILD_WITH_REDIS
+  } else if (type == static_cast<QEvent::Type>(events::CopyKeysRequestEvent::EventType)) {
+    events::CopyKeysRequestEvent* ev = static_cast<events::CopyKeysRequestEvent*>(event);
+    HandleCopyKeysEvent(ev);  // ni
+#endif
   }
 
+  FinishRequest();
   return QObject::customEvent(event);
 }
 
@@ -317,6 +527,15 @@ void IDriver::HandleExecuteEvent(events::ExecuteRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
   events::ExecuteResponceEvent::value_type res(ev->value());
+  if (res.silence || !res.script_path.empty()) {
+    common::Error err = ExecuteScript(sender, &res);
+    if (err) {
+      res.setErrorInfo(err);
+    }
+    Reply(sender, new events::ExecuteResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
 
   const core::command_buffer_t input_line = res.text;
   std::vector<core::command_buffer_t> commands;
@@ -373,6 +592,113 @@ done:
   delete lock;
 }
 
+common::Error IDriver::ExecuteScript(QObject* sender, events_info::ExecuteInfoResponce* res) {
+  core::ScriptReader* reader = nullptr;
+  if (res->script_path.empty()) {
+    reader = new core::ScriptReader(&res->text);
+  } else {
+    common::Error err = core::ScriptReader::OpenFile(res->script_path, &reader);
+    if (err) {
+      return err;
+    }
+  }
+  std::unique_ptr<core::ScriptReader> reader_holder(reader);
+
+  // progress by consumed bytes, the script is never split as a whole
+  const double total_bytes = static_cast<double>(reader->GetTotalBytes()) * static_cast<double>(res->repeat + 1);
+  std::vector<core::command_buffer_t> window;
+  window.reserve(kScriptWindowSize);
+  common::Error first_failure;
+  for (size_t r = 0; r < res->repeat + 1; ++r) {
+    if (r) {
+      common::Error err = reader->Rewind();
+      if (err) {
+        return err;
+      }
+    }
+
+    common::time64_t start_ts = common::time::current_mstime();
+    while (true) {
+      if (IsInterrupted()) {
+        return common::make_error(common::COMMON_EINTR);
+      }
+
+      window.clear();
+      core::command_buffer_t command;
+      while (window.size() < kScriptWindowSize && reader->ReadCommand(&command)) {
+        window.push_back(command);
+      }
+      if (window.empty()) {
+        break;
+      }
+
+      size_t failed = 0;
+      common::Error err = ExecuteSilent(window, res->logtype, &failed, &first_failure);
+      if (err) {
+        return err;
+      }
+
+      res->executed_commands += window.size();
+      res->failed_commands += failed;
+      if (total_bytes > 0) {
+        const double done = static_cast<double>(r) * static_cast<double>(reader->GetTotalBytes()) +
+                            static_cast<double>(reader->GetReadBytes());
+        NotifyProgress(sender, static_cast<int>(99.0 * done / total_bytes));
+      }
+    }
+
+    common::Error err = reader->GetReadError();
+    if (err) {
+      return err;
+    }
+
+    common::time64_t finished_ts = common::time::current_mstime();
+    common::time64_t diff = finished_ts - start_ts;
+    if (res->msec_repeat_interval > diff) {
+      common::time64_t sleep_time = res->msec_repeat_interval - diff;
+      common::threads::PlatformThread::Sleep(sleep_time);
+    }
+  }
+
+  if (res->failed_commands) {
+    std::string buff = common::MemSPrintf("%llu of %llu commands failed",
+                                          static_cast<unsigned long long>(res->failed_commands),
+                                          static_cast<unsigned long long>(res->executed_commands));
+    if (first_failure) {
+      buff += ", first error: " + first_failure->GetDescription();
+    }
+    return common::make_error(buff);
+  }
+
+  return common::Error();
+}
+
+common::Error IDriver::ExecuteSilent(const std::vector<core::command_buffer_t>& commands,
+                                     core::CmdLoggingType ct,
+                                     size_t* failed,
+                                     common::Error* first_failure) {
+  if (!failed || !first_failure) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  // commands are not logged one by one, a script may have millions of them
+  size_t lfailed = 0;
+  for (size_t i = 0; i < commands.size(); ++i) {
+    core::FastoObjectCommandIPtr cmd = CreateCommandFast(commands[i], ct);
+    common::Error err = ExecuteImpl(cmd->GetInputCommand(), cmd.get());
+    if (err) {
+      lfailed++;
+      if (!*first_failure) {
+        *first_failure = err;
+      }
+    }
+  }
+
+  *failed = lfailed;
+  return common::Error();
+}
+
 void IDriver::HandleLoadServerPropertyEvent(events::ServerPropertyInfoRequestEvent* ev) {
   ReplyNotImplementedYet<events::ServerPropertyInfoRequestEvent, events::ServerPropertyInfoResponceEvent>(
       this, ev, "server property");
@@ -396,6 +722,12 @@ void IDriver::HandleRestoreEvent(events::RestoreRequestEvent* ev) {
   ReplyNotImplementedYet<events::RestoreRequestEvent, events::RestoreResponceEvent>(this, ev, "export server");
 }
 
+#ifdef BUILD_WITH_REDIS
+void IDriver::HandleCopyKeysEvent(events::CopyKeysRequestEvent* ev) {
+  ReplyNotImplementedYet<events::CopyKeysRequestEvent, events::CopyKeysResponceEvent>(this, ev, "copy keys");
+}
+#endif
+
 void IDriver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
@@ -506,6 +838,29 @@ void IDriver::HandleClearServerHistoryEvent(events::ClearServerHistoryRequestEve
   Reply(sender, new events::ClearServerHistoryResponceEvent(this, res));
 }
 
+void IDriver::HandleCommandsStatsEvent(events::CommandsStatsRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  events::CommandsStatsResponceEvent::value_type res(ev->value());
+  res.stats = GetCommandsStats();
+  if (res.reset) {
+    ResetCommandsStats();
+  }
+
+  if (!res.export_path.empty()) {
+    common::file_system::ascii_string_path p(res.export_path);
+    common::file_system::ANSIFile export_file(p);
+    common::ErrnoError err = export_file.Open("wb");
+    if (err) {
+      res.setErrorInfo(common::make_error(common::MemSPrintf("Can't open file: %s", res.export_path)));
+    } else {
+      export_file.Write(common::ConvertToString(res.stats));
+      export_file.Close();
+    }
+  }
+
+  Reply(sender, new events::CommandsStatsResponceEvent(this, res));
+}
+
 void IDriver::HandleDiscoveryInfoEvent(events::DiscoveryInfoRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
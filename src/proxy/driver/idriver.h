@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include <QObject>
 
 #include "core/icommand_translator.h"             // for translator_t
@@ -25,6 +28,7 @@
 #include "core/module_info.h"
 
 #include "proxy/connection_settings/iconnection_settings.h"  // for IConnectionSettingsBaseSPtr
+#include "proxy/driver/root_locker.h"                        // for RootLockersFlusher
 #include "proxy/events/events.h"                             // for BackupRequestEvent, ChangeMa...
 
 class QEvent;
@@ -56,11 +60,14 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   std::string GetNsSeparator() const;
 
   virtual core::translator_t GetTranslator() const = 0;
+  virtual core::CommandsStatsSnapShoot GetCommandsStats() const = 0;
+  virtual void ResetCommandsStats() = 0;
 
   void Start();
   void Stop();
 
-  void Interrupt();
+  void Interrupt();                    // current request
+  void Interrupt(QObject* initiator);  // current request if it was started by initiator
 
   virtual bool IsInterrupted() const = 0;
   virtual void SetInterrupted(bool interrupted) = 0;
@@ -68,9 +75,26 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   virtual bool IsConnected() const = 0;
   virtual bool IsAuthenticated() const = 0;
 
+  // children batches event-queue depth, posted by RootLocker and not yet handled by receiver
+  size_t GetChildrenBatchesQueueDepth() const;
+  size_t ChildrenBatchPosted();  // returns new depth
+  void ChildrenBatchDelivered();
+  RootLockersFlusher* GetRootLockersFlusher();
+
+  // worker is a driver with own thread and connection for bulk requests,
+  // nullptr if database not allows more than one connection
+  IDriver* CreateWorker() const;
+  bool IsWorker() const;
+  void SetWorkerDatabase(const std::string& name);  // selected before next request
+  void ScheduleWorkerDisconnect();
+
+  // requests posted but not yet handled
+  size_t GetPendingRequestsCount() const;
+  void RequestPosted();
+  // monitor or subscribe is in progress, it holds connection until interrupted
+  bool IsStreamingRequestRunning() const;
+
  Q_SIGNALS:
-  void ChildAdded(core::FastoObjectIPtr child);
-  void ItemUpdated(core::FastoObject* item, common::ValueSPtr val);
   void ServerInfoSnapShooted(core::ServerInfoSnapShoot shot);
 
   void DBRemoved(core::IDataBaseInfoSPtr db);
@@ -91,6 +115,7 @@ class IDriver : public QObject, public core::CDBConnectionClient {
  private Q_SLOTS:
   void Init();
   void Clear();
+  void DisconnectWorker();
 
  protected:
   virtual void customEvent(QEvent* event) override;
@@ -115,6 +140,9 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   virtual void HandleBackupEvent(events::BackupRequestEvent* ev);
   virtual void HandleRestoreEvent(events::RestoreRequestEvent* ev);
   virtual void HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev);
+#ifdef BUILD_WITH_REDIS
+  virtual void HandleCopyKeysEvent(events::CopyKeysRequestEvent* ev);
+#endif
 
   template <typename T>
   inline std::shared_ptr<T> GetSpecificSettings() const {
@@ -122,6 +150,11 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   }
 
   common::Error Execute(core::FastoObjectCommandIPtr cmd) WARN_UNUSED_RESULT;
+  // silent script window: results are not kept, only failures counted, the first one stored in first_failure
+  virtual common::Error ExecuteSilent(const std::vector<core::command_buffer_t>& commands,
+                                      core::CmdLoggingType ct,
+                                      size_t* failed,
+                                      common::Error* first_failure) WARN_UNUSED_RESULT;
   virtual core::FastoObjectCommandIPtr CreateCommand(core::FastoObject* parent,
                                                      const core::command_buffer_t& input,
                                                      core::CmdLoggingType ct) = 0;
@@ -132,10 +165,19 @@ class IDriver : public QObject, public core::CDBConnectionClient {
  private:
   virtual common::Error SyncConnect() WARN_UNUSED_RESULT = 0;
   virtual common::Error SyncDisconnect() WARN_UNUSED_RESULT = 0;
+  virtual IDriver* CreateWorkerImpl() const;
+
+  void BeginRequest(QEvent* event);
+  void FinishRequest();
+  void PrepareWorker();
+
+  common::Error ExecuteScript(QObject* sender, events_info::ExecuteInfoResponce* res) WARN_UNUSED_RESULT;
+
   void HandleLoadServerInfoEvent(events::ServerInfoRequestEvent* ev);  // call ServerInfo
   void HandleLoadServerInfoHistoryEvent(events::ServerInfoHistoryRequestEvent* ev);
   void HandleDiscoveryInfoEvent(events::DiscoveryInfoRequestEvent* ev);
   void HandleClearServerHistoryEvent(events::ClearServerHistoryRequestEvent* ev);
+  void HandleCommandsStatsEvent(events::CommandsStatsRequestEvent* ev);
 
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) = 0;
 
@@ -174,6 +216,16 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   QThread* thread_;
   int timer_info_id_;
   common::file_system::ANSIFile* log_file_;
+  std::atomic<size_t> children_batches_queue_depth_;
+  RootLockersFlusher root_lockers_flusher_;
+
+  bool is_worker_;
+  std::atomic<size_t> pending_requests_;
+  std::atomic<bool> streaming_request_;
+  std::mutex request_mutex_;    // guards current_initiator_ and worker_database_
+  QObject* current_initiator_;  // of cancellable request in progress
+  std::string worker_database_;
+  std::string worker_selected_database_;  // used only from driver thread
 };
 
 }  // namespace proxy
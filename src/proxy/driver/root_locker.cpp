@@ -18,6 +18,9 @@
 
 #include "proxy/driver/root_locker.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include <QObject>
 
 #include <common/time.h>  // for current_mstime
@@ -27,13 +30,71 @@
 
 namespace fastonosql {
 namespace proxy {
+namespace {
+const size_t kMaxBatchSize = 512;
+const common::time64_t kMaxBatchMsec = 50;
+const size_t kMaxQueueDepth = 4;  // if gui not keep up, batches grow up to kMaxBatchSize
+}  // namespace
+
+RootLockersFlusher::RootLockersFlusher() : lockers_(), mutex_(), cond_(), stop_(false), thread_() {}
+
+RootLockersFlusher::~RootLockersFlusher() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_ = true;
+    cond_.notify_all();
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void RootLockersFlusher::Register(RootLocker* locker) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  lockers_.push_back(locker);
+  if (!thread_.joinable()) {
+    thread_ = std::thread(&RootLockersFlusher::FlushLoop, this);
+  }
+  cond_.notify_all();
+}
+
+void RootLockersFlusher::UnRegister(RootLocker* locker) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = std::find(lockers_.begin(), lockers_.end(), locker);
+  if (it != lockers_.end()) {
+    lockers_.erase(it);
+  }
+}
+
+void RootLockersFlusher::FlushLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    if (lockers_.empty()) {  // sleeps until next request
+      cond_.wait(lock);
+      continue;
+    }
+
+    cond_.wait_for(lock, std::chrono::milliseconds(kMaxBatchMsec));
+    if (stop_) {
+      break;
+    }
+    for (RootLocker* locker : lockers_) {
+      locker->FlushStale();
+    }
+  }
+}
 
 RootLocker::RootLocker(IDriver* parent, QObject* receiver, const core::command_buffer_t& text, bool silence)
     : core::FastoObject::IFastoObjectObserver(),
       parent_(parent),
       receiver_(receiver),
       tstart_(common::time::current_mstime()),
-      silence_(silence) {
+      silence_(silence),
+      pending_childs_(),
+      pending_updates_(),
+      pending_updates_index_(),
+      last_flush_ts_(tstart_),
+      mutex_() {
   CHECK(parent_);
 
   root_ = core::FastoObject::CreateRoot(text, this);
@@ -41,9 +102,14 @@ RootLocker::RootLocker(IDriver* parent, QObject* receiver, const core::command_b
     events::CommandRootCreatedEvent::value_type res(parent_, root_);
     IDriver::Reply(receiver_, new events::CommandRootCreatedEvent(parent_, res));
   }
+  parent_->GetRootLockersFlusher()->Register(this);
 }
 
 RootLocker::~RootLocker() {
+  parent_->GetRootLockersFlusher()->UnRegister(this);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  Flush();
   if (!silence_) {
     events::CommandRootCompleatedEvent::value_type res(parent_, tstart_, root_);
     IDriver::Reply(receiver_, new events::CommandRootCompleatedEvent(parent_, res));
@@ -55,11 +121,61 @@ core::FastoObjectIPtr RootLocker::Root() const {
 }
 
 void RootLocker::ChildrenAdded(core::FastoObjectIPtr child) {
-  emit parent_->ChildAdded(child);
+  std::unique_lock<std::mutex> lock(mutex_);
+  pending_childs_.push_back(child);
+  FlushIfNeeded();
 }
 
 void RootLocker::Updated(core::FastoObject* item, core::FastoObject::value_t val) {
-  emit parent_->ItemUpdated(item, val);
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = pending_updates_index_.find(item);
+  if (it != pending_updates_index_.end()) {  // coalesce, only last value matters
+    pending_updates_[it->second].second = val;
+  } else {
+    pending_updates_index_[item] = pending_updates_.size();
+    pending_updates_.push_back(std::make_pair(item, val));
+  }
+  FlushIfNeeded();
+}
+
+void RootLocker::FlushIfNeeded() {
+  const size_t pending = pending_childs_.size() + pending_updates_.size();
+  if (pending >= kMaxBatchSize) {
+    Flush();
+    return;
+  }
+
+  FlushIfStale();
+}
+
+void RootLocker::FlushIfStale() {
+  common::time64_t cur_ts = common::time::current_mstime();
+  if (cur_ts - last_flush_ts_ >= kMaxBatchMsec && parent_->GetChildrenBatchesQueueDepth() < kMaxQueueDepth) {
+    Flush();
+  }
+}
+
+void RootLocker::FlushStale() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  FlushIfStale();
+}
+
+void RootLocker::Flush() {
+  if (pending_childs_.empty() && pending_updates_.empty()) {
+    return;  // first child after idle period goes out at once
+  }
+
+  last_flush_ts_ = common::time::current_mstime();
+
+  if (!silence_) {
+    size_t depth = parent_->ChildrenBatchPosted();
+    events::CommandRootChildrenAddedEvent::value_type res(parent_, root_, pending_childs_, pending_updates_, depth);
+    IDriver::Reply(receiver_, new events::CommandRootChildrenAddedEvent(parent_, res));
+  }
+
+  pending_childs_.clear();
+  pending_updates_.clear();
+  pending_updates_index_.clear();
 }
 
 }  // namespace proxy
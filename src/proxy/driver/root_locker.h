@@ -18,7 +18,13 @@
 
 #pragma once
 
-#include "core/global.h"  // for FastoObjectIPtr, etc
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "proxy/events/events_info.h"  // for CommandRootChildrenAddedInfo
 
 class QObject;
 
@@ -26,7 +32,34 @@ namespace fastonosql {
 namespace proxy {
 class IDriver;
 
+class RootLocker;
+
+// one thread per driver flushes tail of batches of its root lockers,
+// driver thread event loop does not run while command executes, so QTimer would not fire there
+class RootLockersFlusher {
+ public:
+  RootLockersFlusher();
+  ~RootLockersFlusher();
+
+  void Register(RootLocker* locker);    // thread is started on first use
+  void UnRegister(RootLocker* locker);  // locker is not touched after return
+
+ private:
+  void FlushLoop();
+
+  std::vector<RootLocker*> lockers_;
+  std::mutex mutex_;  // guards lockers_, held while lockers are flushed
+  std::condition_variable cond_;
+  bool stop_;
+  std::thread thread_;
+};
+
+// collects children and updates of root and delivers them to receiver in batches,
+// batch flushed when it reaches size budget, time budget or on destruction,
+// flusher of driver sends tail of batch while driver thread is blocked in command
 class RootLocker : core::FastoObject::IFastoObjectObserver {
+  friend class RootLockersFlusher;
+
  public:
   RootLocker(IDriver* parent, QObject* receiver, const core::command_buffer_t& text, bool silence);
   virtual ~RootLocker();
@@ -39,11 +72,23 @@ class RootLocker : core::FastoObject::IFastoObjectObserver {
   virtual void Updated(core::FastoObject* item, core::FastoObject::value_t val) override;
 
  private:
+  void FlushIfNeeded();
+  void FlushIfStale();
+  void FlushStale();  // takes lock
+  void Flush();       // under lock
+
   core::FastoObjectIPtr root_;
   IDriver* parent_;
   QObject* receiver_;
   const common::time64_t tstart_;
   const bool silence_;
+
+  events_info::CommandRootChildrenAddedInfo::childs_t pending_childs_;
+  events_info::CommandRootChildrenAddedInfo::updates_t pending_updates_;
+  std::unordered_map<core::FastoObject*, size_t> pending_updates_index_;
+  common::time64_t last_flush_ts_;
+
+  std::mutex mutex_;  // guards pending batch, taken by driver and flusher threads
 };
 
 }  // namespace proxy
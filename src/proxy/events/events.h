@@ -74,6 +74,16 @@ typedef common::qt::Event<events_info::LoadDatabaseContentResponce, QEvent::User
 typedef common::qt::Event<events_info::DiscoveryInfoRequest, QEvent::User + 31> DiscoveryInfoRequestEvent;
 typedef common::qt::Event<events_info::DiscoveryInfoResponce, QEvent::User + 32> DiscoveryInfoResponceEvent;
 
+typedef common::qt::Event<events_info::CommandRootChildrenAddedInfo, QEvent::User + 33> CommandRootChildrenAddedEvent;
+
+typedef common::qt::Event<events_info::CommandsStatsInfoRequest, QEvent::User + 34> CommandsStatsRequestEvent;
+typedef common::qt::Event<events_info::CommandsStatsInfoResponce, QEvent::User + 35> CommandsStatsResponceEvent;
+
+#ifdef BUILD_WITH_REDIS
+typedef common::qt::Event<events_info::CopyKeysInfoRequest, QEvent::User + 36> CopyKeysRequestEvent;
+typedef common::qt::Event<events_info::CopyKeysInfoResponce, QEvent::User + 37> CopyKeysResponceEvent;
+#endif
+
 typedef common::qt::Event<events_info::ProgressInfoResponce, QEvent::User + 100> ProgressResponceEvent;
 
 }  // namespace events
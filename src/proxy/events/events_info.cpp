@@ -52,6 +52,24 @@ DiscoveryInfoRequest::DiscoveryInfoRequest(initiator_type sender, error_type er)
 
 DiscoveryInfoResponce::DiscoveryInfoResponce(const base_class& request) : base_class(request) {}
 
+CommandsStatsInfoRequest::CommandsStatsInfoRequest(initiator_type sender,
+                                                   bool reset,
+                                                   const std::string& export_path,
+                                                   error_type er)
+    : base_class(sender, er), reset(reset), export_path(export_path) {}
+
+CommandsStatsInfoResponce::CommandsStatsInfoResponce(const base_class& request) : base_class(request), stats() {}
+
+#ifdef BUILD_WITH_REDIS
+CopyKeysInfoRequest::CopyKeysInfoRequest(initiator_type sender,
+                                         const core::redis::RConfig& destination,
+                                         const core::redis::CopyKeysConfig& cconfig,
+                                         error_type er)
+    : base_class(sender, er), destination(destination), cconfig(cconfig) {}
+
+CopyKeysInfoResponce::CopyKeysInfoResponce(const base_class& request) : base_class(request), report() {}
+#endif
+
 EnterModeInfo::EnterModeInfo(initiator_type sender, core::ConnectionMode mode, error_type er)
     : base_class(sender, er), mode(mode) {}
 
@@ -70,6 +88,14 @@ CommandRootCompleatedInfo::CommandRootCompleatedInfo(initiator_type sender,
                                                      error_type er)
     : base_class(sender, timest, er), root(root) {}
 
+CommandRootChildrenAddedInfo::CommandRootChildrenAddedInfo(initiator_type sender,
+                                                           core::FastoObjectIPtr root,
+                                                           const childs_t& childs,
+                                                           const updates_t& updates,
+                                                           size_t queue_depth,
+                                                           error_type er)
+    : base_class(sender, er), root(root), childs(childs), updates(updates), queue_depth(queue_depth) {}
+
 DisConnectInfoRequest::DisConnectInfoRequest(initiator_type sender, error_type er) : base_class(sender, er) {}
 
 DisConnectInfoResponce::DisConnectInfoResponce(const base_class& request) : base_class(request) {}
@@ -81,6 +107,7 @@ ExecuteInfoRequest::ExecuteInfoRequest(initiator_type sender,
                                        bool history,
                                        bool silence,
                                        core::CmdLoggingType logtype,
+                                       const std::string& script_path,
                                        error_type er)
     : base_class(sender, er),
       text(text),
@@ -88,9 +115,11 @@ ExecuteInfoRequest::ExecuteInfoRequest(initiator_type sender,
       msec_repeat_interval(msec_repeat_interval),
       history(history),
       silence(silence),
-      logtype(logtype) {}
+      logtype(logtype),
+      script_path(script_path) {}
 
-ExecuteInfoResponce::ExecuteInfoResponce(const base_class& request) : base_class(request) {}
+ExecuteInfoResponce::ExecuteInfoResponce(const base_class& request)
+    : base_class(request), executed_commands(0), failed_commands(0) {}
 
 LoadDatabasesInfoRequest::LoadDatabasesInfoRequest(initiator_type sender, error_type er) : base_class(sender, er) {}
 
@@ -21,6 +21,7 @@
 #include <common/qt/utils_qt.h>  // for EventInfo
 
 #include "core/command_holder.h"
+#include "core/commands_stats.h"
 #include "core/database/idatabase_info.h"
 #include "core/db_key.h"  // for NDbKValue
 #include "core/db_ps_channel.h"
@@ -30,6 +31,10 @@
 
 #include "core/global.h"  // for FastoObjectIPtr
 
+#ifdef BUILD_WITH_REDIS
+#include "core/db/redis/db_connection.h"  // for RConfig, CopyKeysConfig
+#endif
+
 namespace fastonosql {
 namespace proxy {
 namespace events_info {
@@ -92,6 +97,44 @@ struct DiscoveryInfoResponce : DiscoveryInfoRequest {
   std::vector<core::ModuleInfo> loaded_modules;
 };
 
+struct CommandsStatsInfoRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  CommandsStatsInfoRequest(initiator_type sender,
+                           bool reset = false,
+                           const std::string& export_path = std::string(),
+                           error_type er = error_type());
+
+  bool reset;               // reset counters after snapshot
+  std::string export_path;  // if not empty snapshot saved in json format
+};
+
+struct CommandsStatsInfoResponce : CommandsStatsInfoRequest {
+  typedef CommandsStatsInfoRequest base_class;
+  explicit CommandsStatsInfoResponce(const base_class& request);
+
+  core::CommandsStatsSnapShoot stats;
+};
+
+#ifdef BUILD_WITH_REDIS
+struct CopyKeysInfoRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  CopyKeysInfoRequest(initiator_type sender,
+                      const core::redis::RConfig& destination,
+                      const core::redis::CopyKeysConfig& cconfig,
+                      error_type er = error_type());
+
+  core::redis::RConfig destination;  // with auth and tunnel settings, never turned into command text
+  core::redis::CopyKeysConfig cconfig;
+};
+
+struct CopyKeysInfoResponce : CopyKeysInfoRequest {
+  typedef CopyKeysInfoRequest base_class;
+  explicit CopyKeysInfoResponce(const base_class& request);
+
+  core::redis::CopyKeysReport report;
+};
+#endif
+
 struct EnterModeInfo : public EventInfoBase {
   typedef EventInfoBase base_class;
   EnterModeInfo(initiator_type sender, core::ConnectionMode mode, error_type er = error_type());
@@ -122,6 +165,23 @@ struct CommandRootCompleatedInfo : public EventInfoBase {
   core::FastoObjectIPtr root;
 };
 
+struct CommandRootChildrenAddedInfo : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  typedef std::vector<core::FastoObjectIPtr> childs_t;
+  typedef std::vector<std::pair<core::FastoObject*, core::FastoObject::value_t>> updates_t;
+  CommandRootChildrenAddedInfo(initiator_type sender,
+                               core::FastoObjectIPtr root,
+                               const childs_t& childs,
+                               const updates_t& updates,
+                               size_t queue_depth,
+                               error_type er = error_type());
+
+  core::FastoObjectIPtr root;
+  childs_t childs;     // in order of adding
+  updates_t updates;   // last value per item, apply after childs
+  size_t queue_depth;  // batches posted but not yet delivered at the moment of posting
+};
+
 struct DisConnectInfoRequest : public EventInfoBase {
   typedef EventInfoBase base_class;
   explicit DisConnectInfoRequest(initiator_type sender, error_type er = error_type());
@@ -141,6 +201,7 @@ struct ExecuteInfoRequest : public EventInfoBase {
                      bool history = true,
                      bool silence = false,
                      core::CmdLoggingType logtype = core::C_USER,
+                     const std::string& script_path = std::string(),
                      error_type er = error_type());
 
   const core::command_buffer_t text;
@@ -149,11 +210,16 @@ struct ExecuteInfoRequest : public EventInfoBase {
   const bool history;
   const bool silence;
   const core::CmdLoggingType logtype;
+  const std::string script_path;  // commands are read from the file instead of text
 };
 
 struct ExecuteInfoResponce : ExecuteInfoRequest {
   typedef ExecuteInfoRequest base_class;
   explicit ExecuteInfoResponce(const base_class& request);
+
+  // silent executions keep only counters
+  uint64_t executed_commands;
+  uint64_t failed_commands;
 };
 
 struct LoadDatabasesInfoRequest : public EventInfoBase {
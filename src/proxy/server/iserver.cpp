@@ -20,16 +20,58 @@
 
 #include <QApplication>
 
-#include <common/qt/logger.h>  // for LOG_ERROR
+#include <common/macros.h>     // for SIZEOFMASS
+#include <common/qt/logger.h>  // for LOG_ERROR, LOG_MSG
+#include <common/string_util.h>
+
+#include "core/script_reader.h"
 
 #include "proxy/driver/idriver.h"  // for IDriver
 
 namespace fastonosql {
 namespace proxy {
+namespace {
+
+const size_t kMaxWorkersCount = 2;
+
+// long read only commands which finish by themselves, can run on worker connection,
+// monitor and subscribe never finish so they stay on main connection and don't hold workers
+const char* const kBulkCommands[] = {DB_KEYS_COMMAND, DB_SCAN_COMMAND, DB_DBKCOUNT_COMMAND, "BENCHMARK", "MEMKEYS"};
+
+bool IsBulkCommand(const core::command_buffer_t& command) {
+  const core::command_buffer_t name = common::StringToUpperASCII(command.substr(0, command.find_first_of(" \t")));
+  for (size_t i = 0; i < SIZEOFMASS(kBulkCommands); ++i) {
+    if (name == kBulkCommands[i]) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool IsBulkRequest(const events_info::ExecuteInfoRequest& req) {
+  if (!req.script_path.empty()) {  // scripts may change connection state
+    return false;
+  }
 
-IServer::IServer(IDriver* drv) : drv_(drv), server_info_(), current_database_info_(), timer_check_key_exists_id_(0) {
-  VERIFY(QObject::connect(drv_, &IDriver::ChildAdded, this, &IServer::ChildAdded));
-  VERIFY(QObject::connect(drv_, &IDriver::ItemUpdated, this, &IServer::ItemUpdated));
+  // stops on the first not bulk command, huge scripts are not split on the gui thread
+  core::ScriptReader reader(&req.text);
+  core::command_buffer_t command;
+  bool has_commands = false;
+  while (reader.ReadCommand(&command)) {
+    if (!IsBulkCommand(command)) {
+      return false;
+    }
+    has_commands = true;
+  }
+
+  return has_commands;
+}
+
+}  // namespace
+
+IServer::IServer(IDriver* drv)
+    : drv_(drv), workers_(), server_info_(), current_database_info_(), timer_check_key_exists_id_(0) {
   VERIFY(QObject::connect(drv_, &IDriver::ServerInfoSnapShooted, this, &IServer::ServerInfoSnapShooted));
 
   VERIFY(QObject::connect(drv_, &IDriver::DBCreated, this, &IServer::CreateDatabase));
@@ -52,6 +94,10 @@ IServer::IServer(IDriver* drv) : drv_(drv), server_info_(), current_database_inf
 
 IServer::~IServer() {
   StopCurrentEvent();
+  for (IDriver* worker : workers_) {
+    worker->Stop();
+    delete worker;
+  }
   drv_->Stop();
   delete drv_;
 }
@@ -70,6 +116,16 @@ void IServer::StopCheckKeyExistTimer() {
 
 void IServer::StopCurrentEvent() {
   drv_->Interrupt();
+  for (IDriver* worker : workers_) {
+    worker->Interrupt();
+  }
+}
+
+void IServer::StopEvent(QObject* initiator) {
+  drv_->Interrupt(initiator);
+  for (IDriver* worker : workers_) {
+    worker->Interrupt(initiator);
+  }
 }
 
 bool IServer::IsConnected() const {
@@ -88,6 +144,18 @@ bool IServer::IsCanCreateDatabase() const {
   return fastonosql::core::IsCanCreateDatabase(GetType());
 }
 
+bool IServer::IsLiveModeSupported() const {
+  return false;
+}
+
+bool IServer::IsLiveMode() const {
+  return false;
+}
+
+void IServer::SetLiveMode(bool live) {
+  UNUSED(live);
+}
+
 core::translator_t IServer::GetTranslator() const {
   return drv_->GetTranslator();
 }
@@ -153,6 +221,7 @@ void IServer::Connect(const events_info::ConnectInfoRequest& req) {
 
 void IServer::Disconnect(const events_info::DisConnectInfoRequest& req) {
   StopCurrentEvent();
+  StopWorkers();
   emit DisconnectStarted(req);
   QEvent* ev = new events::DisconnectRequestEvent(this, req);
   NotifyStartEvent(ev);
@@ -173,19 +242,19 @@ void IServer::LoadDatabaseContent(const events_info::LoadDatabaseContentRequest&
 void IServer::Execute(const events_info::ExecuteInfoRequest& req) {
   emit ExecuteStarted(req);
   QEvent* ev = new events::ExecuteRequestEvent(this, req);
-  NotifyStartEvent(ev);
+  NotifyStartEvent(ev, IsBulkRequest(req));
 }
 
 void IServer::BackupToPath(const events_info::BackupInfoRequest& req) {
   emit BackupStarted(req);
   QEvent* ev = new events::BackupRequestEvent(this, req);
-  NotifyStartEvent(ev);
+  NotifyStartEvent(ev, true);
 }
 
 void IServer::RestoreFromPath(const events_info::RestoreInfoRequest& req) {
   emit ExportStarted(req);
   QEvent* ev = new events::RestoreRequestEvent(this, req);
-  NotifyStartEvent(ev);
+  NotifyStartEvent(ev, true);
 }
 
 void IServer::LoadServerInfo(const events_info::ServerInfoRequest& req) {
@@ -224,6 +293,20 @@ void IServer::LoadChannels(const events_info::LoadServerChannelsRequest& req) {
   NotifyStartEvent(ev);
 }
 
+void IServer::LoadCommandsStats(const events_info::CommandsStatsInfoRequest& req) {
+  emit LoadCommandsStatsStarted(req);
+  QEvent* ev = new events::CommandsStatsRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+#ifdef BUILD_WITH_REDIS
+void IServer::CopyKeys(const events_info::CopyKeysInfoRequest& req) {
+  emit CopyKeysStarted(req);
+  QEvent* ev = new events::CopyKeysRequestEvent(this, req);
+  NotifyStartEvent(ev, true);
+}
+#endif
+
 void IServer::customEvent(QEvent* event) {
   QEvent::Type type = event->type();
   if (type == static_cast<QEvent::Type>(events::ConnectResponceEvent::EventType)) {
@@ -250,6 +333,12 @@ void IServer::customEvent(QEvent* event) {
     events::CommandRootCompleatedEvent* ev = static_cast<events::CommandRootCompleatedEvent*>(event);
     events::CommandRootCompleatedEvent::value_type v = ev->value();
     emit RootCompleated(v);
+  } else if (type == static_cast<QEvent::Type>(events::CommandRootChildrenAddedEvent::EventType)) {
+    events::CommandRootChildrenAddedEvent* ev = static_cast<events::CommandRootChildrenAddedEvent*>(event);
+    events::CommandRootChildrenAddedEvent::value_type v = ev->value();
+    IDriver* sender = static_cast<IDriver*>(ev->sender());  // control or worker driver
+    sender->ChildrenBatchDelivered();
+    emit RootChildrenAdded(v);
   } else if (type == static_cast<QEvent::Type>(events::DisconnectResponceEvent::EventType)) {
     events::DisconnectResponceEvent* ev = static_cast<events::DisconnectResponceEvent*>(event);
     HandleDisconnectEvent(ev);
@@ -265,6 +354,14 @@ void IServer::customEvent(QEvent* event) {
   } else if (type == static_cast<QEvent::Type>(events::ClearServerHistoryResponceEvent::EventType)) {
     events::ClearServerHistoryResponceEvent* ev = static_cast<events::ClearServerHistoryResponceEvent*>(event);
     HandleClearServerHistoryResponceEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::CommandsStatsResponceEvent::EventType)) {
+    events::CommandsStatsResponceEvent* ev = static_cast<events::CommandsStatsResponceEvent*>(event);
+    HandleCommandsStatsResponceEvent(ev);
+#ifdef BUILD_WITH_REDIS
+  } else if (type == static_cast<QEvent::Type>(events::CopyKeysResponceEvent::EventType)) {
+    events::CopyKeysResponceEvent* ev = static_cast<events::CopyKeysResponceEvent*>(event);
+    HandleCopyKeysResponceEvent(ev);
+#endif
   } else if (type == static_cast<QEvent::Type>(events::ServerPropertyInfoResponceEvent::EventType)) {
     events::ServerPropertyInfoResponceEvent* ev = static_cast<events::ServerPropertyInfoResponceEvent*>(event);
     HandleLoadServerPropertyEvent(ev);
@@ -307,10 +404,51 @@ void IServer::timerEvent(QTimerEvent* event) {
   QObject::timerEvent(event);
 }
 
-void IServer::NotifyStartEvent(QEvent* ev) {
+void IServer::NotifyStartEvent(QEvent* ev, bool bulk) {
   events_info::ProgressInfoResponce resp(0);
   emit ProgressChanged(resp);
-  qApp->postEvent(drv_, ev);
+  IDriver* drv = SelectDriver(bulk);
+  drv->RequestPosted();
+  qApp->postEvent(drv, ev, bulk ? Qt::LowEventPriority : Qt::NormalEventPriority);
+}
+
+IDriver* IServer::SelectDriver(bool bulk) {
+  if (!bulk || !drv_->IsConnected()) {
+    return drv_;
+  }
+
+  IDriver* selected = nullptr;
+  for (IDriver* worker : workers_) {
+    if (worker->IsStreamingRequestRunning()) {  // busy until user stops it
+      continue;
+    }
+    if (!selected || worker->GetPendingRequestsCount() < selected->GetPendingRequestsCount()) {
+      selected = worker;
+    }
+  }
+
+  if ((!selected || selected->GetPendingRequestsCount() != 0) && workers_.size() < kMaxWorkersCount) {
+    IDriver* worker = drv_->CreateWorker();
+    if (worker) {
+      worker->Start();
+      workers_.push_back(worker);
+      selected = worker;
+    }
+  }
+
+  if (!selected) {  // database allows only one connection or all workers are streaming
+    return drv_;
+  }
+
+  database_t cdb = GetCurrentDatabaseInfo();
+  selected->SetWorkerDatabase(cdb ? cdb->GetName() : std::string());
+  return selected;
+}
+
+void IServer::StopWorkers() {
+  for (IDriver* worker : workers_) {
+    worker->ScheduleWorkerDisconnect();
+  }
 }
 
 void IServer::HandleConnectEvent(events::ConnectResponceEvent* ev) {
@@ -668,6 +806,30 @@ void IServer::HandleClearServerHistoryResponceEvent(events::ClearServerHistoryRe
   emit ClearServerHistoryFinished(v);
 }
 
+void IServer::HandleCommandsStatsResponceEvent(events::CommandsStatsResponceEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+
+  emit LoadCommandsStatsFinished(v);
+}
+
+#ifdef BUILD_WITH_REDIS
+void IServer::HandleCopyKeysResponceEvent(events::CopyKeysResponceEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  } else {
+    LOG_MSG(common::ConvertToString(v.report), common::logging::LOG_LEVEL_INFO, true);
+  }
+
+  emit CopyKeysFinished(v);
+}
+#endif
+
 void IServer::ProcessDiscoveryInfo(const events_info::DiscoveryInfoRequest& req) {
   emit LoadDiscoveryInfoStarted(req);
   QEvent* ev = new events::DiscoveryInfoRequestEvent(this, req);
@@ -36,12 +36,18 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   virtual ~IServer();
 
   // sync methods
-  void StopCurrentEvent();
+  void StopCurrentEvent();              // all requests in progress
+  void StopEvent(QObject* initiator);  // requests in progress started by initiator
   bool IsConnected() const;
   bool IsCanRemote() const;
   bool IsSupportTTLKeys() const;
   bool IsCanCreateDatabase() const;
 
+  // changes made by other clients are applied to current database as they happen, without rescans
+  virtual bool IsLiveModeSupported() const;
+  virtual bool IsLiveMode() const;
+  virtual void SetLiveMode(bool live);
+
   core::translator_t GetTranslator() const;
 
   core::connectionTypes GetType() const;
@@ -99,6 +105,7 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
 
   void RootCreated(const events_info::CommandRootCreatedInfo& res);
   void RootCompleated(const events_info::CommandRootCompleatedInfo& res);
+  void RootChildrenAdded(const events_info::CommandRootChildrenAddedInfo& res);
 
   void LoadDataBaseContentStarted(const events_info::LoadDatabaseContentRequest& req);
   void LoadDatabaseContentFinished(const events_info::LoadDatabaseContentResponce& res);
@@ -106,9 +113,15 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   void LoadDiscoveryInfoStarted(const events_info::DiscoveryInfoRequest& res);
   void LoadDiscoveryInfoFinished(const events_info::DiscoveryInfoResponce& res);
 
+  void LoadCommandsStatsStarted(const events_info::CommandsStatsInfoRequest& req);
+  void LoadCommandsStatsFinished(const events_info::CommandsStatsInfoResponce& res);
+
+#ifdef BUILD_WITH_REDIS
+  void CopyKeysStarted(const events_info::CopyKeysInfoRequest& req);
+  void CopyKeysFinished(const events_info::CopyKeysInfoResponce& res);
+#endif
+
  Q_SIGNALS:
-  void ChildAdded(core::FastoObjectIPtr child);
-  void ItemUpdated(core::FastoObject* item, common::ValueSPtr val);
   void ServerInfoSnapShooted(core::ServerInfoSnapShoot shot);
 
   void DatabaseCreated(core::IDataBaseInfoSPtr db);
@@ -155,6 +168,12 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   void LoadChannels(const events_info::LoadServerChannelsRequest& req);  // signals: LoadServerChannelsStarted,
                                                                          // LoadServerChannelsFinished
 
+  void LoadCommandsStats(const events_info::CommandsStatsInfoRequest& req);  // signals: LoadCommandsStatsStarted,
+                                                                             // LoadCommandsStatsFinished
+#ifdef BUILD_WITH_REDIS
+  void CopyKeys(const events_info::CopyKeysInfoRequest& req);  // signals: CopyKeysStarted, CopyKeysFinished
+#endif
+
  protected:
   explicit IServer(IDriver* drv);  // take ownerships
 
@@ -165,7 +184,9 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   virtual void timerEvent(QTimerEvent* event) override;
 
   virtual IDatabaseSPtr CreateDatabase(core::IDataBaseInfoSPtr info) = 0;
-  void NotifyStartEvent(QEvent* ev);
+  // bulk requests goes to worker connections if database allows it,
+  // otherwise they have lower priority than interactive ones
+  void NotifyStartEvent(QEvent* ev, bool bulk = false);
 
   // handle server events
   virtual void HandleConnectEvent(events::ConnectResponceEvent* ev);
@@ -188,17 +209,19 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   IDriver* const drv_;
   databases_t databases_;
 
+ protected Q_SLOTS:
+  void RemoveKey(core::NKey key);
+  void AddKey(core::NDbKValue key);
+  void RenameKey(core::NKey key, core::string_key_t new_name);
+  void ChangeKeyTTL(core::NKey key, core::ttl_t ttl);
+
  private Q_SLOTS:
   void CreateDB(core::IDataBaseInfoSPtr db);
   void RemoveDatabase(core::IDataBaseInfoSPtr db);
   void FlushCurrentDatabase();
   void ChangeCurrentDatabase(core::IDataBaseInfoSPtr db);
 
-  void RemoveKey(core::NKey key);
-  void AddKey(core::NDbKValue key);
   void LoadKey(core::NDbKValue key);
-  void RenameKey(core::NKey key, core::string_key_t new_name);
-  void ChangeKeyTTL(core::NKey key, core::ttl_t ttl);
   void LoadKeyTTL(core::NKey key, core::ttl_t ttl);
   void LoadModule(core::ModuleInfo module);
   void UnLoadModule(core::ModuleInfo module);
@@ -212,9 +235,17 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   // handle info events
   void HandleLoadServerInfoHistoryEvent(events::ServerInfoHistoryResponceEvent* ev);
   void HandleClearServerHistoryResponceEvent(events::ClearServerHistoryResponceEvent* ev);
+  void HandleCommandsStatsResponceEvent(events::CommandsStatsResponceEvent* ev);
+#ifdef BUILD_WITH_REDIS
+  void HandleCopyKeysResponceEvent(events::CopyKeysResponceEvent* ev);
+#endif
 
   void ProcessDiscoveryInfo(const events_info::DiscoveryInfoRequest& req);
 
+  IDriver* SelectDriver(bool bulk);
+  void StopWorkers();
+
+  std::vector<IDriver*> workers_;  // created on demand
   core::IServerInfoSPtr server_info_;
   database_t current_database_info_;
   int timer_check_key_exists_id_;
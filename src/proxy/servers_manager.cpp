@@ -77,6 +77,12 @@
 #include "proxy/db/forestdb/server.h"               // for Server
 #endif
 
+#ifdef BUILD_WITH_RDB
+#include "core/db/rdb/db_connection.h"         // for TestConnection
+#include "proxy/db/rdb/connection_settings.h"  // for ConnectionSettings
+#include "proxy/db/rdb/server.h"               // for Server
+#endif
+
 namespace fastonosql {
 namespace proxy {
 
@@ -135,6 +141,11 @@ ServersManager::server_t ServersManager::CreateServer(IConnectionSettingsBaseSPt
     server = std::make_shared<forestdb::Server>(settings);
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (conT == core::RDB) {
+    server = std::make_shared<rdb::Server>(settings);
+  }
+#endif
 
   CHECK(server);
   servers_.push_back(server);
@@ -257,23 +268,44 @@ common::Error ServersManager::TestConnection(IConnectionSettingsBaseSPtr connect
     return fastonosql::core::forestdb::TestConnection(settings->GetInfo());
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    rdb::ConnectionSettings* settings = static_cast<rdb::ConnectionSettings*>(connection.get());
+    return fastonosql::core::rdb::TestConnection(settings->GetInfo());
+  }
+#endif
 
   NOTREACHED();
   return common::make_error("Invalid setting type");
 }
 
-common::Error ServersManager::DiscoveryClusterConnection(IConnectionSettingsBaseSPtr connection,
-                                                         std::vector<core::ServerDiscoveryClusterInfoSPtr>* inf) {
-  if (!connection || !inf) {
+common::Error ServersManager::DiscoveryClusterConnection(const std::vector<IConnectionSettingsBaseSPtr>& nodes,
+                                                         core::discovery_cluster_observer_t observer) {
+  if (nodes.empty() || !nodes[0] || !observer) {
     return common::make_error_inval();
   }
 
-  core::connectionTypes type = connection->GetType();
+  core::connectionTypes type = nodes[0]->GetType();
 #ifdef BUILD_WITH_REDIS
   if (type == core::REDIS) {
-    redis::ConnectionSettings* settings = static_cast<redis::ConnectionSettings*>(connection.get());
-    core::redis::RConfig rconfig(settings->GetInfo(), settings->GetSSHInfo());
-    return core::redis::DiscoveryClusterConnection(rconfig, inf);
+    std::vector<core::redis::RConfig> rconfigs;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      IConnectionSettingsBaseSPtr node = nodes[i];
+      if (!node || node->GetType() != core::REDIS) {
+        continue;
+      }
+
+      redis::ConnectionSettings* settings = static_cast<redis::ConnectionSettings*>(node.get());
+      core::redis::RConfig rconfig(settings->GetInfo(), settings->GetSSHInfo());
+      bool is_dup = false;
+      for (size_t j = 0; j < rconfigs.size() && !is_dup; ++j) {
+        is_dup = rconfigs[j].host == rconfig.host && rconfigs[j].hostsocket == rconfig.hostsocket;
+      }
+      if (!is_dup) {
+        rconfigs.push_back(rconfig);
+      }
+    }
+    return core::redis::DiscoveryClusterConnection(rconfigs, observer);
   }
 #endif
 #ifdef BUILD_WITH_MEMCACHED
@@ -316,14 +348,19 @@ common::Error ServersManager::DiscoveryClusterConnection(IConnectionSettingsBase
     return common::make_error("Not supported setting type");
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    return common::make_error("Not supported setting type");
+  }
+#endif
 
   NOTREACHED();
   return common::make_error("Invalid setting type");
 }
 
 common::Error ServersManager::DiscoverySentinelConnection(IConnectionSettingsBaseSPtr connection,
-                                                          std::vector<core::ServerDiscoverySentinelInfoSPtr>* inf) {
-  if (!connection || !inf) {
+                                                          core::discovery_sentinel_observer_t observer) {
+  if (!connection || !observer) {
     return common::make_error_inval();
   }
 
@@ -332,7 +369,7 @@ common::Error ServersManager::DiscoverySentinelConnection(IConnectionSettingsBas
   if (type == core::REDIS) {
     redis::ConnectionSettings* settings = static_cast<redis::ConnectionSettings*>(connection.get());
     core::redis::RConfig rconfig(settings->GetInfo(), settings->GetSSHInfo());
-    return core::redis::DiscoverySentinelConnection(rconfig, inf);
+    return core::redis::DiscoverySentinelConnection(rconfig, observer);
   }
 #endif
 #ifdef BUILD_WITH_MEMCACHED
@@ -375,6 +412,11 @@ common::Error ServersManager::DiscoverySentinelConnection(IConnectionSettingsBas
     return common::make_error("Not supported setting type");
   }
 #endif
+#ifdef BUILD_WITH_RDB
+  if (type == core::RDB) {
+    return common::make_error("Not supported setting type");
+  }
+#endif
 
   NOTREACHED();
   return common::make_error("Invalid setting type");
@@ -46,10 +46,11 @@ class ServersManager : public common::patterns::LazySingleton<ServersManager> {
   cluster_t CreateCluster(IClusterSettingsBaseSPtr settings);
 
   common::Error TestConnection(IConnectionSettingsBaseSPtr connection) WARN_UNUSED_RESULT;
-  common::Error DiscoveryClusterConnection(IConnectionSettingsBaseSPtr connection,
-                                           std::vector<core::ServerDiscoveryClusterInfoSPtr>* inf) WARN_UNUSED_RESULT;
+  // found servers are passed to observer from worker threads as they arrive, nodes are asked concurrently
+  common::Error DiscoveryClusterConnection(const std::vector<IConnectionSettingsBaseSPtr>& nodes,
+                                           core::discovery_cluster_observer_t observer) WARN_UNUSED_RESULT;
   common::Error DiscoverySentinelConnection(IConnectionSettingsBaseSPtr connection,
-                                            std::vector<core::ServerDiscoverySentinelInfoSPtr>* inf) WARN_UNUSED_RESULT;
+                                            core::discovery_sentinel_observer_t observer) WARN_UNUSED_RESULT;
 
   void Clear();
 
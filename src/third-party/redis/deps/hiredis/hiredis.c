@@ -50,17 +50,28 @@ static void init_openssl_library(void) {
   /* ERR_load_crypto_strings(); */
   OPENSSL_config(NULL);
 }
+#include <pthread.h>
+#include <time.h>
 #ifdef OS_WIN
 #define F_EINTR 0
 #else
+#include <sys/select.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <netdb.h>
 #include <arpa/inet.h>
+#include <sys/uio.h>
 #define F_EINTR EINTR
 #endif
 #endif
 
+#ifdef FASTO
+static void __redisSshChannelFree(redisContext *c);
+static void __redisSshSessionRelease(redisSshSession *s);
+static int __redisSshSessionRenew(redisContext *c);
+static int __redisSshIsBroken(redisSshSession *s);
+#endif
+
 static redisReply *createReplyObject(int type);
 static void *createStringObject(const redisReadTask *task, char *str, size_t len);
 static void *createArrayObject(const redisReadTask *task, int elements);
@@ -607,6 +618,82 @@ redisReader *redisReaderCreate(void) {
     return redisReaderCreateWithFunctions(&defaultFunctions);
 }
 
+#ifdef FASTO
+static void __redisFreeChunks(redisContext *c) {
+    int j;
+
+    for (j = 0; j < c->wcount; j++)
+        sdsfree(c->wchunks[j]);
+    free(c->wchunks);
+    c->wchunks = NULL;
+    c->wcount = 0;
+    c->wcapacity = 0;
+    c->wpos = 0;
+}
+
+static int __redisQueueChunk(redisContext *c, sds chunk) {
+    if (c->wcount == c->wcapacity) {
+        int capacity = c->wcapacity ? c->wcapacity * 2 : 16;
+        sds *chunks = realloc(c->wchunks, sizeof(sds) * capacity);
+        if (chunks == NULL) {
+            __redisSetError(c,REDIS_ERR_OOM,"Out of memory");
+            return REDIS_ERR;
+        }
+        c->wchunks = chunks;
+        c->wcapacity = capacity;
+    }
+
+    c->wchunks[c->wcount++] = chunk;
+    return REDIS_OK;
+}
+
+/* Move pending obuf bytes behind the queued chunks, keeps commands order. */
+static int __redisQueueOutputBuffer(redisContext *c) {
+    sds empty;
+
+    if (sdslen(c->obuf) == 0)
+        return REDIS_OK;
+
+    empty = sdsempty();
+    if (empty == NULL) {
+        __redisSetError(c,REDIS_ERR_OOM,"Out of memory");
+        return REDIS_ERR;
+    }
+
+    if (__redisQueueChunk(c,c->obuf) != REDIS_OK) {
+        sdsfree(empty);
+        return REDIS_ERR;
+    }
+
+    c->obuf = empty;
+    return REDIS_OK;
+}
+
+/* Drop written bytes from the head of the queue, partially written chunk
+ * is kept with an offset instead of being trimmed. */
+static void __redisConsumeChunks(redisContext *c, size_t nwritten) {
+    int done = 0;
+
+    while (nwritten > 0 && done < c->wcount) {
+        size_t left = sdslen(c->wchunks[done]) - c->wpos;
+        if (nwritten < left) {
+            c->wpos += nwritten;
+            break;
+        }
+
+        nwritten -= left;
+        sdsfree(c->wchunks[done]);
+        c->wpos = 0;
+        done++;
+    }
+
+    if (done > 0) {
+        memmove(c->wchunks, c->wchunks + done, sizeof(sds) * (c->wcount - done));
+        c->wcount -= done;
+    }
+}
+#endif
+
 static redisContext *redisContextInit(void) {
     redisContext *c;
 
@@ -632,6 +719,14 @@ static redisContext *redisContextInit(void) {
     c->ssl_ctx = NULL;
     c->session = NULL;
     c->channel = NULL;
+    c->total_read = 0;
+    c->total_written = 0;
+    c->read_size = REDIS_READ_SIZE_MIN;
+    c->max_read_size = REDIS_READ_SIZE_MAX;
+    c->wchunks = NULL;
+    c->wcount = 0;
+    c->wcapacity = 0;
+    c->wpos = 0;
 #endif
 
     return c;
@@ -651,11 +746,10 @@ void redisFree(redisContext *c) {
       c->ssl_ctx = NULL;
     }
     if(c->channel != NULL){
-        libssh2_channel_free(c->channel);
+        __redisSshChannelFree(c);
     }
-    if(c->session != NULL){
-        libssh2_session_disconnect(c->session, "Client disconnecting normally");
-        libssh2_session_free(c->session);
+    if(c->ssh != NULL){
+        __redisSshSessionRelease(c->ssh);
     }
     if (c->fd > 0) {
 #ifdef OS_WIN
@@ -666,6 +760,7 @@ void redisFree(redisContext *c) {
     }
     if (c->obuf != NULL)
         sdsfree(c->obuf);
+    __redisFreeChunks(c);
     if (c->reader != NULL)
         redisReaderFree(c->reader);
     if (c->tcp.host)
@@ -720,11 +815,25 @@ int redisReconnect(redisContext *c) {
     }
 
     sdsfree(c->obuf);
+#ifdef FASTO
+    __redisFreeChunks(c);
+    if (c->channel != NULL) {
+        __redisSshChannelFree(c);
+    }
+#endif
     redisReaderFree(c->reader);
 
     c->obuf = sdsempty();
     c->reader = redisReaderCreate();
 
+#ifdef FASTO
+    /* Tunnel goes down with the bastion, next channel needs a new session. */
+    if (c->ssh != NULL && __redisSshIsBroken(c->ssh)) {
+        if (__redisSshSessionRenew(c) != REDIS_OK)
+            return REDIS_ERR;
+    }
+#endif
+
     if (c->connection_type == REDIS_CONN_TCP) {
         return redisContextConnectBindTcp(c, c->tcp.host, c->tcp.port,
                 c->timeout, c->tcp.source_addr);
@@ -752,78 +861,187 @@ void **abstract)
 {
 }
 
-redisContext *redisConnect(const char *ip, int port, const char *ssh_address, int ssh_port, const char *username, const char *password,
-                           const char *public_key, const char *private_key, const char *passphrase, int is_ssl, int curMethod) {
+struct redisSshSession {
+    char *key; /* Sessions are shared between equal keys */
+    char *address;
+    int port;
+    char *username;
+    char *password;
+    char *public_key;
+    char *private_key;
+    char *passphrase;
+    int method;
+
+    LIBSSH2_SESSION *session;
+    int sock;
+    int refs; /* Contexts which use the session */
+    int broken; /* Transport failed, session is not handed out anymore */
+    time_t idle_since;
+    pthread_mutex_t lock; /* libssh2 session is not thread safe */
+    redisSshSession *next;
+};
 
-  redisContext *c = redisContextInit();
-  if (c == NULL) {
-    return NULL;
-  }
+static redisSshSession *ssh_sessions = NULL;
+static pthread_mutex_t ssh_sessions_lock = PTHREAD_MUTEX_INITIALIZER;
+/* Serializes handshakes, parallel connects to one bastion share the first. */
+static pthread_mutex_t ssh_create_lock = PTHREAD_MUTEX_INITIALIZER;
 
-  SSL_CTX *ssl_ctx = NULL;
-  SSL *ssl = NULL;
-  LIBSSH2_SESSION *session = NULL;
-  if (is_ssl) {
-    struct hostent* host = gethostbyname(ip);
-    if(!host){
-      __redisSetError(c, REDIS_ERR_OTHER, "Failed to resolve ssh address.");
-      return c;
-    }
+static char *__redisSshStrdup(const char *str) {
+    return str ? strdup(str) : NULL;
+}
 
-    struct sockaddr_in sin;
-    /* Connect to SSH server */
-    int server_sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
-    sin.sin_family = AF_INET;
-    sin.sin_addr = *(struct in_addr *)host->h_addr;
-    sin.sin_port = htons(port);
-    if (connect(server_sock, (struct sockaddr*)(&sin),
-                sizeof(struct sockaddr_in)) != 0) {
-      __redisSetError(c, REDIS_ERR_OTHER, "Failed to connect (ssl_address).");
-      return c;
+static void __redisSshCloseSocket(int sock) {
+#ifdef OS_WIN
+    closesocket(sock);
+#else
+    close(sock);
+#endif
+}
+
+static int __redisSshIsFatal(int rc) {
+    return rc == LIBSSH2_ERROR_SOCKET_SEND || rc == LIBSSH2_ERROR_SOCKET_RECV ||
+           rc == LIBSSH2_ERROR_SOCKET_DISCONNECT || rc == LIBSSH2_ERROR_SOCKET_TIMEOUT;
+}
+
+static int __redisSshIsBroken(redisSshSession *s) {
+    int broken;
+
+    pthread_mutex_lock(&ssh_sessions_lock);
+    broken = s->broken;
+    pthread_mutex_unlock(&ssh_sessions_lock);
+    return broken;
+}
+
+static void __redisSshSetBroken(redisSshSession *s) {
+    pthread_mutex_lock(&ssh_sessions_lock);
+    s->broken = 1;
+    pthread_mutex_unlock(&ssh_sessions_lock);
+}
+
+static void __redisSshSessionDestroy(redisSshSession *s) {
+    if (s->session) {
+        libssh2_session_set_blocking(s->session, 1);
+        if (!s->broken)
+            libssh2_session_disconnect(s->session, "Client disconnecting normally");
+        libssh2_session_free(s->session);
     }
+    if (s->sock != -1)
+        __redisSshCloseSocket(s->sock);
+    pthread_mutex_destroy(&s->lock);
+    free(s->key);
+    free(s->address);
+    free(s->username);
+    free(s->password);
+    free(s->public_key);
+    free(s->private_key);
+    free(s->passphrase);
+    free(s);
+}
 
-    init_openssl_library();
+/* Wait for the session socket. The bound is short, another thread may have
+ * drained data of our channel into the session buffers meanwhile. */
+static void __redisSshWait(redisSshSession *s) {
+    struct timeval tv;
+    fd_set rfds, wfds;
+    int dir;
+
+    pthread_mutex_lock(&s->lock);
+    dir = libssh2_session_block_directions(s->session);
+    pthread_mutex_unlock(&s->lock);
+
+    FD_ZERO(&rfds);
+    FD_ZERO(&wfds);
+    if ((dir & LIBSSH2_SESSION_BLOCK_INBOUND) || dir == 0)
+        FD_SET(s->sock, &rfds);
+    if (dir & LIBSSH2_SESSION_BLOCK_OUTBOUND)
+        FD_SET(s->sock, &wfds);
+
+    tv.tv_sec = 0;
+    tv.tv_usec = REDIS_SSH_POLL_MSEC * 1000;
+    select(s->sock + 1, &rfds, &wfds, NULL, &tv);
+}
 
-    const SSL_METHOD *method = SSLv23_client_method();
-    if ((ssl_ctx = SSL_CTX_new(method)) == NULL) {
-      close(server_sock);
-      __redisSetError(c, REDIS_ERR_OTHER, "Unable to create a new SSL context structure.");
-      return c;
+/* Map libssh2 result to read/write convention, -1 with errno on error. */
+static ssize_t __redisSshResult(redisContext *c, ssize_t rc) {
+    if (rc >= 0)
+        return rc;
+
+    if (__redisSshIsFatal(rc))
+        __redisSshSetBroken(c->ssh);
+    errno = EIO;
+    return -1;
+}
+
+static ssize_t __redisSshChannelRead(redisContext *c, char *buf, size_t size) {
+    redisSshSession *s = c->ssh;
+    ssize_t rc;
+    int next;
+
+    while (1) {
+        pthread_mutex_lock(&s->lock);
+        libssh2_keepalive_send(s->session, &next);
+        rc = libssh2_channel_read(c->channel, buf, size);
+        pthread_mutex_unlock(&s->lock);
+        if (rc != LIBSSH2_ERROR_EAGAIN)
+            break;
+        __redisSshWait(s);
     }
 
-    /* ---------------------------------------------------------- *
-     * Disabling SSLv2 will leave v3 and TSLv1 for negotiation    *
-     * ---------------------------------------------------------- */
-    SSL_CTX_set_options(ssl_ctx, SSL_OP_NO_SSLv2);
+    return __redisSshResult(c, rc);
+}
 
-    /* ---------------------------------------------------------- *
-     * Create new SSL connection state object                     *
-     * ---------------------------------------------------------- */
-    ssl = SSL_new(ssl_ctx);
+static ssize_t __redisSshChannelWrite(redisContext *c, const char *buf, size_t size) {
+    redisSshSession *s = c->ssh;
+    ssize_t rc;
+    int next;
+
+    while (1) {
+        pthread_mutex_lock(&s->lock);
+        libssh2_keepalive_send(s->session, &next);
+        rc = libssh2_channel_write(c->channel, buf, size);
+        pthread_mutex_unlock(&s->lock);
+        if (rc != LIBSSH2_ERROR_EAGAIN)
+            break;
+        __redisSshWait(s);
+    }
 
-    /* ---------------------------------------------------------- *
-     * Attach the SSL session to the socket descriptor            *
-     * ---------------------------------------------------------- */
-    SSL_set_fd(ssl, server_sock);
-  } else if(ssh_address && curMethod != SSH_UNKNOWN){
-    if (curMethod == SSH_PUBLICKEY && !private_key) {
-      __redisSetError(c, REDIS_ERR_OTHER, "Invalid input argument(private key)");
-      return c;
-    } else if (curMethod == SSH_PASSWORD && !password) {
-      __redisSetError(c, REDIS_ERR_OTHER, "Invalid input argument(password)");
-      return c;
+    return __redisSshResult(c, rc);
+}
+
+static void __redisSshChannelFree(redisContext *c) {
+    redisSshSession *s = c->ssh;
+    int rc;
+
+    while (1) {
+        pthread_mutex_lock(&s->lock);
+        rc = libssh2_channel_free(c->channel);
+        pthread_mutex_unlock(&s->lock);
+        if (rc != LIBSSH2_ERROR_EAGAIN)
+            break;
+        __redisSshWait(s);
     }
 
+    if (__redisSshIsFatal(rc))
+        __redisSshSetBroken(s);
+    c->channel = NULL;
+}
+
+/* Connect and authenticate a new session, blocking mode is used until the
+ * session is shared. */
+static redisSshSession *__redisSshSessionCreate(redisContext *c, const char *key, const char *address, int port,
+                                                const char *username, const char *password,
+                                                const char *public_key, const char *private_key,
+                                                const char *passphrase, int method) {
     int rc = libssh2_init(0);
     if (rc != 0) {
       __redisSetError(c, REDIS_ERR_OTHER, "Failed to init libssh library.");
-      return c;
+      return NULL;
     }
 
-    struct hostent* host = gethostbyname(ssh_address);
+    struct hostent* host = gethostbyname(address);
     if(!host){
       __redisSetError(c, REDIS_ERR_OTHER, "Failed to resolve ssh address.");
-      return c;
+      return NULL;
     }
 
     struct sockaddr_in sin;
@@ -831,18 +1049,20 @@ redisContext *redisConnect(const char *ip, int port, const char *ssh_address, in
     int sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
     sin.sin_family = AF_INET;
     sin.sin_addr = *(struct in_addr *)host->h_addr;
-    sin.sin_port = htons(ssh_port);
+    sin.sin_port = htons(port);
     if (connect(sock, (struct sockaddr*)(&sin),
                 sizeof(struct sockaddr_in)) != 0) {
+      __redisSshCloseSocket(sock);
       __redisSetError(c, REDIS_ERR_OTHER, "Failed to connect (ssh_address).");
-      return c;
+      return NULL;
     }
 
     /* Create a session instance */
-    session = libssh2_session_init();
+    LIBSSH2_SESSION *session = libssh2_session_init();
     if(!session) {
+      __redisSshCloseSocket(sock);
       __redisSetError(c, REDIS_ERR_OTHER, "Failed to create ssh session.");
-      return c;
+      return NULL;
     }
 
     /* ... start it up. This will trade welcome banners, exchange keys,
@@ -851,8 +1071,9 @@ redisContext *redisConnect(const char *ip, int port, const char *ssh_address, in
     rc = libssh2_session_handshake(session, sock);
     if(rc) {
       libssh2_session_free(session);
+      __redisSshCloseSocket(sock);
       __redisSetError(c, REDIS_ERR_OTHER, "SSH handshake failed.");
-      return c;
+      return NULL;
     }
 
     int auth_pw = 0;
@@ -868,37 +1089,309 @@ redisContext *redisConnect(const char *ip, int port, const char *ssh_address, in
       auth_pw |= 4;
     }
 
-    if (auth_pw & 1 && curMethod == SSH_PASSWORD) {
+    const char *auth_error = NULL;
+    if (auth_pw & 1 && method == SSH_PASSWORD) {
       /* We could authenticate via password */
       if (libssh2_userauth_password(session, username, password)) {
-        libssh2_session_free(session);
-        __redisSetError(c, REDIS_ERR_OTHER, "Authentication by password failed!");
-        return c;
+        auth_error = "Authentication by password failed!";
       }
     } else if (auth_pw & 2) {
       /* Or via keyboard-interactive */
       if (libssh2_userauth_keyboard_interactive(session, username, &kbd_callback) ) {
-        libssh2_session_free(session);
-        __redisSetError(c, REDIS_ERR_OTHER, "Authentication by keyboard-interactive failed!");
-        return c;
+        auth_error = "Authentication by keyboard-interactive failed!";
       }
-    } else if (auth_pw & 4 && curMethod == SSH_PUBLICKEY) {
+    } else if (auth_pw & 4 && method == SSH_PUBLICKEY) {
       /* Or by public key */
       if (libssh2_userauth_publickey_fromfile(session, username, public_key, private_key, passphrase)){
-        libssh2_session_free(session);
-        __redisSetError(c, REDIS_ERR_OTHER, "Authentication by public key failed!");
-        return c;
+        auth_error = "Authentication by public key failed!";
       }
     } else {
-      __redisSetError(c, REDIS_ERR_OTHER, "No supported authentication methods found!");
+      auth_error = "No supported authentication methods found!";
+    }
+
+    if (auth_error) {
       libssh2_session_free(session);
+      __redisSshCloseSocket(sock);
+      __redisSetError(c, REDIS_ERR_OTHER, auth_error);
+      return NULL;
+    }
+
+    redisSshSession *s = calloc(1, sizeof(redisSshSession));
+    if (s == NULL) {
+      libssh2_session_free(session);
+      __redisSshCloseSocket(sock);
+      __redisSetError(c, REDIS_ERR_OOM, "Out of memory");
+      return NULL;
+    }
+
+    /* Channels of different threads are multiplexed, see __redisSshWait. */
+    libssh2_keepalive_config(session, 1, REDIS_SSH_KEEPALIVE_SEC);
+    libssh2_session_set_blocking(session, 0);
+
+    s->key = strdup(key);
+    s->address = strdup(address);
+    s->port = port;
+    s->username = __redisSshStrdup(username);
+    s->password = __redisSshStrdup(password);
+    s->public_key = __redisSshStrdup(public_key);
+    s->private_key = __redisSshStrdup(private_key);
+    s->passphrase = __redisSshStrdup(passphrase);
+    s->method = method;
+    s->session = session;
+    s->sock = sock;
+    s->idle_since = time(NULL);
+    pthread_mutex_init(&s->lock, NULL);
+    return s;
+}
+
+static int __redisSshStrEqual(const char *a, const char *b) {
+    if (a == NULL || b == NULL)
+        return a == b;
+    return strcmp(a, b) == 0;
+}
+
+/* Key has no secrets in it, so credentials are compared before a session is shared. */
+static redisSshSession *__redisSshSessionFind(const char *key, const char *password, const char *passphrase) {
+    redisSshSession *s, **prev, *found = NULL, *expired = NULL;
+    time_t now = time(NULL);
+
+    pthread_mutex_lock(&ssh_sessions_lock);
+    prev = &ssh_sessions;
+    while ((s = *prev) != NULL) {
+        /* Unused broken or long idle sessions are dropped. */
+        if (s->refs == 0 && (s->broken || now - s->idle_since > REDIS_SSH_IDLE_SEC)) {
+            *prev = s->next;
+            s->next = expired;
+            expired = s;
+            continue;
+        }
+
+        if (found == NULL && !s->broken && strcmp(s->key, key) == 0 &&
+            __redisSshStrEqual(s->password, password) && __redisSshStrEqual(s->passphrase, passphrase)) {
+            s->refs++;
+            found = s;
+        }
+        prev = &s->next;
+    }
+    pthread_mutex_unlock(&ssh_sessions_lock);
+
+    while (expired != NULL) {
+        s = expired;
+        expired = s->next;
+        __redisSshSessionDestroy(s);
+    }
+
+    return found;
+}
+
+/* Authenticated session for the bastion from the pool or a new one. */
+static redisSshSession *__redisSshSessionAcquire(redisContext *c, const char *address, int port,
+                                                 const char *username, const char *password,
+                                                 const char *public_key, const char *private_key,
+                                                 const char *passphrase, int method) {
+    redisSshSession *found;
+    sds key = sdscatprintf(sdsempty(), "%s@%s:%d/%d/%s", username ? username : "", address, port, method,
+                           private_key ? private_key : "");
+    if (key == NULL) {
+        __redisSetError(c, REDIS_ERR_OOM, "Out of memory");
+        return NULL;
+    }
+
+    found = __redisSshSessionFind(key, password, passphrase);
+    if (found == NULL) {
+        pthread_mutex_lock(&ssh_create_lock);
+        found = __redisSshSessionFind(key, password, passphrase);
+        if (found == NULL) {
+            found = __redisSshSessionCreate(c, key, address, port, username, password, public_key, private_key,
+                                            passphrase, method);
+            if (found != NULL) {
+                pthread_mutex_lock(&ssh_sessions_lock);
+                found->refs = 1;
+                found->next = ssh_sessions;
+                ssh_sessions = found;
+                pthread_mutex_unlock(&ssh_sessions_lock);
+            }
+        }
+        pthread_mutex_unlock(&ssh_create_lock);
+    }
+
+    sdsfree(key);
+    return found;
+}
+
+static void __redisSshSessionRelease(redisSshSession *s) {
+    redisSshSession **prev;
+    int destroy = 0;
+
+    pthread_mutex_lock(&ssh_sessions_lock);
+    if (--s->refs == 0) {
+        s->idle_since = time(NULL);
+        if (s->broken) {
+            for (prev = &ssh_sessions; *prev != NULL; prev = &(*prev)->next) {
+                if (*prev == s) {
+                    *prev = s->next;
+                    break;
+                }
+            }
+            destroy = 1;
+        }
+    }
+    pthread_mutex_unlock(&ssh_sessions_lock);
+
+    if (destroy)
+        __redisSshSessionDestroy(s);
+}
+
+/* Replace a broken session of the context with a new one to the same bastion. */
+static int __redisSshSessionRenew(redisContext *c) {
+    redisSshSession *old = c->ssh;
+    redisSshSession *s;
+
+    __redisSshSetBroken(old);
+    s = __redisSshSessionAcquire(c, old->address, old->port, old->username, old->password, old->public_key,
+                                 old->private_key, old->passphrase, old->method);
+    __redisSshSessionRelease(old);
+    c->ssh = s;
+    c->session = s ? s->session : NULL;
+    return s ? REDIS_OK : REDIS_ERR;
+}
+
+int redisSshChannelOpen(redisContext *c, const char *addr, int port) {
+    LIBSSH2_CHANNEL *channel = NULL;
+    int attempt, rc = 0;
+
+    /* Keep the target for redisReconnect. */
+    c->connection_type = REDIS_CONN_TCP;
+    c->tcp.port = port;
+    if (c->tcp.host != addr) {
+        free(c->tcp.host);
+        c->tcp.host = strdup(addr);
+    }
+
+    for (attempt = 0; attempt < 2 && channel == NULL; attempt++) {
+        redisSshSession *s;
+        /* Pooled session could die while idle, renew it once. */
+        if (attempt > 0 && (!__redisSshIsFatal(rc) || __redisSshSessionRenew(c) != REDIS_OK))
+            break;
+
+        s = c->ssh;
+        while (1) {
+            pthread_mutex_lock(&s->lock);
+            channel = libssh2_channel_direct_tcpip(s->session, addr, port);
+            rc = channel ? 0 : libssh2_session_last_errno(s->session);
+            pthread_mutex_unlock(&s->lock);
+            if (channel != NULL || rc != LIBSSH2_ERROR_EAGAIN)
+                break;
+            __redisSshWait(s);
+        }
+    }
+
+    if (channel == NULL) {
+        if (!c->err)
+            __redisSetError(c, REDIS_ERR_OTHER, "Unable to open a ssh channel");
+        return REDIS_ERR;
+    }
+
+    c->channel = channel;
+    return REDIS_OK;
+}
+
+void redisFreeIdleSshSessions(void) {
+    redisSshSession *s, **prev, *expired = NULL;
+
+    pthread_mutex_lock(&ssh_sessions_lock);
+    prev = &ssh_sessions;
+    while ((s = *prev) != NULL) {
+        if (s->refs == 0) {
+            *prev = s->next;
+            s->next = expired;
+            expired = s;
+            continue;
+        }
+        prev = &s->next;
+    }
+    pthread_mutex_unlock(&ssh_sessions_lock);
+
+    while (expired != NULL) {
+        s = expired;
+        expired = s->next;
+        __redisSshSessionDestroy(s);
+    }
+}
+
+redisContext *redisConnect(const char *ip, int port, const char *ssh_address, int ssh_port, const char *username, const char *password,
+                           const char *public_key, const char *private_key, const char *passphrase, int is_ssl, int curMethod) {
+
+  redisContext *c = redisContextInit();
+  if (c == NULL) {
+    return NULL;
+  }
+
+  SSL_CTX *ssl_ctx = NULL;
+  SSL *ssl = NULL;
+  redisSshSession *ssh = NULL;
+  if (is_ssl) {
+    struct hostent* host = gethostbyname(ip);
+    if(!host){
+      __redisSetError(c, REDIS_ERR_OTHER, "Failed to resolve ssh address.");
+      return c;
+    }
+
+    struct sockaddr_in sin;
+    /* Connect to SSH server */
+    int server_sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+    sin.sin_family = AF_INET;
+    sin.sin_addr = *(struct in_addr *)host->h_addr;
+    sin.sin_port = htons(port);
+    if (connect(server_sock, (struct sockaddr*)(&sin),
+                sizeof(struct sockaddr_in)) != 0) {
+      __redisSetError(c, REDIS_ERR_OTHER, "Failed to connect (ssl_address).");
+      return c;
+    }
+
+    init_openssl_library();
+
+    const SSL_METHOD *method = SSLv23_client_method();
+    if ((ssl_ctx = SSL_CTX_new(method)) == NULL) {
+      close(server_sock);
+      __redisSetError(c, REDIS_ERR_OTHER, "Unable to create a new SSL context structure.");
+      return c;
+    }
+
+    /* ---------------------------------------------------------- *
+     * Disabling SSLv2 will leave v3 and TSLv1 for negotiation    *
+     * ---------------------------------------------------------- */
+    SSL_CTX_set_options(ssl_ctx, SSL_OP_NO_SSLv2);
+
+    /* ---------------------------------------------------------- *
+     * Create new SSL connection state object                     *
+     * ---------------------------------------------------------- */
+    ssl = SSL_new(ssl_ctx);
+
+    /* ---------------------------------------------------------- *
+     * Attach the SSL session to the socket descriptor            *
+     * ---------------------------------------------------------- */
+    SSL_set_fd(ssl, server_sock);
+  } else if(ssh_address && curMethod != SSH_UNKNOWN){
+    if (curMethod == SSH_PUBLICKEY && !private_key) {
+      __redisSetError(c, REDIS_ERR_OTHER, "Invalid input argument(private key)");
+      return c;
+    } else if (curMethod == SSH_PASSWORD && !password) {
+      __redisSetError(c, REDIS_ERR_OTHER, "Invalid input argument(password)");
+      return c;
+    }
+
+    ssh = __redisSshSessionAcquire(c, ssh_address, ssh_port, username, password, public_key, private_key,
+                                   passphrase, curMethod);
+    if (!ssh) {
       return c;
     }
   }
 
   c->ssl = ssl;
   c->ssl_ctx = ssl_ctx;
-  c->session = session;
+  c->ssh = ssh;
+  c->session = ssh ? ssh->session : NULL;
   c->flags |= REDIS_BLOCK;
   redisContextConnectTcp(c,ip,port,NULL);
   return c;
@@ -1026,7 +1519,6 @@ int redisEnableKeepAlive(redisContext *c) {
  * After this function is called, you may use redisContextReadReply to
  * see if there is a reply available. */
 int redisBufferRead(redisContext *c) {
-    char buf[1024*16];
     int nread;
 
     /* Return early when the context has seen an error. */
@@ -1034,18 +1526,25 @@ int redisBufferRead(redisContext *c) {
         return REDIS_ERR;
 
 #ifdef FASTO
+    /* Read straight into the reader buffer, no intermediate copy. */
+    size_t size = c->read_size;
+    char *buf = redisReaderReserve(c->reader,size);
+    if (buf == NULL) {
+        __redisSetError(c,c->reader->err,c->reader->errstr);
+        return REDIS_ERR;
+    }
 
     if (c->ssl) {
-        nread = SSL_read(c->ssl, buf, sizeof(buf));
+        nread = SSL_read(c->ssl, buf, size);
     } else if(c->channel) {
-        nread = libssh2_channel_read(c->channel, buf, sizeof(buf));
+        nread = __redisSshChannelRead(c, buf, size);
     }
     else{
         #ifdef OS_WIN
             errno = 0;
-            nread = recv(c->fd,buf,sizeof(buf),0);
+            nread = recv(c->fd,buf,size,0);
         #else
-            nread = read(c->fd,buf,sizeof(buf));
+            nread = read(c->fd,buf,size);
         #endif
     }
 
@@ -1060,12 +1559,18 @@ int redisBufferRead(redisContext *c) {
         __redisSetError(c,REDIS_ERR_EOF,"Server closed the connection");
         return REDIS_ERR;
     } else {
-        if (redisReaderFeed(c->reader,buf,nread) != REDIS_OK) {
-            __redisSetError(c,c->reader->err,c->reader->errstr);
-            return REDIS_ERR;
+        c->total_read += nread;
+        redisReaderCommit(c->reader,nread);
+
+        /* Grow while reads fill the buffer, shrink back after small ones. */
+        if ((size_t)nread == size && size < c->max_read_size) {
+            c->read_size = size * 2 > c->max_read_size ? c->max_read_size : size * 2;
+        } else if ((size_t)nread < size / 4 && size > REDIS_READ_SIZE_MIN) {
+            c->read_size = size / 2;
         }
     }
 #else
+    char buf[1024*16];
     nread = read(c->fd,buf,sizeof(buf));
     if (nread == -1) {
         if ((errno == EAGAIN && !(c->flags & REDIS_BLOCK)) || (errno == EINTR)) {
@@ -1097,43 +1602,62 @@ int redisBufferRead(redisContext *c) {
  * c->errstr to hold the appropriate error string.
  */
 int redisBufferWrite(redisContext *c, int *done) {
-    int nwritten;
+#ifdef FASTO
+    ssize_t nwritten;
 
     /* Return early when the context has seen an error. */
     if (c->err)
         return REDIS_ERR;
 
-    if (sdslen(c->obuf) > 0) {
-#ifdef FASTO
-    if (c->ssl) {
-        nwritten = SSL_write(c->ssl, c->obuf, sdslen(c->obuf));
-    } else if(c->channel){
-        nwritten = libssh2_channel_write(c->channel, c->obuf, sdslen(c->obuf));
-    }
-    else{
+    if (__redisQueueOutputBuffer(c) != REDIS_OK)
+        return REDIS_ERR;
+
+    if (c->wcount > 0) {
+        const char *head = c->wchunks[0] + c->wpos;
+        size_t head_len = sdslen(c->wchunks[0]) - c->wpos;
+        if (c->ssl) {
+            nwritten = SSL_write(c->ssl, head, head_len);
+        } else if(c->channel){
+            nwritten = __redisSshChannelWrite(c, head, head_len);
+        }
+        else{
 #ifdef OS_WIN
-        nwritten = send(c->fd,c->obuf,sdslen(c->obuf),0);
+            nwritten = send(c->fd,head,head_len,0);
 #else
-        nwritten = write(c->fd,c->obuf,sdslen(c->obuf));
+            /* Whole pipeline in one syscall, queued chunks are not coalesced. */
+            struct iovec iov[REDIS_WRITE_IOV_MAX];
+            int iovcnt;
+            for (iovcnt = 0; iovcnt < c->wcount && iovcnt < REDIS_WRITE_IOV_MAX; iovcnt++) {
+                size_t offset = iovcnt == 0 ? c->wpos : 0;
+                iov[iovcnt].iov_base = c->wchunks[iovcnt] + offset;
+                iov[iovcnt].iov_len = sdslen(c->wchunks[iovcnt]) - offset;
+            }
+            nwritten = writev(c->fd,iov,iovcnt);
 #endif
-    }
-
-    if (nwritten == -1) {
-        if ((errno == EAGAIN && !(c->flags & REDIS_BLOCK)) || (errno == F_EINTR)) {
-            /* Try again later */
-        } else {
-            __redisSetError(c,REDIS_ERR_IO,NULL);
-            return REDIS_ERR;
         }
-    } else if (nwritten > 0) {
-        if (nwritten == (signed)sdslen(c->obuf)) {
-            sdsfree(c->obuf);
-            c->obuf = sdsempty();
-        } else {
-            sdsrange(c->obuf,nwritten,-1);
+
+        if (nwritten == -1) {
+            if ((errno == EAGAIN && !(c->flags & REDIS_BLOCK)) || (errno == F_EINTR)) {
+                /* Try again later */
+            } else {
+                __redisSetError(c,REDIS_ERR_IO,NULL);
+                return REDIS_ERR;
+            }
+        } else if (nwritten > 0) {
+            c->total_written += nwritten;
+            __redisConsumeChunks(c,nwritten);
         }
     }
+    if (done != NULL) *done = (c->wcount == 0 && sdslen(c->obuf) == 0);
+    return REDIS_OK;
 #else
+    int nwritten;
+
+    /* Return early when the context has seen an error. */
+    if (c->err)
+        return REDIS_ERR;
+
+    if (sdslen(c->obuf) > 0) {
         nwritten = write(c->fd,c->obuf,sdslen(c->obuf));
         if (nwritten == -1) {
             if ((errno == EAGAIN && !(c->flags & REDIS_BLOCK)) || (errno == EINTR)) {
@@ -1150,10 +1674,10 @@ int redisBufferWrite(redisContext *c, int *done) {
                 sdsrange(c->obuf,nwritten,-1);
             }
         }
-#endif
     }
     if (done != NULL) *done = (sdslen(c->obuf) == 0);
     return REDIS_OK;
+#endif
 }
 
 #ifdef FASTO
@@ -1168,7 +1692,7 @@ int redisReadToBuffer(redisContext *c, char* buf, int size, ssize_t *nread)
     if (c->ssl) {
         *nread = SSL_read(c->ssl, buf, size);
     } else if(c->channel){
-        *nread = libssh2_channel_read(c->channel, buf, size);
+        *nread = __redisSshChannelRead(c, buf, size);
     }
     else{
         #ifdef OS_WIN
@@ -1186,9 +1710,85 @@ int redisReadToBuffer(redisContext *c, char* buf, int size, ssize_t *nread)
         }
     }
 
+    c->total_read += *nread;
     return REDIS_OK;
 }
 
+void redisSetMaxReadSize(redisContext *c, size_t size) {
+    if (size == 0)
+        size = REDIS_READ_SIZE_MAX;
+    if (size < REDIS_READ_SIZE_MIN)
+        size = REDIS_READ_SIZE_MIN;
+
+    c->max_read_size = size;
+    if (c->read_size > size)
+        c->read_size = size;
+}
+
+/* Ssh sessions are shared, other threads may pump data of our channel, so the
+ * channel is read directly and the session socket is only waited for. */
+static int __redisSshWaitReadable(redisContext *c, int msec) {
+    redisSshSession *s = c->ssh;
+    int waits = msec / REDIS_SSH_POLL_MSEC + 1;
+    ssize_t rc;
+
+    while (1) {
+        size_t size = c->read_size;
+        char *buf = redisReaderReserve(c->reader,size);
+        if (buf == NULL) {
+            __redisSetError(c,c->reader->err,c->reader->errstr);
+            return REDIS_ERR;
+        }
+
+        pthread_mutex_lock(&s->lock);
+        rc = libssh2_channel_read(c->channel, buf, size);
+        pthread_mutex_unlock(&s->lock);
+        if (rc > 0) {
+            c->total_read += rc;
+            redisReaderCommit(c->reader,rc);
+            return 1;
+        }
+        if (rc == 0) {
+            __redisSetError(c,REDIS_ERR_EOF,"Server closed the connection");
+            return REDIS_ERR;
+        }
+        if (rc != LIBSSH2_ERROR_EAGAIN) {
+            __redisSshResult(c, rc);
+            __redisSetError(c,REDIS_ERR_IO,NULL);
+            return REDIS_ERR;
+        }
+        if (waits-- == 0)
+            return 0;
+        __redisSshWait(s);
+    }
+}
+
+int redisWaitReadable(redisContext *c, int msec) {
+    struct timeval tv;
+    fd_set rfds;
+    int rc;
+
+    if (c->err)
+        return REDIS_ERR;
+    if (c->channel)
+        return __redisSshWaitReadable(c, msec);
+    if (c->ssl && SSL_pending(c->ssl) > 0)
+        return 1;
+
+    FD_ZERO(&rfds);
+    FD_SET(c->fd, &rfds);
+    tv.tv_sec = msec / 1000;
+    tv.tv_usec = (msec % 1000) * 1000;
+    rc = select(c->fd + 1, &rfds, NULL, NULL, &tv);
+    if (rc == -1) {
+        if (errno == F_EINTR)
+            return 0;
+        __redisSetError(c,REDIS_ERR_IO,NULL);
+        return REDIS_ERR;
+    }
+    return rc > 0;
+}
+
 int redisWriteFromBuffer(redisContext *c, const char *buf, ssize_t *nwritten)
 {
     *nwritten = -1;
@@ -1201,7 +1801,7 @@ int redisWriteFromBuffer(redisContext *c, const char *buf, ssize_t *nwritten)
 
     if (len > 0) {
         if(c->channel){
-            *nwritten = libssh2_channel_write(c->channel, buf, len);
+            *nwritten = __redisSshChannelWrite(c, buf, len);
         }
         else{
     #ifdef OS_WIN
@@ -1216,6 +1816,7 @@ int redisWriteFromBuffer(redisContext *c, const char *buf, ssize_t *nwritten)
         return REDIS_ERR;
     }
 
+    c->total_written += *nwritten;
     return REDIS_OK;
 }
 #endif
@@ -1331,6 +1932,17 @@ int redisAppendCommandArgv(redisContext *c, int argc, const char **argv, const s
         return REDIS_ERR;
     }
 
+#ifdef FASTO
+    /* Large command is queued without copying, small ones are coalesced. */
+    if (len >= REDIS_WRITE_CHUNK_MIN) {
+        if (__redisQueueOutputBuffer(c) != REDIS_OK || __redisQueueChunk(c,cmd) != REDIS_OK) {
+            sdsfree(cmd);
+            return REDIS_ERR;
+        }
+        return REDIS_OK;
+    }
+#endif
+
     if (__redisAppendCommand(c,cmd,len) != REDIS_OK) {
         sdsfree(cmd);
         return REDIS_ERR;
@@ -73,6 +73,27 @@
 /* Flag that is set when the async context has one or more subscriptions. */
 #define REDIS_SUBSCRIBED 0x20
 
+#ifdef FASTO
+/* Transport reads start at REDIS_READ_SIZE_MIN bytes and double while they
+ * fill the buffer, up to the context read limit. */
+#define REDIS_READ_SIZE_MIN (1024*16)
+#define REDIS_READ_SIZE_MAX (1024*1024)
+
+/* Formatted commands larger than this are queued as is instead of being
+ * copied into the output buffer, queued chunks are written with writev. */
+#define REDIS_WRITE_CHUNK_MIN (1024*16)
+#define REDIS_WRITE_IOV_MAX 64
+
+/* Authenticated ssh sessions are shared by all contexts tunneled through
+ * the same bastion, each context gets its own direct-tcpip channel. Idle
+ * sessions are kept for a while to be reused by the next connect. */
+#define REDIS_SSH_KEEPALIVE_SEC 30
+#define REDIS_SSH_IDLE_SEC 60
+#define REDIS_SSH_POLL_MSEC 10
+
+typedef struct redisSshSession redisSshSession;
+#endif
+
 /* Flag that is set when monitor mode is active */
 #define REDIS_MONITORING 0x40
 
@@ -169,11 +190,23 @@ typedef struct redisContext {
         char *path;
     } unix_sock;
 #ifdef FASTO
+    redisSshSession *ssh; /* Shared ssh session, channel is ours */
     LIBSSH2_SESSION *session;
     LIBSSH2_CHANNEL *channel;
 
     SSL_CTX *ssl_ctx;
     SSL *ssl;
+
+    unsigned long long total_read; /* Bytes read from transport since connect */
+    unsigned long long total_written; /* Bytes written to transport since connect */
+
+    size_t read_size; /* Current transport read size */
+    size_t max_read_size; /* Limit of read_size growth */
+
+    sds *wchunks; /* Output chunks queued before obuf */
+    int wcount; /* Number of queued chunks */
+    int wcapacity; /* Allocated chunk slots */
+    size_t wpos; /* Bytes of the first chunk already written */
 #endif
 } redisContext;
 
@@ -214,6 +247,14 @@ int redisBufferWrite(redisContext *c, int *done);
 #ifdef FASTO
 int redisReadToBuffer(redisContext *c, char *buf, int size, ssize_t *readed);
 int redisWriteFromBuffer(redisContext *c, const char *buf, ssize_t *nwritten);
+/* Limit of adaptive transport reads, 0 resets to REDIS_READ_SIZE_MAX.
+ * Only benchmarks change it, connections keep REDIS_READ_SIZE_MAX. */
+void redisSetMaxReadSize(redisContext *c, size_t size);
+/* Waits up to msec for reply data, 1 if it can be read, 0 on timeout, REDIS_ERR on error.
+ * Long listeners use it to check their stop flag without losing the context. */
+int redisWaitReadable(redisContext *c, int msec);
+/* Close pooled ssh sessions which have no channels. */
+void redisFreeIdleSshSessions(void);
 #endif
 /* In a blocking context, this function first checks if there are unconsumed
  * replies to return and returns one if so. Otherwise, it flushes the output
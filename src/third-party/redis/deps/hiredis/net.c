@@ -427,9 +427,8 @@ static int _redisContextConnectTcp(redisContext *c, const char *addr, int port,
                                    const struct timeval *timeout,
                                    const char *source_addr) {
 #ifdef FASTO
-    if(c->session){
-        if (!(c->channel = libssh2_channel_direct_tcpip(c->session, addr, port))) {
-            __redisSetError(c, REDIS_ERR_OTHER, "Unable to open a ssh session");
+    if(c->ssh){
+        if (redisSshChannelOpen(c, addr, port) != REDIS_OK) {
             return REDIS_ERR;
         }
 
@@ -49,5 +49,8 @@ int redisContextConnectBindTcp(redisContext *c, const char *addr, int port,
                                const char *source_addr);
 int redisContextConnectUnix(redisContext *c, const char *path, const struct timeval *timeout);
 int redisKeepAlive(redisContext *c, int interval);
+#ifdef FASTO
+int redisSshChannelOpen(redisContext *c, const char *addr, int port);
+#endif
 
 #endif
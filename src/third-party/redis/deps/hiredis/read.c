@@ -474,6 +474,45 @@ int redisReaderFeed(redisReader *r, const char *buf, size_t len) {
     return REDIS_OK;
 }
 
+#ifdef FASTO
+/* Reserve room for at least size bytes at the end of the reader buffer, so
+ * the transport can read straight into it. Call redisReaderCommit() with
+ * the number of bytes actually stored. Returns NULL on error. */
+char *redisReaderReserve(redisReader *r, size_t size) {
+    sds newbuf;
+
+    /* Return early when this reader is in an erroneous state. */
+    if (r->err)
+        return NULL;
+
+    /* Destroy internal buffer when it is empty and much larger than the
+     * current read size. */
+    if (r->len == 0 && r->maxbuf != 0 && sdsavail(r->buf) > r->maxbuf &&
+        sdsavail(r->buf) > size * 2) {
+        sdsfree(r->buf);
+        r->buf = sdsempty();
+        r->pos = 0;
+
+        /* r->buf should not be NULL since we just free'd a larger one. */
+        assert(r->buf != NULL);
+    }
+
+    newbuf = sdsMakeRoomFor(r->buf,size);
+    if (newbuf == NULL) {
+        __redisReaderSetErrorOOM(r);
+        return NULL;
+    }
+
+    r->buf = newbuf;
+    return r->buf + sdslen(r->buf);
+}
+
+void redisReaderCommit(redisReader *r, size_t len) {
+    sdsIncrLen(r->buf,len);
+    r->len = sdslen(r->buf);
+}
+#endif
+
 int redisReaderGetReply(redisReader *r, void **reply) {
     /* Default target pointer to NULL. */
     if (reply != NULL)
@@ -158,6 +158,9 @@ const QString trRemoveBranch = QObject::tr("Remove branch");
 const QString trCreateKey = QObject::tr("Create key");
 const QString trViewKeysDialog = QObject::tr("View keys dialog");
 const QString trPubSubDialog = QObject::tr("Pub/Sub dialog");
+const QString trLiveUpdates = QObject::tr("Live updates");
+const QString trMemoryAnalysis = QObject::tr("Memory analysis");
+const QString trCopyKeysTo = QObject::tr("Copy keys to...");
 const QString trPublish = QObject::tr("Publish");
 const QString trEncodeDecode = QObject::tr("Encode/Decode");
 const QString trEncode = QObject::tr("Encode");
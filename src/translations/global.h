@@ -158,6 +158,9 @@ extern const QString trRemoveBranch;
 extern const QString trCreateKey;
 extern const QString trViewKeysDialog;
 extern const QString trPubSubDialog;
+extern const QString trLiveUpdates;
+extern const QString trMemoryAnalysis;
+extern const QString trCopyKeysTo;
 extern const QString trPublish;
 extern const QString trEncodeDecode;
 extern const QString trEncode;
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#include "third-party/sds/sds.h"
+}
+
+#include <common/sprintf.h>
+
+#include "core/icommand_translator.h"
+#include "core/types.h"
+
+#ifdef BUILD_WITH_REDIS
+#include "core/db/redis/db_connection.h"
+#endif
+
+using namespace fastonosql;
+
+namespace {
+
+core::command_buffer_t MakeScript(int64_t lines) {
+  core::command_buffer_t script;
+  for (int64_t i = 0; i < lines; ++i) {
+    script += common::MemSPrintf("SET key:%lld \\x00\\x01\\x02\\x03 \"value with spaces\"\n", static_cast<long long>(i));
+  }
+  return script;
+}
+
+}  // namespace
+
+static void BM_StableCommand(benchmark::State& state) {
+  const core::command_buffer_t command = "SET \\x00\\x01\\x02\\x03 \\xff\\xfe\\xfd\\xfc";
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(core::StableCommand(command));
+  }
+}
+BENCHMARK(BM_StableCommand);
+
+static void BM_ParseCommands(benchmark::State& state) {
+  const core::command_buffer_t script = MakeScript(state.range(0));
+  while (state.KeepRunning()) {
+    std::vector<core::command_buffer_t> commands;
+    common::Error err = core::ParseCommands(script, &commands);
+    benchmark::DoNotOptimize(err);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * script.size());
+}
+BENCHMARK(BM_ParseCommands)->Range(8, 8 << 10);
+
+static void BM_SdsSplitArgsLong(benchmark::State& state) {
+  const std::string line =
+      "JSON.SET key . "
+      "{\"array\":[1,2,3],\"boolean\":true,\"null\":null,\"number\":123,\"string\":\"Hello World\"}";
+  while (state.KeepRunning()) {
+    int argc = 0;
+    sds* argv = sdssplitargslong(line.c_str(), &argc);
+    sdsfreesplitres(argv, argc);
+  }
+  state.SetBytesProcessed(state.iterations() * line.size());
+}
+BENCHMARK(BM_SdsSplitArgsLong);
+
+#ifdef BUILD_WITH_REDIS
+static void BM_FindCommand(benchmark::State& state) {
+  core::redis::DBConnection db(nullptr);  // biggest commands table
+  core::translator_t tran = db.GetTranslator();
+  const core::commands_args_t argv = {"CLIENT", "KILL", "127.0.0.1:6379"};
+  while (state.KeepRunning()) {
+    const core::CommandHolder* cmd = nullptr;
+    size_t off = 0;
+    common::Error err = tran->FindCommand(argv, &cmd, &off);
+    benchmark::DoNotOptimize(err);
+  }
+}
+BENCHMARK(BM_FindCommand);
+#endif
@@ -0,0 +1,188 @@
+#include <benchmark/benchmark.h>
+
+#include <stdlib.h>  // for mkdtemp, getenv
+
+#include <string>
+#include <vector>
+
+#include <common/file_system/file_system.h>
+#include <common/sprintf.h>
+
+#include "core/db/leveldb/db_connection.h"
+#include "core/db/lmdb/db_connection.h"
+
+#ifdef BUILD_WITH_LMDB
+#include <lmdb.h>  // for MDB_NOSYNC
+#endif
+
+using namespace fastonosql;
+
+namespace {
+
+const size_t kKeysCount = 1000000;
+const uint64_t kDeepCursor = kKeysCount / 2;
+
+std::string MakeKey(size_t index) {
+  return common::MemSPrintf("key:%012llu", static_cast<unsigned long long>(index));
+}
+
+// unique directory per process, so parallel runs and user data are not touched
+std::string MakeTempDirectory(const std::string& name) {
+  const char* tmp = getenv("TMPDIR");
+  std::string templ = std::string(tmp && *tmp ? tmp : "/tmp") + "/fastonosql_bench." + name + ".XXXXXX";
+  if (!mkdtemp(&templ[0])) {
+    return std::string();
+  }
+  return templ;
+}
+
+// database populated once per process in own directory which is removed at exit
+template <typename Connection, typename Config>
+class PopulatedDatabase {
+ public:
+  PopulatedDatabase(const std::string& directory, const Config& config)
+      : directory_(directory), config_(config), db_(nullptr), err_() {
+    if (directory_.empty()) {
+      err_ = common::make_error("Can't create temporary directory");
+      return;
+    }
+
+    err_ = db_.Connect(config_);
+    for (size_t i = 0; i < kKeysCount && !err_; ++i) {
+      core::NDbKValue kv(core::NKey(core::key_t(MakeKey(i))),
+                         core::NValue(common::Value::CreateStringValue(MakeKey(kKeysCount - i))));
+      core::NDbKValue added;
+      err_ = db_.Set(kv, &added);
+    }
+  }
+
+  ~PopulatedDatabase() {
+    if (db_.IsConnected()) {
+      common::Error err = db_.Disconnect();
+      UNUSED(err);
+    }
+    if (!directory_.empty()) {
+      common::ErrnoError errn = common::file_system::remove_directory(directory_, true);
+      UNUSED(errn);
+    }
+  }
+
+  Connection* GetConnection() { return err_ ? nullptr : &db_; }
+
+  std::string GetErrorDescription() const { return err_ ? err_->GetDescription() : std::string(); }
+
+ private:
+  const std::string directory_;
+  const Config config_;
+  Connection db_;
+  common::Error err_;
+};
+
+// Args: cursor, count
+template <typename Connection, typename Config>
+void ScanPage(benchmark::State& state,
+              PopulatedDatabase<Connection, Config>* holder,
+              const std::string& pattern = "*") {
+  Connection* db = holder->GetConnection();
+  if (!db) {
+    state.SkipWithError(holder->GetErrorDescription().c_str());
+    return;
+  }
+
+  const uint64_t cursor = state.range(0);
+  const uint64_t count = state.range(1);
+  while (state.KeepRunning()) {
+    std::vector<std::string> keys;
+    uint64_t cursor_out = 0;
+    common::Error err = db->Scan(cursor, pattern, count, &keys, &cursor_out);
+    if (err) {
+      state.SkipWithError(err->GetDescription().c_str());
+      return;
+    }
+    benchmark::DoNotOptimize(keys.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+}  // namespace
+
+#ifdef BUILD_WITH_LEVELDB
+namespace {
+
+core::leveldb::Config MakeLevelDBConfig(const std::string& directory) {
+  core::leveldb::Config config;
+  config.db_path = directory + "/db";
+  config.create_if_missing = true;
+  return config;
+}
+
+PopulatedDatabase<core::leveldb::DBConnection, core::leveldb::Config>* GetLevelDB() {
+  static const std::string directory = MakeTempDirectory("leveldb");
+  static PopulatedDatabase<core::leveldb::DBConnection, core::leveldb::Config> db(directory,
+                                                                                  MakeLevelDBConfig(directory));
+  return &db;
+}
+
+}  // namespace
+
+static void BM_LevelDBScan(benchmark::State& state) {
+  ScanPage(state, GetLevelDB());
+}
+BENCHMARK(BM_LevelDBScan)->Args({0, 100})->Args({0, 1000})->Args({kDeepCursor, 100})->Unit(benchmark::kMicrosecond);
+
+// 1000 keys range in the middle of keyspace, cost should not depend on database size
+static void BM_LevelDBPrefixScan(benchmark::State& state) {
+  ScanPage(state, GetLevelDB(), "key:000000500*");
+}
+BENCHMARK(BM_LevelDBPrefixScan)->Args({0, 100})->Args({0, 1000})->Unit(benchmark::kMicrosecond);
+
+static void BM_LevelDBExecuteGet(benchmark::State& state) {
+  core::leveldb::DBConnection* db = GetLevelDB()->GetConnection();
+  if (!db) {
+    state.SkipWithError(GetLevelDB()->GetErrorDescription().c_str());
+    return;
+  }
+
+  const core::command_buffer_t command = "GET " + MakeKey(kKeysCount / 3);
+  while (state.KeepRunning()) {
+    core::FastoObjectIPtr root = core::FastoObject::CreateRoot(command);
+    common::Error err = db->Execute(command, root.get());
+    if (err) {
+      state.SkipWithError(err->GetDescription().c_str());
+      return;
+    }
+  }
+}
+BENCHMARK(BM_LevelDBExecuteGet);
+#endif
+
+#ifdef BUILD_WITH_LMDB
+namespace {
+
+core::lmdb::Config MakeLMDBConfig(const std::string& directory) {
+  core::lmdb::Config config;
+  config.db_path = directory + "/data.mdb";
+  config.env_flags |= MDB_NOSYNC;  // population speed, durability is not needed here
+  config.SetReadOnlyDB(false);
+  config.map_size_mb = 256;  // fits 1M keys without growth
+  return config;
+}
+
+PopulatedDatabase<core::lmdb::DBConnection, core::lmdb::Config>* GetLMDB() {
+  static const std::string directory = MakeTempDirectory("lmdb");
+  static PopulatedDatabase<core::lmdb::DBConnection, core::lmdb::Config> db(directory, MakeLMDBConfig(directory));
+  return &db;
+}
+
+}  // namespace
+
+static void BM_LMDBScan(benchmark::State& state) {
+  ScanPage(state, GetLMDB());
+}
+BENCHMARK(BM_LMDBScan)->Args({0, 100})->Args({0, 1000})->Args({kDeepCursor, 100})->Unit(benchmark::kMicrosecond);
+
+static void BM_LMDBPrefixScan(benchmark::State& state) {
+  ScanPage(state, GetLMDB(), "key:000000500*");
+}
+BENCHMARK(BM_LMDBPrefixScan)->Args({0, 100})->Args({0, 1000})->Unit(benchmark::kMicrosecond);
+#endif
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#ifdef BUILD_WITH_REDIS
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+namespace {
+
+// needs redis server on loopback, benchmarks are skipped without it
+const char* kHost = "127.0.0.1";
+const int kPort = 6379;
+const char* kLargeKey = "fastonosql:bench:large";
+const int64_t kPipelineCommands = 100000;
+
+std::string MakePipelineKey(int64_t index) {
+  return "fastonosql:bench:pipeline:" + std::to_string(index);
+}
+
+class LoopbackContext {
+ public:
+  explicit LoopbackContext(size_t max_read_size) : context_(nullptr) {
+    struct timeval tv = {1, 0};
+    context_ = redisConnectWithTimeout(kHost, kPort, tv);
+    if (context_ && !context_->err) {
+      redisSetMaxReadSize(context_, max_read_size);
+    }
+  }
+
+  ~LoopbackContext() { redisFree(context_); }
+
+  redisContext* Get() const { return context_; }
+
+  // keys written by benchmark are removed, so server is left as it was
+  void DeleteKeys(const std::vector<std::string>& keys) {
+    if (!IsValid()) {
+      return;
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const char* argv[] = {"DEL", keys[i].data()};
+      const size_t argvlen[] = {3, keys[i].size()};
+      if (redisAppendCommandArgv(context_, 2, argv, argvlen) != REDIS_OK) {
+        return;
+      }
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      void* reply = nullptr;
+      if (redisGetReply(context_, &reply) != REDIS_OK) {
+        return;
+      }
+      freeReplyObject(reply);
+    }
+  }
+
+  const char* GetError() const { return context_ ? context_->errstr : "no context"; }
+
+  bool IsValid() const { return context_ && !context_->err; }
+
+ private:
+  redisContext* context_;
+};
+
+}  // namespace
+
+// Args: value size, max read size
+static void BM_RedisLoopbackLargeGet(benchmark::State& state) {
+  LoopbackContext context(state.range(1));
+  if (!context.IsValid()) {
+    state.SkipWithError(context.GetError());
+    return;
+  }
+
+  const std::string value(state.range(0), 'v');
+  const char* set_argv[] = {"SET", kLargeKey, value.data()};
+  const size_t set_argvlen[] = {3, strlen(kLargeKey), value.size()};
+  redisReply* reply = static_cast<redisReply*>(redisCommandArgv(context.Get(), 3, set_argv, set_argvlen));
+  if (!reply) {
+    state.SkipWithError(context.GetError());
+    return;
+  }
+  freeReplyObject(reply);
+
+  while (state.KeepRunning()) {
+    reply = static_cast<redisReply*>(redisCommand(context.Get(), "GET %s", kLargeKey));
+    if (!reply) {
+      state.SkipWithError(context.GetError());
+      return;
+    }
+    freeReplyObject(reply);
+  }
+  context.DeleteKeys({kLargeKey});
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RedisLoopbackLargeGet)
+    ->Args({1 << 20, REDIS_READ_SIZE_MIN})
+    ->Args({1 << 20, REDIS_READ_SIZE_MAX})
+    ->Args({16 << 20, REDIS_READ_SIZE_MIN})
+    ->Args({16 << 20, REDIS_READ_SIZE_MAX})
+    ->Unit(benchmark::kMillisecond);
+
+// Args: value size
+static void BM_RedisLoopbackPipeline(benchmark::State& state) {
+  LoopbackContext context(REDIS_READ_SIZE_MAX);
+  if (!context.IsValid()) {
+    state.SkipWithError(context.GetError());
+    return;
+  }
+
+  const std::string value(state.range(0), 'v');
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < kPipelineCommands; ++i) {
+      const std::string key = MakePipelineKey(i);
+      const char* argv[] = {"SET", key.data(), value.data()};
+      const size_t argvlen[] = {3, key.size(), value.size()};
+      if (redisAppendCommandArgv(context.Get(), 3, argv, argvlen) != REDIS_OK) {
+        state.SkipWithError(context.GetError());
+        return;
+      }
+    }
+
+    for (int64_t i = 0; i < kPipelineCommands; ++i) {
+      void* reply = nullptr;
+      if (redisGetReply(context.Get(), &reply) != REDIS_OK) {
+        state.SkipWithError(context.GetError());
+        return;
+      }
+      freeReplyObject(reply);
+    }
+  }
+
+  std::vector<std::string> keys;
+  for (int64_t i = 0; i < kPipelineCommands; ++i) {
+    keys.push_back(MakePipelineKey(i));
+  }
+  context.DeleteKeys(keys);
+  state.SetItemsProcessed(state.iterations() * kPipelineCommands);
+}
+BENCHMARK(BM_RedisLoopbackPipeline)->Arg(16)->Arg(1 << 10)->Unit(benchmark::kMillisecond);
+#endif
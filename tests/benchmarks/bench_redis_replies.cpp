@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#ifdef BUILD_WITH_REDIS
+#include <string>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+#include "core/db/redis/db_connection.h"
+
+using namespace fastonosql;
+
+namespace {
+
+// synthetic reply tree, owns all nodes, nothing allocated by hiredis
+class SyntheticReply {
+ public:
+  explicit SyntheticReply(int64_t elements) : strings_(), nodes_(), pointers_(), root_() {
+    strings_.reserve(elements);
+    nodes_.resize(elements);
+    pointers_.resize(elements);
+    for (int64_t i = 0; i < elements; ++i) {
+      redisReply* node = &nodes_[i];
+      if (i % 4 == 3) {
+        node->type = REDIS_REPLY_INTEGER;
+        node->integer = i;
+      } else {
+        strings_.push_back("value:" + std::to_string(i));
+        node->type = REDIS_REPLY_STRING;
+        node->str = const_cast<char*>(strings_.back().c_str());
+        node->len = strings_.back().size();
+      }
+      pointers_[i] = node;
+    }
+
+    root_.type = REDIS_REPLY_ARRAY;
+    root_.elements = pointers_.size();
+    root_.element = pointers_.data();
+  }
+
+  redisReply* Get() { return &root_; }
+
+ private:
+  std::vector<std::string> strings_;
+  std::vector<redisReply> nodes_;
+  std::vector<redisReply*> pointers_;
+  redisReply root_;
+};
+
+}  // namespace
+
+static void BM_ValueFromReplay(benchmark::State& state) {
+  SyntheticReply reply(state.range(0));
+  while (state.KeepRunning()) {
+    common::Value* val = nullptr;
+    common::Error err = core::redis::ValueFromReplay(reply.Get(), &val);
+    benchmark::DoNotOptimize(err);
+    delete val;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueFromReplay)->Range(8, 64 << 10);
+#endif
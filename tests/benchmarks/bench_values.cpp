@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "core/db_key.h"
+#include "core/value.h"
+
+using namespace fastonosql;
+
+namespace {
+
+common::ArrayValue* MakeArray(int64_t size) {
+  common::ArrayValue* array = common::Value::CreateArrayValue();
+  for (int64_t i = 0; i < size; ++i) {
+    array->AppendString("member:" + std::to_string(i));
+  }
+  return array;
+}
+
+common::HashValue* MakeHash(int64_t size) {
+  common::HashValue* hash = common::Value::CreateHashValue();
+  for (int64_t i = 0; i < size; ++i) {
+    hash->Insert(common::Value::CreateStringValue("field:" + std::to_string(i)),
+                 common::Value::CreateStringValue("value with spaces " + std::to_string(i)));
+  }
+  return hash;
+}
+
+}  // namespace
+
+static void BM_ConvertArray(benchmark::State& state) {
+  std::unique_ptr<common::ArrayValue> array(MakeArray(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(core::ConvertValue(array.get(), " ", true));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertArray)->Range(8, 64 << 10);
+
+static void BM_ConvertHash(benchmark::State& state) {
+  std::unique_ptr<common::HashValue> hash(MakeHash(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(core::ConvertValue(hash.get(), " ", true));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertHash)->Range(8, 64 << 10);
+
+static void BM_ConvertArrayToHumanReadable(benchmark::State& state) {
+  std::unique_ptr<common::ArrayValue> array(MakeArray(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(core::ConvertToHumanReadable(array.get()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertArrayToHumanReadable)->Range(8, 64 << 10);
+
+static void BM_ConvertHashToHumanReadable(benchmark::State& state) {
+  std::unique_ptr<common::HashValue> hash(MakeHash(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(core::ConvertToHumanReadable(hash.get()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvertHashToHumanReadable)->Range(8, 64 << 10);
+
+static void BM_KeyForCommandLine(benchmark::State& state) {
+  std::string data;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    data += static_cast<char>(i % 256);
+  }
+  const core::key_t key(data);  // binary, hex escaped
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(key.GetKeyForCommandLine());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_KeyForCommandLine)->Range(16, 16 << 10);
@@ -5,6 +5,7 @@
 #include "core/db/forestdb/db_connection.h"
 #include "core/db/leveldb/db_connection.h"
 #include "core/db/lmdb/db_connection.h"
+#include "core/db/redis/db_connection.h"
 #include "core/db/rocksdb/db_connection.h"
 #include "core/db/unqlite/db_connection.h"
 #include "core/db/upscaledb/db_connection.h"
@@ -194,3 +195,36 @@ TEST(Connection, forestdb) {
   ASSERT_TRUE(!errn);
 }
 #endif
+
+#ifdef BUILD_WITH_REDIS
+TEST(Connection, redis_script_select) {
+  core::redis::DBConnection db(nullptr);
+  core::redis::RConfig rcfg;
+  common::Error err = db.Connect(rcfg);
+  if (err) {  // needs local server
+    return;
+  }
+  ASSERT_TRUE(db.IsConnected());
+
+  // select and client side command between pipelined runs must keep current database
+  const std::vector<core::command_buffer_t> script = {"SELECT 1", "HSET script:test field value", "DBKCOUNT",
+                                                      "HGET script:test field", "SELECT 2", "PING"};
+  size_t failed = 0;
+  common::Error first_failure;
+  err = db.ExecuteAsPipeline(script, &failed, &first_failure);
+  ASSERT_TRUE(!err);
+  ASSERT_EQ(failed, 0u);
+  ASSERT_TRUE(!first_failure);
+  ASSERT_EQ(db.GetCurrentDBName(), "2");
+
+  const std::vector<core::command_buffer_t> cleanup = {"SELECT 1", "HDEL script:test field", "SELECT 0"};
+  err = db.ExecuteAsPipeline(cleanup, &failed, &first_failure);
+  ASSERT_TRUE(!err);
+  ASSERT_EQ(failed, 0u);
+  ASSERT_EQ(db.GetCurrentDBName(), "0");
+
+  err = db.Disconnect();
+  ASSERT_TRUE(!err);
+  ASSERT_TRUE(!db.IsConnected());
+}
+#endif
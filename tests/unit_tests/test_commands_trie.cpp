@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include "core/commands_trie.h"
+
+using namespace fastonosql;
+
+namespace {
+
+core::CommandsTrie MakeTrie() {
+  core::CommandsTrie trie;
+  trie.Insert("GET", 0);
+  trie.Insert("GETSET", 1);
+  trie.Insert("CONFIG", 2);
+  trie.Insert("CONFIG GET", 3);
+  trie.Insert("get", 4);  // duplicate of GET after folding
+  return trie;
+}
+
+}  // namespace
+
+TEST(CommandsTrie, find) {
+  core::CommandsTrie trie = MakeTrie();
+  size_t value = 100;
+  ASSERT_TRUE(trie.Find("get", 3, &value));
+  ASSERT_EQ(value, 0u);
+  ASSERT_TRUE(trie.Find("Config Get", 10, &value));
+  ASSERT_EQ(value, 3u);
+  ASSERT_FALSE(trie.Find("GETS", 4, &value));
+  ASSERT_FALSE(trie.Find("", 0, &value));
+}
+
+TEST(CommandsTrie, match_word) {
+  core::CommandsTrie trie = MakeTrie();
+  size_t value = 100;
+  const char* text = "getset key";
+  ASSERT_EQ(trie.MatchWord(text, strlen(text), &value), 6u);
+  ASSERT_EQ(value, 1u);
+
+  text = "config get maxmemory";
+  ASSERT_EQ(trie.MatchWord(text, strlen(text), &value), 10u);
+  ASSERT_EQ(value, 3u);
+
+  text = "config getx";
+  ASSERT_EQ(trie.MatchWord(text, strlen(text), &value), 6u);
+  ASSERT_EQ(value, 2u);
+
+  text = "gets";
+  ASSERT_EQ(trie.MatchWord(text, strlen(text), &value), 0u);
+  text = "get";
+  ASSERT_EQ(trie.MatchWord(text, strlen(text), &value), 3u);
+}
+
+TEST(CommandsTrie, find_by_prefix) {
+  core::CommandsTrie trie = MakeTrie();
+  std::vector<size_t> values;
+  trie.FindByPrefix("g", 1, &values);
+  ASSERT_EQ(values, std::vector<size_t>({0, 1}));
+
+  values.clear();
+  trie.FindByPrefix("CON", 3, &values);
+  ASSERT_EQ(values, std::vector<size_t>({2, 3}));
+
+  values.clear();
+  trie.FindByPrefix("x", 1, &values);
+  ASSERT_TRUE(values.empty());
+
+  values.clear();
+  trie.FindByPrefix("", 0, &values);
+  ASSERT_EQ(values.size(), 4u);
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include "core/key_pattern.h"
+
+using namespace fastonosql;
+
+TEST(KeyPattern, prefix_and_bound) {
+  core::KeyPattern pat("user:42:*");
+  ASSERT_EQ(pat.GetPrefix(), "user:42:");
+  ASSERT_EQ(pat.GetUpperBound(), "user:42;");
+  ASSERT_FALSE(pat.IsMatchAll());
+
+  core::KeyPattern esc("a\\*b*");
+  ASSERT_EQ(esc.GetPrefix(), "a*b");
+
+  core::KeyPattern all("*");
+  ASSERT_TRUE(all.IsMatchAll());
+  ASSERT_TRUE(all.GetPrefix().empty());
+  ASSERT_TRUE(all.GetUpperBound().empty());
+
+  core::KeyPattern ff(std::string("a\xff\xff*"));
+  ASSERT_EQ(ff.GetUpperBound(), "b");
+}
+
+TEST(KeyPattern, match) {
+  core::KeyPattern pat("user:*:name");
+  ASSERT_TRUE(pat.Match("user:1:name"));
+  ASSERT_TRUE(pat.Match("user::name"));
+  ASSERT_TRUE(pat.Match("user:1:name:name"));
+  ASSERT_FALSE(pat.Match("user:1:nam"));
+  ASSERT_FALSE(pat.Match("usr:1:name"));
+
+  core::KeyPattern single("k?y");
+  ASSERT_TRUE(single.Match("key"));
+  ASSERT_FALSE(single.Match("ky"));
+  ASSERT_FALSE(single.Match("keey"));
+
+  core::KeyPattern exact("key");
+  ASSERT_TRUE(exact.Match("key"));
+  ASSERT_FALSE(exact.Match("key1"));
+
+  core::KeyPattern stars("*a*b*");
+  ASSERT_TRUE(stars.Match("xxaxxbxx"));
+  ASSERT_TRUE(stars.Match("ab"));
+  ASSERT_FALSE(stars.Match("ba"));
+}
+
+TEST(KeyPattern, classes) {
+  core::KeyPattern range("id[0-9]");
+  ASSERT_TRUE(range.Match("id7"));
+  ASSERT_FALSE(range.Match("idx"));
+
+  core::KeyPattern neg("id[^ab]");
+  ASSERT_TRUE(neg.Match("idc"));
+  ASSERT_FALSE(neg.Match("ida"));
+
+  core::KeyPattern esc("[\\]]");
+  ASSERT_TRUE(esc.Match("]"));
+}
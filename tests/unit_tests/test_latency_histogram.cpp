@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include "core/commands_stats.h"
+#include "core/latency_histogram.h"
+
+using namespace fastonosql;
+
+TEST(LatencyHistogram, empty) {
+  core::LatencyHistogram hist;
+  ASSERT_EQ(hist.GetCount(), 0);
+  ASSERT_EQ(hist.GetValueAtPercentile(50), 0);
+  ASSERT_EQ(hist.GetMean(), 0);
+}
+
+TEST(LatencyHistogram, exact_small_values) {
+  core::LatencyHistogram hist;
+  for (uint64_t i = 1; i <= 10; ++i) {
+    hist.Record(i);
+  }
+
+  ASSERT_EQ(hist.GetCount(), 10);
+  ASSERT_EQ(hist.GetMin(), 1);
+  ASSERT_EQ(hist.GetMax(), 10);
+  ASSERT_EQ(hist.GetValueAtPercentile(50), 5);
+  ASSERT_EQ(hist.GetValueAtPercentile(100), 10);
+}
+
+TEST(LatencyHistogram, percentiles_precision) {
+  core::LatencyHistogram hist;
+  for (uint64_t i = 1; i <= 100000; ++i) {
+    hist.Record(i);
+  }
+
+  const uint64_t p50 = hist.GetValueAtPercentile(50);
+  const uint64_t p99 = hist.GetValueAtPercentile(99);
+  ASSERT_GE(p50, 50000);
+  ASSERT_LE(p50, 50000 + 50000 / 16);
+  ASSERT_GE(p99, 99000);
+  ASSERT_LE(p99, 100000);
+  ASSERT_GE(hist.GetValueAtPercentile(99.9), p99);
+  ASSERT_DOUBLE_EQ(hist.GetMean(), 50000.5);
+}
+
+TEST(LatencyHistogram, huge_values_and_merge) {
+  core::LatencyHistogram hist;
+  hist.Record(UINT64_MAX);
+  core::LatencyHistogram other;
+  other.Record(0);
+  hist.Merge(other);
+
+  ASSERT_EQ(hist.GetCount(), 2);
+  ASSERT_EQ(hist.GetMin(), 0);
+  ASSERT_EQ(hist.GetValueAtPercentile(100), UINT64_MAX);
+}
+
+TEST(CommandsStats, snapshot) {
+  core::CommandsStats stats;
+  stats.RecordCommand("get", 100, false);
+  stats.RecordCommand("GET", 200, true);
+  stats.RecordNetwork(50, 10, 20);
+  stats.RecordPipeline(4);
+
+  core::CommandsStatsSnapShoot snap = stats.MakeSnapShoot();
+  ASSERT_EQ(snap.commands.size(), 1);
+  ASSERT_EQ(snap.commands[0].name, "GET");
+  ASSERT_EQ(snap.commands[0].errors, 1);
+  ASSERT_EQ(snap.commands[0].latency.count, 2);
+  ASSERT_EQ(snap.bytes_sent, 10);
+  ASSERT_EQ(snap.bytes_received, 20);
+  ASSERT_EQ(snap.pipeline_depth.max, 4);
+
+  stats.Reset();
+  snap = stats.MakeSnapShoot();
+  ASSERT_TRUE(snap.commands.empty());
+  ASSERT_EQ(snap.bytes_sent, 0);
+}
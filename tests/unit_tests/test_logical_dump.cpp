@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "core/logical_dump.h"
+
+using namespace fastonosql;
+using core::DumpBlock;
+using core::DumpConfig;
+using core::DumpReader;
+using core::DumpReport;
+using core::DumpWriter;
+
+namespace {
+
+const std::string kPath = "logical_dump_test.fdmp";
+
+core::NDbKValue MakeString(const std::string& key, const std::string& value, core::ttl_t ttl = core::NO_TTL) {
+  return core::NDbKValue(core::NKey(core::key_t(key), ttl), core::NValue(common::Value::CreateStringValue(value)));
+}
+
+std::vector<core::NDbKValue> MakeRecords(size_t first, size_t count) {
+  std::vector<core::NDbKValue> records;
+  for (size_t i = first; i < first + count; ++i) {
+    records.push_back(MakeString("key:" + std::to_string(i), std::string(64, 'v')));
+  }
+  return records;
+}
+
+std::string GetValue(const core::NDbKValue& record) {
+  core::NValue value = record.GetValue();
+  return core::ConvertValue(value.get(), std::string(), false);
+}
+
+}  // namespace
+
+TEST(LogicalDump, records) {
+  common::ZSetValue* zset = common::Value::CreateZSetValue();
+  zset->Insert(common::Value::CreateStringValue("1.5"), common::Value::CreateStringValue("member"));
+  common::HashValue* hash = common::Value::CreateHashValue();
+  hash->Insert(common::Value::CreateStringValue("field"), common::Value::CreateStringValue("value"));
+
+  const uint64_t now_ms = 1500000000000;
+  std::string data;
+  core::EncodeDumpRecord(MakeString("str", std::string("bin\0ary", 7), 100), now_ms, &data);
+  core::EncodeDumpRecord(core::NDbKValue(core::NKey(core::key_t("zset")), core::NValue(zset)), now_ms, &data);
+  core::EncodeDumpRecord(core::NDbKValue(core::NKey(core::key_t("hash")), core::NValue(hash)), now_ms, &data);
+
+  // ttl left is counted from load time
+  std::vector<core::NDbKValue> records;
+  uint64_t expired = 0;
+  ASSERT_FALSE(core::DecodeDumpRecords(data, 3, now_ms + 40500, &records, &expired));
+  ASSERT_EQ(records.size(), 3u);
+  ASSERT_EQ(expired, 0u);
+  ASSERT_EQ(records[0].GetKey().GetKey().GetKeyData(), "str");
+  ASSERT_EQ(records[0].GetKey().GetTTL(), 60);
+  ASSERT_EQ(GetValue(records[0]), std::string("bin\0ary", 7));
+  ASSERT_EQ(records[1].GetValue()->GetType(), common::Value::TYPE_ZSET);
+  ASSERT_EQ(records[2].GetValue()->GetType(), common::Value::TYPE_HASH);
+  ASSERT_EQ(records[2].GetKey().GetTTL(), core::NO_TTL);
+
+  // expired keys are not imported
+  ASSERT_FALSE(core::DecodeDumpRecords(data, 3, now_ms + 100000, &records, &expired));
+  ASSERT_EQ(records.size(), 2u);
+  ASSERT_EQ(expired, 1u);
+  ASSERT_EQ(records[0].GetKey().GetKey().GetKeyData(), "zset");
+
+  ASSERT_TRUE(core::DecodeDumpRecords(data.substr(0, data.size() - 1), 3, now_ms, &records, &expired));
+}
+
+TEST(LogicalDump, write_and_read) {
+  DumpConfig dconfig;
+  dconfig.path = kPath;
+  dconfig.flags = DUMP_FLAG_COMPRESSED | DUMP_FLAG_CHECKSUM;
+
+  DumpReport report;
+  uint64_t cursor = 0;
+  DumpWriter writer;
+  ASSERT_FALSE(writer.Open(dconfig, &report, &cursor));
+  for (size_t i = 0; i < 3; ++i) {
+    DumpBlock block;
+    block.cursor = i + 1;
+    block.records = MakeRecords(i * 10, 10);
+    ASSERT_TRUE(writer.Write(&block));
+  }
+  ASSERT_FALSE(writer.Close(true));
+
+  DumpReader reader;
+  ASSERT_FALSE(reader.Open(dconfig));
+  std::vector<core::NDbKValue> records;
+  DumpBlock block;
+  while (reader.Read(&block)) {
+    records.insert(records.end(), block.records.begin(), block.records.end());
+  }
+  ASSERT_FALSE(reader.Close());
+  ASSERT_TRUE(reader.IsCompleted());
+  ASSERT_EQ(records.size(), 30u);
+  ASSERT_EQ(records[29].GetKey().GetKey().GetKeyData(), "key:29");
+
+  // skipped blocks are not decoded
+  dconfig.from_block = 2;
+  DumpReader tail;
+  ASSERT_FALSE(tail.Open(dconfig));
+  ASSERT_TRUE(tail.Read(&block));
+  ASSERT_EQ(block.records[0].GetKey().GetKey().GetKeyData(), "key:20");
+  ASSERT_FALSE(tail.Read(&block));
+  ASSERT_FALSE(tail.Close());
+
+  // completed dump can not be resumed
+  dconfig.resume = true;
+  DumpWriter resumed;
+  ASSERT_TRUE(resumed.Open(dconfig, &report, &cursor));
+  remove(kPath.c_str());
+}
+
+TEST(LogicalDump, resume) {
+  DumpConfig dconfig;
+  dconfig.path = kPath;
+  dconfig.flags = DUMP_FLAG_CHECKSUM;
+
+  DumpReport report;
+  uint64_t cursor = 0;
+  {
+    DumpWriter writer;
+    ASSERT_FALSE(writer.Open(dconfig, &report, &cursor));
+    DumpBlock block;
+    block.cursor = 42;
+    block.records = MakeRecords(0, 5);
+    ASSERT_TRUE(writer.Write(&block));
+    ASSERT_FALSE(writer.Close(false));
+  }
+
+  // interrupted dump has no end block
+  DumpReader reader;
+  ASSERT_FALSE(reader.Open(dconfig));
+  DumpBlock block;
+  while (reader.Read(&block)) {
+  }
+  ASSERT_TRUE(reader.Close());
+  ASSERT_FALSE(reader.IsCompleted());
+
+  // torn tail is dropped, cursor and counters come from complete blocks
+  FILE* file = fopen(kPath.c_str(), "ab");
+  ASSERT_TRUE(file);
+  fwrite("\x00\x05", 1, 2, file);
+  fclose(file);
+
+  dconfig.resume = true;
+  DumpWriter writer;
+  ASSERT_FALSE(writer.Open(dconfig, &report, &cursor));
+  ASSERT_EQ(cursor, 42u);
+  ASSERT_EQ(report.blocks, 1u);
+  ASSERT_EQ(report.keys, 5u);
+  block.cursor = 0;
+  block.records = MakeRecords(5, 5);
+  ASSERT_TRUE(writer.Write(&block));
+  ASSERT_FALSE(writer.Close(true));
+
+  dconfig.resume = false;
+  DumpReader full;
+  ASSERT_FALSE(full.Open(dconfig));
+  size_t keys = 0;
+  while (full.Read(&block)) {
+    keys += block.records.size();
+  }
+  ASSERT_FALSE(full.Close());
+  ASSERT_EQ(keys, 10u);
+  remove(kPath.c_str());
+}
+
+TEST(LogicalDump, args) {
+  DumpConfig dconfig;
+  ASSERT_FALSE(
+      core::ParseDumpExportArgs({"out.fdmp", "MATCH", "user:*", "count", "500", "COMPRESS", "RESUME"}, &dconfig));
+  ASSERT_EQ(dconfig.pattern, "user:*");
+  ASSERT_EQ(dconfig.count, 500u);
+  ASSERT_EQ(dconfig.flags, DUMP_FLAG_COMPRESSED);
+  ASSERT_TRUE(dconfig.resume);
+  ASSERT_TRUE(core::ParseDumpExportArgs({"out.fdmp", "COUNT", "0"}, &dconfig));
+  ASSERT_TRUE(core::ParseDumpExportArgs({"out.fdmp", "MATCH"}, &dconfig));
+
+  ASSERT_FALSE(core::ParseDumpImportArgs({"out.fdmp", "FROM", "7"}, &dconfig));
+  ASSERT_EQ(dconfig.from_block, 7u);
+  ASSERT_TRUE(core::ParseDumpImportArgs({"out.fdmp", "TO", "7"}, &dconfig));
+}
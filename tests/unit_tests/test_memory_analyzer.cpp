@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "core/memory_analyzer.h"
+
+using namespace fastonosql;
+using core::MemoryAnalyzer;
+using core::MemoryAnalyzerConfig;
+using core::MemoryKeyInfo;
+
+TEST(MemoryAnalyzer, prefix) {
+  MemoryAnalyzerConfig config;
+  MemoryAnalyzer analyzer(config);
+  ASSERT_EQ(analyzer.GetPrefix("user:1:name"), "user");
+  ASSERT_EQ(analyzer.GetPrefix("plain"), MemoryAnalyzer::no_prefix);
+
+  config.depth = 2;
+  config.ns_separator = "::";
+  MemoryAnalyzer deep(config);
+  ASSERT_EQ(deep.GetPrefix("user::1::name"), "user::1");
+  ASSERT_EQ(deep.GetPrefix("user::1"), "user");
+  ASSERT_EQ(deep.GetPrefix("user:1"), MemoryAnalyzer::no_prefix);
+}
+
+TEST(MemoryAnalyzer, top_and_groups) {
+  MemoryAnalyzerConfig config;
+  config.top = 2;
+  MemoryAnalyzer analyzer(config);
+  analyzer.Add(MemoryKeyInfo("user:1", "hash", 100, 10));
+  analyzer.Add(MemoryKeyInfo("user:2", "hash", 300, 5));
+  analyzer.Add(MemoryKeyInfo("session:1", "string", 200, 50));
+  analyzer.Add(MemoryKeyInfo("counter", "string", 50, 2));
+
+  core::MemoryReport report = analyzer.GetReport();
+  ASSERT_EQ(report.keys, 4u);
+  ASSERT_EQ(report.bytes, 650u);
+  ASSERT_EQ(report.top_keys.size(), 2u);
+  ASSERT_EQ(report.top_keys[0].key, "user:2");
+  ASSERT_EQ(report.top_keys[1].key, "session:1");
+
+  ASSERT_EQ(report.prefixes.size(), 3u);
+  ASSERT_EQ(report.prefixes[0].name, "user");
+  ASSERT_EQ(report.prefixes[0].keys, 2u);
+  ASSERT_EQ(report.prefixes[0].bytes, 400u);
+  ASSERT_EQ(report.prefixes[2].name, MemoryAnalyzer::no_prefix);
+
+  ASSERT_EQ(report.types.size(), 2u);
+  ASSERT_EQ(report.types[0].name, "hash");
+}
+
+TEST(MemoryAnalyzer, sort_by_length) {
+  MemoryAnalyzerConfig config;
+  config.top = 1;
+  config.sort_by = MemoryAnalyzerConfig::SORT_BY_LENGTH;
+  MemoryAnalyzer analyzer(config);
+  analyzer.Add(MemoryKeyInfo("big", "string", 1000, 1));
+  analyzer.Add(MemoryKeyInfo("long", "list", 10, 100));
+
+  core::MemoryReport report = analyzer.GetReport();
+  ASSERT_EQ(report.top_keys.size(), 1u);
+  ASSERT_EQ(report.top_keys[0].key, "long");
+}
+
+TEST(MemoryAnalyzer, parse_args) {
+  MemoryAnalyzerConfig config;
+  common::Error err =
+      core::ParseMemoryAnalyzerArgs({"match", "user:*", "TOP", "10", "OPS", "500", "BY", "length"}, &config);
+  ASSERT_FALSE(err);
+  ASSERT_EQ(config.pattern, "user:*");
+  ASSERT_EQ(config.top, 10u);
+  ASSERT_EQ(config.ops, 500u);
+  ASSERT_EQ(config.sort_by, MemoryAnalyzerConfig::SORT_BY_LENGTH);
+  ASSERT_EQ(config.count, static_cast<uint64_t>(MemoryAnalyzerConfig::default_count));
+
+  err = core::ParseMemoryAnalyzerArgs({"COUNT", "0"}, &config);
+  ASSERT_TRUE(err);
+  err = core::ParseMemoryAnalyzerArgs({"TOP"}, &config);
+  ASSERT_TRUE(err);
+  err = core::ParseMemoryAnalyzerArgs({"BY", "size"}, &config);
+  ASSERT_TRUE(err);
+}
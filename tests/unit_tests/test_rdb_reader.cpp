@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#ifdef BUILD_WITH_RDB
+#include <stdio.h>
+
+#include "core/db/rdb/rdb_reader.h"
+
+using namespace fastonosql;
+using core::rdb::RdbReader;
+using core::rdb::RdbRecord;
+
+namespace {
+
+const std::string kPath = "rdb_reader_test.rdb";
+
+std::string MakeString(const std::string& str) {
+  return std::string(1, static_cast<char>(str.size())) + str;
+}
+
+std::string MakeDump() {
+  std::string dump = "REDIS0011";
+  dump += '\xfa' + MakeString("redis-ver") + MakeString("7.2.0");
+  dump += std::string("\xfe\x00", 2);
+  dump += "\xfb\x05\x01";
+
+  // expire 1500000000000 ms, little endian
+  dump += std::string("\xfc\x00\x98\xf7\x3e\x5d\x01\x00\x00", 9);
+  dump += std::string(1, RDB_TYPE_STRING) + MakeString("str") + MakeString("hello");
+  dump += std::string(1, RDB_TYPE_STRING) + MakeString("int") + "\xc0\x7b";
+  // lzf: literal 'a' and back reference of 7 bytes
+  dump += std::string(1, RDB_TYPE_STRING) + MakeString("lzf") + std::string("\xc3\x04\x08\x00\x61\xa0\x00", 7);
+
+  const std::string intset("\x02\x00\x00\x00\x03\x00\x00\x00\x01\x00\x02\x00\x03\x00", 14);
+  dump += std::string(1, RDB_TYPE_SET_INTSET) + MakeString("ints") + MakeString(intset);
+
+  const std::string listpack("\x15\x00\x00\x00\x04\x00\x82" "f1\x03\x82" "v1\x03\x82" "f2\x03\x07\x01\xff", 21);
+  dump += std::string(1, RDB_TYPE_HASH_LISTPACK) + MakeString("hash") + MakeString(listpack);
+
+  dump += "\xfe\x01";
+  dump += std::string(1, RDB_TYPE_LIST) + MakeString("list") + "\x02" + MakeString("a") + MakeString("b");
+  dump += '\xff' + std::string(8, '\0');
+  return dump;
+}
+
+}  // namespace
+
+TEST(RdbReader, records) {
+  const std::string dump = MakeDump();
+  FILE* file = fopen(kPath.c_str(), "wb");
+  ASSERT_TRUE(file);
+  fwrite(dump.data(), 1, dump.size(), file);
+  fclose(file);
+
+  RdbReader reader;
+  ASSERT_FALSE(reader.Open(kPath));
+  ASSERT_EQ(reader.GetVersion(), 11);
+  ASSERT_EQ(reader.GetFileSize(), dump.size());
+
+  RdbRecord record;
+  ASSERT_FALSE(reader.ReadRecord(reader.GetFirstOffset(), &record));
+  ASSERT_EQ(record.kind, RdbRecord::AUX);
+  ASSERT_EQ(record.key, "redis-ver");
+  ASSERT_EQ(record.aux_value, "7.2.0");
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.kind, RdbRecord::SELECT_DB);
+  ASSERT_EQ(record.db, 0u);
+
+  // resize db opcode is skipped
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.kind, RdbRecord::KEY_VALUE);
+  ASSERT_EQ(record.key, "str");
+  ASSERT_EQ(record.expire_ms, 1500000000000);
+  ASSERT_EQ(record.value_size, 6u);
+  std::string key;
+  ASSERT_FALSE(reader.ReadKey(record.offset, &key));
+  ASSERT_EQ(key, "str");
+  uint64_t length = 0;
+  ASSERT_FALSE(reader.GetValueLength(record, &length));
+  ASSERT_EQ(length, 5u);
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.key, "int");
+  ASSERT_EQ(record.expire_ms, -1);
+  common::Value* value = nullptr;
+  ASSERT_FALSE(reader.ReadValue(record, &value));
+  std::string str;
+  ASSERT_TRUE(value->GetAsString(&str));
+  ASSERT_EQ(str, "123");
+  delete value;
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.key, "lzf");
+  ASSERT_FALSE(reader.ReadValue(record, &value));
+  ASSERT_TRUE(value->GetAsString(&str));
+  ASSERT_EQ(str, "aaaaaaaa");
+  delete value;
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.key, "ints");
+  ASSERT_STREQ(core::rdb::GetEncodingName(record.type), "intset");
+  ASSERT_EQ(core::rdb::GetValueType(record.type), common::Value::TYPE_SET);
+  ASSERT_FALSE(reader.GetValueLength(record, &length));
+  ASSERT_EQ(length, 3u);
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.key, "hash");
+  ASSERT_STREQ(core::rdb::GetTypeName(record.type), "hash");
+  ASSERT_FALSE(reader.GetValueLength(record, &length));
+  ASSERT_EQ(length, 2u);
+  ASSERT_FALSE(reader.ReadValue(record, &value));
+  ASSERT_EQ(value->GetType(), common::Value::TYPE_HASH);
+  delete value;
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.kind, RdbRecord::SELECT_DB);
+  ASSERT_EQ(record.db, 1u);
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.key, "list");
+  ASSERT_FALSE(reader.ReadValue(record, &value));
+  ASSERT_EQ(value->GetType(), common::Value::TYPE_ARRAY);
+  ASSERT_EQ(static_cast<common::ArrayValue*>(value)->GetSize(), 2u);
+  delete value;
+
+  ASSERT_FALSE(reader.ReadRecord(record.next_offset, &record));
+  ASSERT_EQ(record.kind, RdbRecord::END);
+
+  // truncated record
+  ASSERT_TRUE(reader.ReadRecord(reader.GetFileSize() - 1, &record));
+  reader.Close();
+  remove(kPath.c_str());
+
+  ASSERT_TRUE(reader.Open("not_existing_dump.rdb"));
+}
+#endif
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+
+#ifdef BUILD_WITH_REDIS
+#include "core/db/redis/db_connection.h"
+
+using namespace fastonosql;
+using core::redis::CopyKeysConfig;
+using core::redis::RConfig;
+
+TEST(RedisCopyKeys, args) {
+  RConfig destination;
+  CopyKeysConfig cconfig;
+  ASSERT_FALSE(core::redis::ParseCopyKeysArgs(
+      {"10.0.0.2", "6380", "AUTH", "secret", "DB", "3", "match", "user:*", "WORKERS", "8", "REPLACE", "MIGRATE"},
+      &destination, &cconfig));
+  ASSERT_EQ(destination.host.GetHost(), "10.0.0.2");
+  ASSERT_EQ(destination.host.GetPort(), 6380);
+  ASSERT_EQ(destination.auth, "secret");
+  ASSERT_EQ(destination.db_num, 3);
+  ASSERT_EQ(cconfig.pattern, "user:*");
+  ASSERT_EQ(cconfig.workers, 8u);
+  ASSERT_EQ(cconfig.count, static_cast<uint64_t>(CopyKeysConfig::default_count));
+  ASSERT_TRUE(cconfig.replace);
+  ASSERT_TRUE(cconfig.migrate);
+
+  ASSERT_TRUE(core::redis::ParseCopyKeysArgs({"10.0.0.2"}, &destination, &cconfig));
+  ASSERT_TRUE(core::redis::ParseCopyKeysArgs({"10.0.0.2", "70000"}, &destination, &cconfig));
+  ASSERT_TRUE(core::redis::ParseCopyKeysArgs({"10.0.0.2", "6379", "WORKERS", "0"}, &destination, &cconfig));
+  ASSERT_TRUE(core::redis::ParseCopyKeysArgs({"10.0.0.2", "6379", "WORKERS", "65"}, &destination, &cconfig));
+  ASSERT_TRUE(
+      core::redis::ParseCopyKeysArgs({"10.0.0.2", "6379", "SSL", "MIGRATE", "REPLACE"}, &destination, &cconfig));
+  ASSERT_TRUE(core::redis::ParseCopyKeysArgs({"10.0.0.2", "6379", "MIGRATE"}, &destination, &cconfig));
+  ASSERT_TRUE(core::redis::ParseCopyKeysArgs({"10.0.0.2", "6379", "DB"}, &destination, &cconfig));
+}
+#endif
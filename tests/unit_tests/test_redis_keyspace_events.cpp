@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#ifdef BUILD_WITH_REDIS
+#include "core/db/redis/keyspace_events.h"
+
+using namespace fastonosql;
+using core::redis::KeyspaceEvent;
+
+namespace {
+
+void AddEvent(core::redis::KeyspaceEventsBatch* batch, const std::string& event, const std::string& key) {
+  KeyspaceEvent parsed;
+  ASSERT_TRUE(core::redis::ParseKeyspaceEvent("__keyevent@0__:" + event, key, &parsed));
+  batch->Add(parsed);
+}
+
+}  // namespace
+
+TEST(KeyspaceEvents, parse) {
+  KeyspaceEvent event;
+  ASSERT_TRUE(core::redis::ParseKeyspaceEvent("__keyevent@12__:hset", "user:1", &event));
+  ASSERT_EQ(event.type, KeyspaceEvent::KEY_CHANGED);
+  ASSERT_EQ(event.key, "user:1");
+  ASSERT_EQ(event.value_type, common::Value::TYPE_HASH);
+
+  ASSERT_TRUE(core::redis::ParseKeyspaceEvent("__keyevent@0__:expired", "a", &event));
+  ASSERT_EQ(event.type, KeyspaceEvent::KEY_REMOVED);
+
+  ASSERT_FALSE(core::redis::ParseKeyspaceEvent("__keyspace@0__:a", "set", &event));
+  ASSERT_FALSE(core::redis::ParseKeyspaceEvent("__keyevent@0__:fastonosql-wakeup", "", &event));
+  ASSERT_EQ(core::redis::MakeKeyspaceEventsPattern(3), "__keyevent@3__:*");
+}
+
+TEST(KeyspaceEvents, coalesce) {
+  core::redis::KeyspaceEventsBatch batch;
+  AddEvent(&batch, "set", "a");
+  AddEvent(&batch, "append", "a");
+  AddEvent(&batch, "expire", "a");
+  AddEvent(&batch, "lpush", "b");
+  AddEvent(&batch, "del", "b");
+  AddEvent(&batch, "restore", "c");
+  AddEvent(&batch, "persist", "a");
+
+  std::vector<KeyspaceEvent> events;
+  bool overflowed = true;
+  ASSERT_FALSE(batch.Take(&events, &overflowed));
+  ASSERT_FALSE(overflowed);
+  ASSERT_EQ(events.size(), 4u);
+  ASSERT_EQ(events[0].type, KeyspaceEvent::KEY_CHANGED);
+  ASSERT_EQ(events[0].key, "a");
+  ASSERT_EQ(events[1].type, KeyspaceEvent::KEY_REMOVED);
+  ASSERT_EQ(events[1].key, "b");
+  ASSERT_EQ(events[2].key, "c");
+  ASSERT_EQ(events[3].type, KeyspaceEvent::KEY_PERSISTED);
+
+  ASSERT_FALSE(batch.Take(&events, &overflowed));
+  ASSERT_TRUE(events.empty());
+}
+
+TEST(KeyspaceEvents, rename) {
+  core::redis::KeyspaceEventsBatch batch;
+  AddEvent(&batch, "sadd", "old");
+  AddEvent(&batch, "rename_from", "old");
+  AddEvent(&batch, "rename_to", "new");
+  AddEvent(&batch, "sadd", "new");
+
+  std::vector<KeyspaceEvent> events;
+  bool overflowed = false;
+  ASSERT_FALSE(batch.Take(&events, &overflowed));
+  ASSERT_EQ(events.size(), 3u);
+  ASSERT_EQ(events[1].type, KeyspaceEvent::KEY_RENAMED);
+  ASSERT_EQ(events[1].key, "old");
+  ASSERT_EQ(events[1].new_key, "new");
+  ASSERT_EQ(events[2].value_type, common::Value::TYPE_SET);
+}
+
+TEST(KeyspaceEvents, overflow) {
+  core::redis::KeyspaceEventsBatch batch(2);
+  AddEvent(&batch, "set", "a");
+  AddEvent(&batch, "set", "a");
+  AddEvent(&batch, "set", "b");
+  AddEvent(&batch, "set", "c");
+
+  std::vector<KeyspaceEvent> events;
+  bool overflowed = false;
+  ASSERT_FALSE(batch.Take(&events, &overflowed));
+  ASSERT_TRUE(overflowed);
+  ASSERT_TRUE(events.empty());
+}
+#endif
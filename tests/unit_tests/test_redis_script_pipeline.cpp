@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#ifdef BUILD_WITH_REDIS
+#include "core/db/redis/db_connection.h"
+
+using namespace fastonosql;
+using core::redis::IsSilentPipelineCommand;
+
+TEST(RedisScriptPipeline, plain_data_commands) {
+  ASSERT_TRUE(IsSilentPipelineCommand("HSET"));
+  ASSERT_TRUE(IsSilentPipelineCommand("rpush"));
+  ASSERT_TRUE(IsSilentPipelineCommand("ZScore"));
+  ASSERT_TRUE(IsSilentPipelineCommand("ping"));
+}
+
+TEST(RedisScriptPipeline, client_state_commands) {
+  // current database
+  ASSERT_FALSE(IsSilentPipelineCommand("SELECT"));
+  ASSERT_FALSE(IsSilentPipelineCommand("FLUSHDB"));
+  ASSERT_FALSE(IsSilentPipelineCommand("SWAPDB"));
+  // key notifications
+  ASSERT_FALSE(IsSilentPipelineCommand("SET"));
+  ASSERT_FALSE(IsSilentPipelineCommand("GET"));
+  ASSERT_FALSE(IsSilentPipelineCommand("DEL"));
+  ASSERT_FALSE(IsSilentPipelineCommand("RENAME"));
+  ASSERT_FALSE(IsSilentPipelineCommand("EXPIRE"));
+  ASSERT_FALSE(IsSilentPipelineCommand("LPUSH"));
+  // client side
+  ASSERT_FALSE(IsSilentPipelineCommand("DBKCOUNT"));
+  ASSERT_FALSE(IsSilentPipelineCommand("MEMKEYS"));
+  ASSERT_FALSE(IsSilentPipelineCommand("BENCHMARK"));
+  ASSERT_FALSE(IsSilentPipelineCommand("COPYKEYS"));
+  ASSERT_FALSE(IsSilentPipelineCommand("EXPORT"));
+  ASSERT_FALSE(IsSilentPipelineCommand("IMPORT"));
+  // streaming and connection
+  ASSERT_FALSE(IsSilentPipelineCommand("MONITOR"));
+  ASSERT_FALSE(IsSilentPipelineCommand("SUBSCRIBE"));
+  ASSERT_FALSE(IsSilentPipelineCommand("QUIT"));
+  ASSERT_FALSE(IsSilentPipelineCommand(""));
+}
+#endif
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "core/script_reader.h"
+
+using namespace fastonosql;
+
+TEST(ScriptReader, buffer) {
+  const core::command_buffer_t script = "SET a 1\r\n\n   \nGET  a\nDEL a";
+  core::ScriptReader reader(&script);
+  ASSERT_EQ(reader.GetTotalBytes(), script.size());
+
+  core::command_buffer_t command;
+  ASSERT_TRUE(reader.ReadCommand(&command));
+  ASSERT_EQ(command, "SET a 1");
+  ASSERT_TRUE(reader.ReadCommand(&command));
+  ASSERT_EQ(command, "GET a");
+  ASSERT_TRUE(reader.ReadCommand(&command));
+  ASSERT_EQ(command, "DEL a");
+  ASSERT_FALSE(reader.ReadCommand(&command));
+  ASSERT_EQ(reader.GetReadBytes(), script.size());
+  ASSERT_FALSE(reader.GetReadError());
+
+  ASSERT_FALSE(reader.Rewind());
+  ASSERT_EQ(reader.GetReadBytes(), 0u);
+  ASSERT_TRUE(reader.ReadCommand(&command));
+  ASSERT_EQ(command, "SET a 1");
+}
+
+TEST(ScriptReader, file) {
+  const std::string path = "script_reader_test.txt";
+  FILE* file = fopen(path.c_str(), "wb");
+  ASSERT_TRUE(file);
+  const std::string script = "PING\n\nECHO hello\n";
+  fwrite(script.data(), 1, script.size(), file);
+  fclose(file);
+
+  core::ScriptReader* reader = nullptr;
+  ASSERT_FALSE(core::ScriptReader::OpenFile(path, &reader));
+  ASSERT_EQ(reader->GetTotalBytes(), script.size());
+
+  core::command_buffer_t command;
+  ASSERT_TRUE(reader->ReadCommand(&command));
+  ASSERT_EQ(command, "PING");
+  ASSERT_TRUE(reader->ReadCommand(&command));
+  ASSERT_EQ(command, "ECHO hello");
+  ASSERT_FALSE(reader->ReadCommand(&command));
+  ASSERT_EQ(reader->GetReadBytes(), script.size());
+  ASSERT_FALSE(reader->GetReadError());
+  delete reader;
+  remove(path.c_str());
+
+  ASSERT_TRUE(core::ScriptReader::OpenFile("not_existing_script.txt", &reader));
+}